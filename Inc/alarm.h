@@ -0,0 +1,71 @@
+/**
+  ******************************************************************************
+  * @file    alarm.h
+  * @author  Louis Barrett
+  * @brief   Header file for alarm.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+
+/* Number of alarms kept in data EEPROM, at most 32 */
+#define ALARM_MAX_ENTRIES                   32
+
+/* Weekday mask bits for ALARM_Set(), no bit set makes a one-shot alarm */
+#define ALARM_MONDAY                        (1<<0)
+#define ALARM_TUESDAY                       (1<<1)
+#define ALARM_WEDNESDAY                     (1<<2)
+#define ALARM_THURSDAY                      (1<<3)
+#define ALARM_FRIDAY                        (1<<4)
+#define ALARM_SATURDAY                      (1<<5)
+#define ALARM_SUNDAY                        (1<<6)
+#define ALARM_WEEKDAYS                      (0x1F)
+#define ALARM_EVERYDAY                      (0x7F)
+#define ALARM_ONESHOT                       (0x00)
+
+/* One alarm, packed into a single EEPROM word */
+typedef struct
+{
+  uint8_t hours;                            /* 0-23, ALARM_FREE if unused */
+  uint8_t minutes;
+  uint8_t seconds;
+  uint8_t weekdays;                         /* ALARM_* mask               */
+} ALARM_Entry;
+
+#define ALARM_FREE                          0xFF
+
+void ALARM_Init(void);
+void ALARM_Run(void);
+void ALARM_Reschedule(void);
+void ALARM_SetHandler(void (*handler)(uint8_t slot));
+
+int8_t ALARM_Set(uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t weekdays);
+void ALARM_Clear(uint8_t slot);
+const ALARM_Entry* ALARM_Get(uint8_t slot);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    calib.h
+  * @author  Louis Barrett
+  * @brief   Header file for calib.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+#include <stdbool.h>
+
+/* Smooth calibration range, in RTCCLK pulses removed per 2^20 (32 s) */
+#define CALIB_PULSES_MIN                    (-512)
+#define CALIB_PULSES_MAX                    511
+
+void CALIB_Init(void);
+void CALIB_Sync(uint32_t refSeconds, int32_t offsetMs);
+void CALIB_Stepped(int32_t stepMs);
+void CALIB_Restart(void);
+int16_t CALIB_GetPulses(void);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
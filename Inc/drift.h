@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    drift.h
+  * @author  Louis Barrett
+  * @brief   Header file for drift.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* This module has no HAL dependencies so it builds and runs on a host PC */
+
+/* Number of sync samples kept, the oldest is replaced when full */
+#define DRIFT_MAX_SAMPLES                   16
+/* Samples closer together than this (in seconds) are ignored. A full ring
+   must span the 12 hours calib.c waits for, 16 hourly samples span 15. */
+#define DRIFT_MIN_SPACING                   3600
+
+typedef struct
+{
+  uint32_t time[DRIFT_MAX_SAMPLES];         /* reference time in seconds              */
+  int32_t phase[DRIFT_MAX_SAMPLES];         /* clock minus reference in ms, no steps  */
+  uint8_t count;
+  uint8_t next;
+  int32_t steps;                            /* sum of clock steps since DRIFT_Init    */
+} DRIFT_Estimator;
+
+void DRIFT_Init(DRIFT_Estimator *est);
+void DRIFT_Restart(DRIFT_Estimator *est);
+bool DRIFT_AddSample(DRIFT_Estimator *est, uint32_t refSeconds, int32_t offsetMs);
+void DRIFT_Step(DRIFT_Estimator *est, int32_t stepMs);
+bool DRIFT_Estimate(const DRIFT_Estimator *est, uint32_t minSpan, int32_t *ppb);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
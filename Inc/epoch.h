@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    epoch.h
+  * @author  Louis Barrett
+  * @brief   Header file for epoch.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+
+/* This module has no HAL dependencies so it builds and runs on a host PC */
+
+/* A calendar in packed BCD, laid out like the RTC time and date registers.
+   Only 2000-2099 can be held. */
+typedef struct
+{
+  uint8_t year;                             /* years since 2000           */
+  uint8_t month;                            /* 1 is January               */
+  uint8_t date;
+  uint8_t weekday;                          /* 1 Monday to 7 Sunday       */
+  uint8_t hours;                            /* 24 hour                    */
+  uint8_t minutes;
+  uint8_t seconds;
+} EPOCH_Calendar;
+
+/* Seconds since 2000-01-01 00:00:00, the first day the RTC can hold */
+uint32_t EPOCH_FromCalendar(const EPOCH_Calendar *calendar);
+void EPOCH_ToCalendar(uint32_t seconds, EPOCH_Calendar *calendar);
+uint8_t EPOCH_ToBCD(uint8_t value);
+uint8_t EPOCH_MonthDays(uint8_t year, uint8_t month);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
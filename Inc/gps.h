@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    gps.h
+  * @author  Louis Barrett
+  * @brief   Header file for gps.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+#include <stdbool.h>
+
+// Definition for the GPS receiver on LPUART1 (RX only)
+#define GPS_PORT                            LPUART1
+#define GPS_BAUDRATE                        9600
+#define GPS_RX_PIN                          GPIO_PIN_11
+#define GPS_RX_GPIO_PORT                    GPIOB
+#define GPS_RX_AF                           GPIO_AF4_LPUART1
+#define GPS_CLK_ENABLE()                    __HAL_RCC_LPUART1_CLK_ENABLE()
+#define GPS_GPIO_CLK_ENABLE()               __HAL_RCC_GPIOB_CLK_ENABLE()
+#define GPS_IRQn                            RNG_LPUART1_IRQn
+
+// Definition for the GPS DMA, shares its interrupt with the USART2 channels
+#define GPS_RX_DMA_CHANNEL                  DMA1_Channel6
+#define GPS_RX_DMA_REQUEST                  DMA_REQUEST_5
+
+/* Circular receive buffer, must be a power of two. One second of NMEA at
+   9600 baud is under 1 kB, GPS_Run() is called far more often than that. */
+#define GPS_RX_BUFFER_SIZE                  256
+
+void GPS_Init(void);
+void GPS_Run(void);
+void GPS_MspInit(UART_HandleTypeDef *huart);
+void GPS_RxCallback(void);
+void GPS_RxRestart(void);
+UART_HandleTypeDef* GPS_GetHandle(void);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -32,6 +32,7 @@
   */
 
 #include "stm32l0xx_hal.h"
+#include <stdbool.h>
 
 // Definition for SPIx Pins
 #define SPIx_PORT                           SPI1
@@ -56,10 +57,48 @@
 #define LCD_RESET_GPIOPORT                  GPIOB
 #define LCD_RESET_GPIOPIN                   GPIO_PIN_1
   
+/* Faces for LCD_SetFace() */
+#define LCD_FACE_TIME                       0
+#define LCD_FACE_WORLD                      1
+#define LCD_FACE_REMOTE                     2  /* drawn by the host, see proto.h */
+
+/* Text mode grid of FONT_8X14 cells, 9 pixels apart like LCD_Print(). Only
+   whole cells fit, the last 2 pixels of the panel are left blank. */
+#define LCD_TEXT_COLUMNS                    14
+#define LCD_TEXT_ROWS                       2
+
+/* Cell attributes for LCD_TextPut(), may be combined */
+#define LCD_TEXT_NORMAL                     0x00
+#define LCD_TEXT_INVERT                     0x01
+#define LCD_TEXT_UNDERLINE                  0x02
+  
 void LCD_Init(void);
 
 void LCD_Run(void);
 
 void LCD_Print(char *s, uint16_t x, uint16_t y);
 
+/* Text mode: cells are written into a grid, LCD_TextFlush() draws the ones
+   that changed and only their columns go out with the next present */
+void LCD_TextSetRows(uint8_t rows, uint8_t top);
+uint8_t LCD_TextPut(uint8_t column, uint8_t row, const char *s, uint8_t attr);
+void LCD_TextFill(uint8_t column, uint8_t row, uint8_t count, char c, uint8_t attr);
+uint8_t LCD_TextFlush(void);
+
+/* Frame buffer only, clipped to the panel, shown by the next present */
+void ClearScreen(bool color);
+void FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, bool color);
+void InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+void XorRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t pattern);
+
+void LCD_SetFace(uint8_t face);
+uint8_t LCD_GetFace(void);
+bool LCD_ApplyDelta(uint8_t page, uint8_t column, const uint8_t *data, uint16_t length);
+void LCD_Present(void);
+bool LCD_RequestShot(void);
+uint16_t LCD_GetShot(const uint8_t **data, bool *last);
+void LCD_ReleaseShot(void);
+void LCD_SetBrightness(uint8_t level);
+const uint8_t* LCD_GetFrameBuffer(uint16_t *size);
+
 /************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file    nmea.h
+  * @author  Louis Barrett
+  * @brief   Header file for nmea.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* This module has no HAL dependencies so it builds and runs on a host PC */
+
+/* Sentences used, other talkers (GN, GL...) are accepted as well */
+#define NMEA_OTHER                          0
+#define NMEA_RMC                            1
+#define NMEA_ZDA                            2
+
+/* Time from a $--RMC or $--ZDA sentence, fields in packed BCD */
+typedef struct
+{
+  uint8_t hours;
+  uint8_t minutes;
+  uint8_t seconds;
+  uint8_t date;
+  uint8_t month;
+  uint8_t year;                             /* years since 2000           */
+  uint8_t sentence;                         /* NMEA_RMC or NMEA_ZDA       */
+  uint16_t ms;                              /* fraction of the second     */
+} NMEA_Fix;
+
+typedef struct
+{
+  uint8_t state;
+  uint8_t sentence;
+  uint8_t field;
+  uint8_t digits;                           /* characters in the field    */
+  uint8_t checksum;
+  uint8_t expected;
+  uint8_t have;                             /* fields complete so far     */
+  uint8_t broken;                           /* current field is malformed */
+  uint32_t address;                         /* last letters of $GPRMC...  */
+  uint8_t bcd[6];                           /* hh mm ss dd mm yy          */
+  uint8_t fraction;                         /* digits after the point     */
+  uint16_t ms;
+  uint16_t good;                            /* sentences with a good sum  */
+  uint16_t bad;                             /* sentences with a bad sum   */
+} NMEA_Parser;
+
+void NMEA_Init(NMEA_Parser *parser);
+bool NMEA_Parse(NMEA_Parser *parser, const uint8_t *data, uint16_t length, uint16_t *used, NMEA_Fix *fix);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
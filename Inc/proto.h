@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file    proto.h
+  * @author  Louis Barrett
+  * @brief   Header file for proto.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+#include <stdbool.h>
+
+/* Frames on USART2 are 0x00, COBS(cmd, seq, payload, CRC-16 LE), 0x00.
+   Multi-byte fields are little endian, times are seconds since 2000-01-01
+   like RTC_GetEpoch(). Keep in sync with Tools/proto.py. */
+#define PROTO_MAX_PAYLOAD                   128
+
+/* Commands */
+#define PROTO_CMD_SET_TIME                  0x01  /* u32 UTC, u16 ms -> i32 offset ms */
+#define PROTO_CMD_GET_STATS                 0x02  /* -> see PROTO_GetStats()          */
+#define PROTO_CMD_SET_BRIGHTNESS            0x03  /* u8 contrast                      */
+#define PROTO_CMD_READ_FB                   0x04  /* u16 offset, u8 length -> data    */
+#define PROTO_CMD_SET_FACE                  0x05  /* u8 face, LCD_FACE_* in lcd.h     */
+#define PROTO_CMD_FB_DELTA                  0x06  /* u8 page, u8 column, delta        */
+#define PROTO_CMD_SCREENSHOT                0x07  /* -> several replies, see below    */
+
+/* FB_DELTA carries a run length encoded XOR delta for one page of the frame
+   buffer, see LCD_ApplyDelta(). Only accepted on the remote face, which
+   starts out blank. With this bit set in the page byte the dirty pages are
+   presented once the delta is applied, i.e. on the last delta of a frame. */
+#define PROTO_FB_PRESENT                    0x80
+
+/* SCREENSHOT is answered with a series of replies carrying the same seq:
+   u16 offset, u8 last, then the next part of the frame buffer pages run
+   length encoded one after the other as for FB_DELTA. The reply with last
+   set ends the series. */
+#define PROTO_SHOT_CHUNK                    (PROTO_MAX_PAYLOAD - 3)
+
+/* A response echoes cmd | PROTO_RESPONSE and seq, then one status byte */
+#define PROTO_RESPONSE                      0x80
+
+/* Status codes */
+#define PROTO_OK                            0x00
+#define PROTO_ERR_COMMAND                   0x01
+#define PROTO_ERR_LENGTH                    0x02
+#define PROTO_ERR_RANGE                     0x03
+#define PROTO_ERR_STATE                     0x04  /* not possible on this face      */
+
+void PROTO_Init(void);
+void PROTO_Run(void);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
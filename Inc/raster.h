@@ -0,0 +1,50 @@
+/**
+  ******************************************************************************
+  * @file    raster.h
+  * @author  Louis Barrett
+  * @brief   Header file for raster.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+
+/* This module has no HAL dependencies so it builds and runs on a host PC */
+
+/* Frame buffer geometry: pages of 8 pixel rows, one byte is a column of a
+   page with bit n for row n */
+#define RASTER_WIDTH                        128
+#define RASTER_HEIGHT                       32
+
+/* Raster operations of RASTER_Apply() */
+#define RASTER_ROP_CLEAR                    0
+#define RASTER_ROP_SET                      1
+#define RASTER_ROP_XOR                      2
+
+void RASTER_Apply(uint8_t *frame, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t rop, uint8_t pattern);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -32,10 +32,56 @@
   */
 
 #include "stm32l0xx_hal.h"
+#include <stdbool.h>
+
+/* Layout flags for RTC_FormatTime() and RTC_SetLayout() */
+#define RTC_SHOW_SECONDS                    (1<<0)
+#define RTC_SHOW_12H                        (1<<1)
+#define RTC_SHOW_DATE                       (1<<2)
+#define RTC_SHOW_WEEKDAY                    (1<<3)
+#define RTC_SHOW_TENTHS                     (1<<4)
+
+/* Rollover events for RTC_Subscribe(), one bit per calendar field */
+#define RTC_ROLL_SECOND                     (1<<0)
+#define RTC_ROLL_MINUTE                     (1<<1)
+#define RTC_ROLL_HOUR                       (1<<2)
+#define RTC_ROLL_DAY                        (1<<3)
+#define RTC_ROLL_MONTH                      (1<<4)
+#define RTC_ROLL_YEAR                       (1<<5)
+
+/* Number of rollover subscribers */
+#define RTC_MAX_SUBSCRIBERS                 8
+
+/* Called from RTC_Run() with the fields that changed and the new BCD time */
+typedef void (*RTC_RolloverHandler)(uint8_t events, const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date);
+
+/* Display update rates for RTC_SetUpdateRate() */
+#define RTC_UPDATE_FAST                     0
+#define RTC_UPDATE_SECOND                   1
+#define RTC_UPDATE_MINUTE                   2
 
 void RTC_Init(void);
 void RTC_Run(void);
 RTC_HandleTypeDef* RTC_GetHandle(void);
+bool RTC_IsWarmBoot(void);
 uint8_t* RTC_GetTime(void);
+bool RTC_UpdateDue(void);
+void RTC_SetUpdateRate(uint8_t rate);
+uint16_t RTC_GetSubSeconds(void);
+void RTC_ReadCalendar(RTC_TimeTypeDef *time, RTC_DateTypeDef *date);
+void RTC_SetLayout(uint8_t layout);
+uint8_t RTC_FormatTime(char *buf, const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date, uint8_t layout);
+
+/* Seconds since 2000-01-01 00:00:00, the first day the RTC can hold */
+uint32_t RTC_GetEpoch(uint16_t *subSeconds);
+void RTC_SetEpoch(uint32_t seconds);
+void RTC_ShiftMs(int16_t ms);
+uint32_t RTC_ToEpoch(const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date);
+void RTC_FromEpoch(uint32_t seconds, RTC_TimeTypeDef *time, RTC_DateTypeDef *date);
+
+void RTC_SetDaylightSaving(bool active, bool shift);
+bool RTC_IsDaylightSaving(void);
+void RTC_GetShownTime(RTC_TimeTypeDef *time, RTC_DateTypeDef *date);
+bool RTC_Subscribe(uint8_t events, RTC_RolloverHandler handler);
 
 /************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -59,6 +59,8 @@ void DebugMon_Handler(void);
 void PendSV_Handler(void);
 void SysTick_Handler(void);
 void RTC_IRQHandler(void);
+void USART2_IRQHandler(void);
+void DMA1_Channel4_5_6_7_IRQHandler(void);
 void SPIx_DMA_RX_IRQHandler(void);
 void SPIx_DMA_TX_IRQHandler(void);
 
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    trace.h
+  * @author  Louis Barrett
+  * @brief   Header file for trace.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+
+/* Comment out to compile every trace point away */
+#define TRACE_ENABLED
+
+/* Number of records held in RAM, must be a power of two */
+#define TRACE_BUFFER_SIZE                   64
+
+/* Trace event IDs, keep in sync with Tools/trace_decode.py */
+#define TRACE_EVT_OVERFLOW                  0x00  /* payload: records dropped     */
+#define TRACE_EVT_RTC_WAKEUP                0x01
+#define TRACE_EVT_RENDER_START              0x02
+#define TRACE_EVT_RENDER_END                0x03
+#define TRACE_EVT_SPI_START                 0x04  /* payload: bytes sent          */
+#define TRACE_EVT_SPI_DONE                  0x05
+#define TRACE_EVT_SLEEP_ENTER               0x06
+#define TRACE_EVT_SLEEP_EXIT                0x07
+#define TRACE_EVT_PRESENT                   0x08  /* payload: 1/256 s late        */
+#define TRACE_EVT_ALARM                     0x09  /* payload: alarm slot          */
+
+/* One trace record as it is sent over the UART (little endian, 8 bytes).
+   The timestamp counts SysTick input clocks, so it is in CPU cycles. */
+typedef struct
+{
+  uint32_t timestamp;
+  uint16_t payload;
+  uint8_t event;
+  uint8_t seq;
+} TRACE_Record;
+
+#ifdef TRACE_ENABLED
+void TRACE_Event(uint8_t event, uint16_t payload);
+void TRACE_Run(void);
+#else
+#define TRACE_Event(event, payload)
+#define TRACE_Run()
+#endif
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
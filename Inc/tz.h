@@ -0,0 +1,73 @@
+/**
+  ******************************************************************************
+  * @file    tz.h
+  * @author  Louis Barrett
+  * @brief   Header file for tz.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+#include <stdbool.h>
+
+/* Zone 0 is home: the RTC calendar runs on its local time */
+#define TZ_HOME                             0
+#define TZ_MAX_ZONES                        4
+/* Longest abbreviation kept, including the terminator */
+#define TZ_NAME_LENGTH                      6
+
+/* A daylight saving change, the Mm.w.d/time part of a POSIX TZ string */
+typedef struct
+{
+  uint8_t month;                            /* 1-12                           */
+  uint8_t week;                             /* 1-4, 5 for the last            */
+  uint8_t weekday;                          /* 0 for Sunday to 6 for Saturday */
+  int16_t minutes;                          /* local time of the change       */
+} TZ_Rule;
+
+typedef struct
+{
+  char name[TZ_NAME_LENGTH];
+  char dstName[TZ_NAME_LENGTH];
+  int16_t offset;                           /* standard time minus UTC, minutes     */
+  int16_t dstOffset;                        /* summer time minus UTC, minutes       */
+  bool hasDst;
+  TZ_Rule start;                            /* change to summer time, standard time */
+  TZ_Rule end;                              /* change back, in summer time          */
+} TZ_Zone;
+
+void TZ_Init(void);
+bool TZ_Parse(const char *spec, TZ_Zone *zone);
+bool TZ_SetZone(uint8_t index, const char *spec);
+uint8_t TZ_GetZoneCount(void);
+int16_t TZ_GetOffset(uint8_t index);
+const char* TZ_GetName(uint8_t index);
+uint32_t TZ_GetUTC(uint16_t *subSeconds);
+void TZ_SetUTC(uint32_t seconds);
+uint8_t TZ_FormatZone(char *buf, uint8_t index, const RTC_TimeTypeDef *home);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    uart.h
+  * @author  Louis Barrett
+  * @brief   Header file for uart.c
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "stm32l0xx_hal.h"
+#include <stdbool.h>
+
+// Definition for USARTx (ST-Link virtual COM port on the Nucleo board)
+#define USARTx_PORT                         USART2
+#define USARTx_BAUDRATE                     115200
+#define USARTx_TX_PIN                       GPIO_PIN_2
+#define USARTx_TX_GPIO_PORT                 GPIOA
+#define USARTx_TX_AF                        GPIO_AF4_USART2
+#define USARTx_RX_PIN                       GPIO_PIN_3
+#define USARTx_RX_GPIO_PORT                 GPIOA
+#define USARTx_RX_AF                        GPIO_AF4_USART2
+#define USARTx_CLK_ENABLE()                 __HAL_RCC_USART2_CLK_ENABLE()
+#define USARTx_GPIO_CLK_ENABLE()            __HAL_RCC_GPIOA_CLK_ENABLE()
+#define USARTx_IRQn                         USART2_IRQn
+
+// Definition for USARTx's DMA
+#define USARTx_TX_DMA_CHANNEL               DMA1_Channel4
+#define USARTx_TX_DMA_REQUEST               DMA_REQUEST_4
+#define USARTx_RX_DMA_CHANNEL               DMA1_Channel5
+#define USARTx_RX_DMA_REQUEST               DMA_REQUEST_4
+#define USARTx_DMA_IRQn                     DMA1_Channel4_5_6_7_IRQn
+
+/* Circular receive buffer, must be a power of two. It must hold everything
+   that can arrive between two calls of UART_RxPeek(). */
+#define UART_RX_BUFFER_SIZE                 256
+
+void UART_Init(void);
+UART_HandleTypeDef* UART_GetHandle(void);
+
+bool UART_TxBusy(void);
+HAL_StatusTypeDef UART_Transmit(uint8_t *data, uint16_t length);
+
+bool UART_RxEvent(void);
+uint16_t UART_RxPeek(const uint8_t **data);
+void UART_RxConsume(uint16_t length);
+void UART_IdleCallback(void);
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -49,6 +49,7 @@
 //#define  USE_FONT_8X12
 //#define USE_FONT_8X12_KRPM
 #define  USE_FONT_8X14
+//#define  USE_FONT_8X14P
 //#define  USE_FONT_10X16
 //#define  USE_FONT_12X16
 //#define  USE_FONT_12X20
@@ -56,7 +57,9 @@
 //#define  USE_FONT_20X32
 //#define  USE_FONT_22X36
 //#define  USE_FONT_24X40
+//#define  USE_FONT_24X40R
 //#define  USE_FONT_32X53
+//#define  USE_FONT_32X53R
 
 /* Specify platform-dependent integer types here */
 
@@ -88,12 +91,61 @@ typedef signed long int       UG_S32;
 /* -- GUI FONTS                                                                 -- */
 /* -- Source: http://www.mikrocontroller.net/user/show/benedikt                  -- */
 /* -------------------------------------------------------------------------------- */
+/* One glyph of a proportional font. The bitmap is trimmed to the ink and
+   placed relative to the pen position and the top of the line. */
+typedef struct
+{
+   UG_U16 offset;          /* first byte in UG_FONT_PROP.bitmap */
+   UG_U8 width;            /* bounding box */
+   UG_U8 height;
+   UG_S8 x_ofs;
+   UG_S8 y_ofs;
+   UG_U8 advance;          /* pen step to the next glyph */
+} UG_GLYPH;
+
+/* Kerning pair, the table is sorted by left then right */
+typedef struct
+{
+   UG_U8 left;
+   UG_U8 right;
+   UG_S8 adjust;
+} UG_KERN;
+
+/* Glyph index of a proportional font, from first to last (Latin-1 codes).
+   Generated by Tools/fontconv.py. */
+typedef struct
+{
+   const UG_U8* bitmap;
+   const UG_GLYPH* glyph;
+   const UG_KERN* kern;
+   UG_U16 kern_cnt;
+   UG_U8 first;
+   UG_U8 last;
+} UG_FONT_PROP;
+
+/* Run length coded glyphs of a fixed cell font. Each glyph is read column by
+   column, top to bottom, as alternating background and foreground runs
+   (background first), packed LSB first. A run too long for its field goes
+   on after a zero run of the other color. The background after the last
+   foreground pixel is not stored. Generated by Tools/fontconv.py. */
+typedef struct
+{
+   const UG_U8* data;
+   const UG_U16* offset;   /* glyph n is data[offset[n]] up to data[offset[n+1]] */
+   UG_U8 bits_bg;          /* field width of the background runs */
+   UG_U8 bits_fg;          /* field width of the foreground runs */
+} UG_FONT_RLE;
+
+/* Fonts with a LUT only store the glyphs they use: LUT[code] is the glyph
+   number, 0 for codes without a glyph of their own. */
 typedef struct
 {
    unsigned char* p;
-   uint8_t* LUT;
-   UG_S16 char_width;
-   UG_S16 char_height;
+   const UG_U8* LUT;       /* NULL for full 256 glyph tables */
+   UG_S16 char_width;      /* widest advance for proportional fonts */
+   UG_S16 char_height;     /* line height */
+   const UG_FONT_PROP* prop; /* NULL for fixed cell fonts */
+   const UG_FONT_RLE* rle;   /* NULL for plain bitmaps */
 } UG_FONT;
 
 #ifdef USE_FONT_4X6
@@ -126,6 +178,9 @@ typedef struct
 #ifdef USE_FONT_8X14
    extern const UG_FONT FONT_8X14;
 #endif
+#ifdef USE_FONT_8X14P
+   extern const UG_FONT FONT_8X14P;
+#endif
 #ifdef USE_FONT_10X16
    extern const UG_FONT FONT_10X16;
 #endif
@@ -147,9 +202,15 @@ typedef struct
 #ifdef USE_FONT_24X40
    extern const UG_FONT FONT_24X40;
 #endif
+#ifdef USE_FONT_24X40R
+   extern const UG_FONT FONT_24X40R;
+#endif
 #ifdef USE_FONT_32X53
    extern const UG_FONT FONT_32X53;
 #endif
+#ifdef USE_FONT_32X53R
+   extern const UG_FONT FONT_32X53R;
+#endif
 
 /* -------------------------------------------------------------------------------- */
 /* -- TYPEDEFS                                                                   -- */
@@ -222,6 +283,24 @@ typedef struct
    UG_S16 ye;
 } UG_AREA;
 
+/* Lines kept in a text layout, longer texts are laid out again as they are drawn */
+#define UG_TEXT_LINES                                 4
+
+/* Cached layout of a text in its area. The owner clears 'valid' whenever
+   the text, font, spacing or alignment changes. */
+typedef struct
+{
+   UG_U8 valid;
+   UG_U8 lines;                  /* lines to draw, stops at one too wide */
+   UG_U16 next;                  /* first char not laid out yet, 0 if none */
+   UG_S16 w;                     /* size of the area it was made for */
+   UG_S16 h;
+   UG_S16 y;                     /* top of the first line, relative to the area */
+   UG_U16 start[UG_TEXT_LINES];  /* first char of each line */
+   UG_S16 width[UG_TEXT_LINES];
+   UG_S16 x[UG_TEXT_LINES];      /* aligned origin, relative to the area */
+} UG_TEXT_LAYOUT;
+
 /* Text structure */
 typedef struct
 {
@@ -233,6 +312,7 @@ typedef struct
    UG_U8 align;
    UG_S16 h_space;
    UG_S16 v_space;
+   UG_TEXT_LAYOUT* layout;       /* NULL to lay the text out on every draw */
 } UG_TEXT;
 
 /* -------------------------------------------------------------------------------- */
@@ -403,6 +483,7 @@ typedef struct
    UG_COLOR abc;
    const UG_FONT* font;
    char* str;
+   UG_TEXT_LAYOUT layout;
 }UG_BUTTON;
 
 /* Default button IDs */
@@ -455,6 +536,7 @@ typedef struct
    UG_U8 align;
    UG_S8 h_space;
    UG_S8 v_space;
+   UG_TEXT_LAYOUT layout;
 } UG_TEXTBOX;
 
 /* Default textbox IDs */
@@ -527,9 +609,23 @@ typedef struct
 #define DRIVER_ENABLED                                (1<<1)
 
 /* Supported drivers */
-#define NUMBER_OF_DRIVERS                             2
+#define NUMBER_OF_DRIVERS                             4
 #define DRIVER_DRAW_LINE                              0
 #define DRIVER_FILL_FRAME                             1
+/* void f(xs,ys,xe,ye): called for every area UG_Update() has repainted */
+#define DRIVER_DIRTY_AREA                             2
+/* UG_RESULT f(p,x,y,w,h,fc,bc): draws one glyph bitmap, h rows of (w+7)/8
+   bytes with the leftmost pixel in bit 0. Only given glyphs inside the clip. */
+#define DRIVER_PUT_CHAR                               3
+
+/* -------------------------------------------------------------------------------- */
+/* -- CLIPPING                                                                   -- */
+/* -------------------------------------------------------------------------------- */
+/* Nested clip rectangles on top of the whole screen */
+#define UG_CLIP_DEPTH                                 4
+
+/* Dirty rectangles kept for UG_Update(), touching ones are merged */
+#define UG_DIRTY_RECTS                                4
 
 /* -------------------------------------------------------------------------------- */
 /* -- GUI CORE STRUCTURE                                                        -- */
@@ -557,9 +653,11 @@ typedef struct
    struct
    {
       unsigned char* p;
-      uint8_t* LUT;
+      const UG_U8* LUT;
       UG_S16 char_width;
       UG_S16 char_height;
+      const UG_FONT_PROP* prop;
+      const UG_FONT_RLE* rle;
       UG_S8 char_h_space;
       UG_S8 char_v_space;
    } font;
@@ -568,9 +666,14 @@ typedef struct
    UG_COLOR desktop_color;
    UG_U8 state;
    UG_DRIVER driver[NUMBER_OF_DRIVERS];
+   UG_AREA clip[UG_CLIP_DEPTH+1];
+   UG_U8 clip_depth;
+   UG_AREA dirty[UG_DIRTY_RECTS];
+   UG_U8 dirty_cnt;
 } UG_GUI;
 
 #define UG_SATUS_WAIT_FOR_UPDATE                      (1<<0)
+#define UG_SATUS_TOUCH_ACTIVE                         (1<<1)
 
 /* -------------------------------------------------------------------------------- */
 /* -- GUI COLORS                                                                -- */
@@ -748,6 +851,13 @@ UG_S16 UG_GetXDim( void );
 UG_S16 UG_GetYDim( void );
 void UG_FontSetHSpace( UG_U16 s );
 void UG_FontSetVSpace( UG_U16 s );
+const UG_GLYPH* UG_FontGetGlyph( const UG_FONT* font, UG_U8 chr );
+UG_S16 UG_FontGetKerning( const UG_FONT* font, UG_U8 left, UG_U8 right );
+void UG_MeasureText( const UG_FONT* font, const char* str, UG_S16 h_space, UG_S16 v_space, UG_S16* w, UG_S16* h );
+UG_RESULT UG_ClipPush( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
+UG_RESULT UG_ClipPop( void );
+void UG_ClipGetArea( UG_AREA* a );
+void UG_Invalidate( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
 
 /* Miscellaneous functions */
 void UG_WaitForUpdate( void );
@@ -0,0 +1,398 @@
+/**
+  ******************************************************************************
+  * @file    alarm.c
+  * @author  Louis Barrett
+  * @brief   Alarm scheduler, many alarms multiplexed onto RTC alarm A
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "alarm.h"
+#include "rtc.h"
+#include "trace.h"
+#include <string.h>
+
+/* Private define ------------------------------------------------------------*/
+#define SECONDS_PER_DAY      86400UL
+
+/* Data EEPROM layout: one magic word followed by one word per alarm */
+#define ALARM_EEPROM_BASE    DATA_EEPROM_BASE
+#define ALARM_EEPROM_MAGIC   0x414C5201UL
+#define ALARM_EEPROM_ENTRY(slot) (ALARM_EEPROM_BASE + 4 + ((slot) * 4))
+
+/* Queue keys: seconds since Monday 00:00:00 in the upper bits, slot below */
+#define QUEUE_KEY(ws, slot)  (((ws) << 8) | (slot))
+#define QUEUE_TIME(key)      ((key) >> 8)
+#define QUEUE_SLOT(key)      ((uint8_t)((key) & 0xFF))
+
+/* Private variables ---------------------------------------------------------*/
+static ALARM_Entry alarms[ALARM_MAX_ENTRIES];
+
+/* Every pending occurrence within the coming week, sorted by time. A
+   recurring alarm has one key per weekday, a one-shot alarm a single one. */
+static uint32_t alarmQueue[ALARM_MAX_ENTRIES * 7];
+static uint16_t alarmQueueLength = 0;
+
+/* Week time currently programmed into alarm A */
+static uint32_t alarmNext = 0;
+static volatile bool alarmFired = false;
+
+static void (*alarmHandler)(uint8_t slot) = NULL;
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Returns the current time as seconds since Monday 00:00:00 */
+static uint32_t ALARM_WeekTime(void)
+{
+  RTC_TimeTypeDef time;
+  RTC_DateTypeDef date;
+
+  RTC_ReadCalendar(&time, &date);
+
+  return (date.WeekDay - 1) * SECONDS_PER_DAY + RTC_Bcd2ToByte(time.Hours) * 3600UL
+         + RTC_Bcd2ToByte(time.Minutes) * 60UL + RTC_Bcd2ToByte(time.Seconds);
+}
+
+static uint32_t ALARM_DayTime(const ALARM_Entry *alarm)
+{
+  return alarm->hours * 3600UL + alarm->minutes * 60UL + alarm->seconds;
+}
+
+/* Returns the index of the first key greater than the given one */
+static uint16_t ALARM_QueueSearch(uint32_t key)
+{
+  uint16_t low = 0;
+  uint16_t high = alarmQueueLength;
+  uint16_t mid;
+
+  while (low < high)
+  {
+    mid = (low + high) >> 1;
+    if (alarmQueue[mid] <= key)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+/* Returns true if the queue holds the given key */
+static bool ALARM_QueueHas(uint32_t key)
+{
+  uint16_t index = ALARM_QueueSearch(key);
+
+  return (index > 0 && alarmQueue[index - 1] == key);
+}
+
+static void ALARM_QueueInsert(uint32_t key)
+{
+  uint16_t index = ALARM_QueueSearch(key);
+
+  memmove(&alarmQueue[index + 1], &alarmQueue[index], (alarmQueueLength - index) * sizeof(uint32_t));
+  alarmQueue[index] = key;
+  alarmQueueLength++;
+}
+
+/* Drops every occurrence of a slot, order is kept */
+static void ALARM_QueueRemove(uint8_t slot)
+{
+  uint16_t i;
+  uint16_t length = 0;
+
+  for (i = 0; i < alarmQueueLength; i++)
+  {
+    if (QUEUE_SLOT(alarmQueue[i]) != slot)
+    {
+      alarmQueue[length++] = alarmQueue[i];
+    }
+  }
+  alarmQueueLength = length;
+}
+
+/* Adds the occurrences of one alarm. A one-shot alarm goes off at the next
+   time its hh:mm:ss comes round, relative to the given week time. */
+static void ALARM_QueueAdd(uint8_t slot, uint32_t now)
+{
+  const ALARM_Entry *alarm = &alarms[slot];
+  uint32_t dayTime = ALARM_DayTime(alarm);
+  uint32_t day;
+
+  if (alarm->hours == ALARM_FREE)
+  {
+    return;
+  }
+
+  if (alarm->weekdays == ALARM_ONESHOT)
+  {
+    day = now / SECONDS_PER_DAY;
+    if (dayTime <= now % SECONDS_PER_DAY)
+    {
+      day = (day == 6) ? 0 : day + 1;
+    }
+    ALARM_QueueInsert(QUEUE_KEY(day * SECONDS_PER_DAY + dayTime, slot));
+    return;
+  }
+
+  for (day = 0; day < 7; day++)
+  {
+    if (alarm->weekdays & (1 << day))
+    {
+      ALARM_QueueInsert(QUEUE_KEY(day * SECONDS_PER_DAY + dayTime, slot));
+    }
+  }
+}
+
+/* Programs alarm A with the first occurrence after the given week time,
+   wrapping round to next week */
+static void ALARM_Program(uint32_t now)
+{
+  RTC_AlarmTypeDef salarmstructure = {0};
+  uint16_t index;
+  uint32_t dayTime;
+
+  HAL_RTC_DeactivateAlarm(RTC_GetHandle(), RTC_ALARM_A);
+  if (alarmQueueLength == 0)
+  {
+    return;
+  }
+
+  index = ALARM_QueueSearch(QUEUE_KEY(now, 0xFF));
+  if (index == alarmQueueLength)
+  {
+    index = 0;
+  }
+  alarmNext = QUEUE_TIME(alarmQueue[index]);
+  dayTime = alarmNext % SECONDS_PER_DAY;
+
+  salarmstructure.Alarm = RTC_ALARM_A;
+  salarmstructure.AlarmDateWeekDay = (alarmNext / SECONDS_PER_DAY) + RTC_WEEKDAY_MONDAY;
+  salarmstructure.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_WEEKDAY;
+  salarmstructure.AlarmMask = RTC_ALARMMASK_NONE;
+  salarmstructure.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_ALL;
+  salarmstructure.AlarmTime.TimeFormat = RTC_HOURFORMAT12_AM;
+  salarmstructure.AlarmTime.Hours = dayTime / 3600;
+  salarmstructure.AlarmTime.Minutes = (dayTime / 60) % 60;
+  salarmstructure.AlarmTime.Seconds = dayTime % 60;
+
+  HAL_RTC_SetAlarm_IT(RTC_GetHandle(), &salarmstructure, RTC_FORMAT_BIN);
+}
+
+static uint32_t ALARM_Pack(const ALARM_Entry *alarm)
+{
+  return alarm->hours | (alarm->minutes << 8) | ((uint32_t)alarm->seconds << 16) | ((uint32_t)alarm->weekdays << 24);
+}
+
+static void ALARM_Unpack(ALARM_Entry *alarm, uint32_t word)
+{
+  alarm->hours = word & 0xFF;
+  alarm->minutes = (word >> 8) & 0xFF;
+  alarm->seconds = (word >> 16) & 0xFF;
+  alarm->weekdays = (word >> 24) & 0xFF;
+}
+
+/* Writes a word to data EEPROM unless it already holds that value */
+static void ALARM_StoreWord(uint32_t address, uint32_t word)
+{
+  if (*(__IO uint32_t *)address == word)
+  {
+    return;
+  }
+  HAL_FLASHEx_DATAEEPROM_Unlock();
+  HAL_FLASHEx_DATAEEPROM_Program(FLASH_TYPEPROGRAMDATA_WORD, address, word);
+  HAL_FLASHEx_DATAEEPROM_Lock();
+}
+
+/* Releases a slot in RAM and EEPROM without reprogramming alarm A */
+static void ALARM_Free(uint8_t slot)
+{
+  alarms[slot].hours = ALARM_FREE;
+  ALARM_StoreWord(ALARM_EEPROM_ENTRY(slot), ALARM_Pack(&alarms[slot]));
+  ALARM_QueueRemove(slot);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/* Loads the alarms from data EEPROM and arms the first one. Call after
+   RTC_Init(). */
+void ALARM_Init(void)
+{
+  uint8_t slot;
+  bool valid = (*(__IO uint32_t *)ALARM_EEPROM_BASE == ALARM_EEPROM_MAGIC);
+
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    if (valid)
+    {
+      ALARM_Unpack(&alarms[slot], *(__IO uint32_t *)ALARM_EEPROM_ENTRY(slot));
+    }
+    else
+    {
+      alarms[slot].hours = ALARM_FREE;
+      ALARM_StoreWord(ALARM_EEPROM_ENTRY(slot), ALARM_Pack(&alarms[slot]));
+    }
+  }
+  if (!valid)
+  {
+    ALARM_StoreWord(ALARM_EEPROM_BASE, ALARM_EEPROM_MAGIC);
+  }
+
+  ALARM_Reschedule();
+}
+
+/* Rebuilds the queue from the current time, call after the time was set */
+void ALARM_Reschedule(void)
+{
+  uint32_t now = ALARM_WeekTime();
+  uint8_t slot;
+
+  alarmQueueLength = 0;
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    ALARM_QueueAdd(slot, now);
+  }
+  ALARM_Program(now);
+}
+
+/* Called for every alarm that goes off, from the main loop */
+void ALARM_SetHandler(void (*handler)(uint8_t slot))
+{
+  alarmHandler = handler;
+}
+
+/* Adds an alarm and returns its slot, or -1 if the time is out of range or
+   all slots are used */
+int8_t ALARM_Set(uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t weekdays)
+{
+  uint32_t now;
+  uint8_t slot;
+
+  /* Also keeps ALARM_FREE out of the hours of a used slot */
+  if (hours > 23 || minutes > 59 || seconds > 59)
+  {
+    return -1;
+  }
+
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    if (alarms[slot].hours == ALARM_FREE)
+    {
+      break;
+    }
+  }
+  if (slot == ALARM_MAX_ENTRIES)
+  {
+    return -1;
+  }
+
+  alarms[slot].hours = hours;
+  alarms[slot].minutes = minutes;
+  alarms[slot].seconds = seconds;
+  alarms[slot].weekdays = weekdays & ALARM_EVERYDAY;
+  ALARM_StoreWord(ALARM_EEPROM_ENTRY(slot), ALARM_Pack(&alarms[slot]));
+
+  now = ALARM_WeekTime();
+  ALARM_QueueAdd(slot, now);
+  ALARM_Program(now);
+  return slot;
+}
+
+void ALARM_Clear(uint8_t slot)
+{
+  if (slot >= ALARM_MAX_ENTRIES || alarms[slot].hours == ALARM_FREE)
+  {
+    return;
+  }
+
+  ALARM_Free(slot);
+  ALARM_Program(ALARM_WeekTime());
+}
+
+const ALARM_Entry* ALARM_Get(uint8_t slot)
+{
+  return (slot < ALARM_MAX_ENTRIES) ? &alarms[slot] : NULL;
+}
+
+/* Handles a fired alarm A, call from the main loop. Every alarm due at the
+   programmed time is reported, one-shot alarms are then removed and alarm A
+   is moved on to the next occurrence. Nothing is done between alarms. */
+void ALARM_Run(void)
+{
+  uint32_t due = 0;
+  uint32_t now = alarmNext;
+  uint16_t index;
+  uint8_t slot;
+
+  if (!alarmFired)
+  {
+    return;
+  }
+  alarmFired = false;
+
+  /* Collect the due slots first, the handler may add or clear alarms. That
+     reprograms alarm A and moves alarmNext, so keep the time that fired. */
+  index = ALARM_QueueSearch(QUEUE_KEY(now, 0xFF));
+  while (index > 0 && QUEUE_TIME(alarmQueue[index - 1]) == now)
+  {
+    index--;
+    due |= 1UL << QUEUE_SLOT(alarmQueue[index]);
+  }
+
+  for (slot = 0; due != 0; slot++, due >>= 1)
+  {
+    /* An earlier handler may have cleared this slot or set a new alarm in
+       it, which is only due if it still has an occurrence now */
+    if ((due & 1) == 0 || !ALARM_QueueHas(QUEUE_KEY(now, slot)))
+    {
+      continue;
+    }
+
+    TRACE_Event(TRACE_EVT_ALARM, slot);
+    if (alarmHandler != NULL)
+    {
+      alarmHandler(slot);
+    }
+    /* Unless the handler replaced it with an alarm due at another time */
+    if (alarms[slot].weekdays == ALARM_ONESHOT && ALARM_QueueHas(QUEUE_KEY(now, slot)))
+    {
+      ALARM_Free(slot);
+    }
+  }
+
+  ALARM_Program(now);
+}
+
+/* Called from RTC_IRQHandler when alarm A matches */
+void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef *hrtc)
+{
+  alarmFired = true;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    calib.c
+  * @author  Louis Barrett
+  * @brief   RTC smooth calibration, adjusted from reference time syncs
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "calib.h"
+#include "rtc.h"
+#include "drift.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Upper half of RTC_BKP_DR2 once it holds a calibration value */
+#define CALIB_VALID          0xCA11
+
+/* Syncs must cover this many seconds before the rate is corrected */
+#define CALIB_MIN_SPAN       (12UL * 3600)
+
+/* Private variables ---------------------------------------------------------*/
+static DRIFT_Estimator calibDrift;
+
+/* Pulses removed per 2^20 RTCCLK periods, CALM - 512 * CALP */
+static int16_t calibPulses = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Programs the RTC_CALR register. A negative count is made by adding 512
+   pulses (CALP) and removing 512 + count of them again (CALM). */
+static void CALIB_Apply(void)
+{
+  uint32_t plus = RTC_SMOOTHCALIB_PLUSPULSES_RESET;
+  uint32_t minus = (uint32_t)calibPulses;
+
+  if (calibPulses < 0)
+  {
+    plus = RTC_SMOOTHCALIB_PLUSPULSES_SET;
+    minus = (uint32_t)(512 + calibPulses);
+  }
+  HAL_RTCEx_SetSmoothCalib(RTC_GetHandle(), RTC_SMOOTHCALIB_PERIOD_32SEC, plus, minus);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/* Restores the last calibration, call after RTC_Init() */
+void CALIB_Init(void)
+{
+  uint32_t saved = HAL_RTCEx_BKUPRead(RTC_GetHandle(), RTC_BKP_DR2);
+
+  DRIFT_Init(&calibDrift);
+
+  if ((saved >> 16) == CALIB_VALID)
+  {
+    calibPulses = (int16_t)(saved & 0xFFFF);
+    if (calibPulses < CALIB_PULSES_MIN || calibPulses > CALIB_PULSES_MAX)
+    {
+      calibPulses = 0;
+    }
+  }
+  CALIB_Apply();
+}
+
+/**
+  * @brief  Feeds one comparison against a reference clock (host sync, GPS).
+  *         Once the syncs span long enough the rate error is turned into
+  *         calibration pulses, applied and saved in RTC_BKP_DR2.
+  * @param  refSeconds : reference time of the comparison, any epoch
+  * @param  offsetMs : RTC minus reference, in ms
+  * @retval None
+  */
+void CALIB_Sync(uint32_t refSeconds, int32_t offsetMs)
+{
+  int32_t ppb;
+  int32_t pulses;
+  int64_t scaled;
+
+  if (!DRIFT_AddSample(&calibDrift, refSeconds, offsetMs))
+  {
+    return;
+  }
+  if (!DRIFT_Estimate(&calibDrift, CALIB_MIN_SPAN, &ppb))
+  {
+    return;
+  }
+
+  /* One pulse per 2^20 clocks is 953.67 ppb, round to the nearest pulse */
+  scaled = (int64_t)ppb << 20;
+  scaled += (scaled < 0) ? -500000000 : 500000000;
+  pulses = calibPulses + (int32_t)(scaled / 1000000000);
+
+  if (pulses < CALIB_PULSES_MIN)
+  {
+    pulses = CALIB_PULSES_MIN;
+  }
+  else if (pulses > CALIB_PULSES_MAX)
+  {
+    pulses = CALIB_PULSES_MAX;
+  }
+  if (pulses == calibPulses)
+  {
+    return;
+  }
+
+  calibPulses = (int16_t)pulses;
+  CALIB_Apply();
+  HAL_RTCEx_BKUPWrite(RTC_GetHandle(), RTC_BKP_DR2, ((uint32_t)CALIB_VALID << 16) | (uint16_t)calibPulses);
+
+  /* The older samples were taken at the old rate */
+  DRIFT_Restart(&calibDrift);
+}
+
+/* Forgets all syncs, for when the clock was too far off to compare */
+void CALIB_Restart(void)
+{
+  DRIFT_Init(&calibDrift);
+}
+
+/* Call whenever the RTC is set, stepMs is how far it was moved */
+void CALIB_Stepped(int32_t stepMs)
+{
+  DRIFT_Step(&calibDrift, stepMs);
+}
+
+int16_t CALIB_GetPulses(void)
+{
+  return calibPulses;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
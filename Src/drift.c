@@ -0,0 +1,191 @@
+/**
+  ******************************************************************************
+  * @file    drift.c
+  * @author  Louis Barrett
+  * @brief   Clock drift estimator fed with reference time samples
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "drift.h"
+
+/* Private define ------------------------------------------------------------*/
+#define DRIFT_MAX_PAIRS      ((DRIFT_MAX_SAMPLES * (DRIFT_MAX_SAMPLES - 1)) / 2)
+
+/* Private variables ---------------------------------------------------------*/
+/* Scratch space for the pairwise slopes, kept off the 1 kB stack */
+static int32_t slopes[DRIFT_MAX_PAIRS];
+
+/* Public functions ----------------------------------------------------------*/
+
+void DRIFT_Init(DRIFT_Estimator *est)
+{
+  est->count = 0;
+  est->next = 0;
+  est->steps = 0;
+}
+
+/* Drops every sample but the newest, used once the clock rate was changed
+   and older samples no longer describe it */
+void DRIFT_Restart(DRIFT_Estimator *est)
+{
+  uint8_t newest;
+
+  if (est->count == 0)
+  {
+    return;
+  }
+  newest = (est->next + DRIFT_MAX_SAMPLES - 1) % DRIFT_MAX_SAMPLES;
+  est->time[0] = est->time[newest];
+  est->phase[0] = est->phase[newest];
+  est->count = 1;
+  est->next = 1;
+}
+
+/**
+  * @brief  Adds a comparison against a reference clock.
+  * @param  refSeconds : reference time of the sample, any epoch
+  * @param  offsetMs : clock minus reference at that time, in ms
+  * @retval true if the sample was kept, false if too close to the last one
+  *         or not after it
+  */
+bool DRIFT_AddSample(DRIFT_Estimator *est, uint32_t refSeconds, int32_t offsetMs)
+{
+  uint8_t last;
+
+  if (est->count != 0)
+  {
+    last = (est->next + DRIFT_MAX_SAMPLES - 1) % DRIFT_MAX_SAMPLES;
+    /* Signed, so a reference that went backwards is not a huge spacing */
+    if ((int32_t)(refSeconds - est->time[last]) < DRIFT_MIN_SPACING)
+    {
+      return false;
+    }
+  }
+
+  /* Steps were applied on top of the free running phase, take them out */
+  est->time[est->next] = refSeconds;
+  est->phase[est->next] = offsetMs - est->steps;
+  est->next = (est->next + 1) % DRIFT_MAX_SAMPLES;
+  if (est->count < DRIFT_MAX_SAMPLES)
+  {
+    est->count++;
+  }
+  return true;
+}
+
+/* Tells the estimator the clock was moved by stepMs, e.g. -offset when it
+   was set to the reference */
+void DRIFT_Step(DRIFT_Estimator *est, int32_t stepMs)
+{
+  est->steps += stepMs;
+}
+
+/**
+  * @brief  Estimates the clock rate error with the Theil-Sen method: the
+  *         median of the slopes between sample pairs. A few bad sync
+  *         samples move the median very little, unlike a least squares fit.
+  *         Only pairs at least half the span apart are used, short pairs
+  *         mostly measure sync jitter.
+  * @param  minSpan : seconds the samples must cover before estimating
+  * @param  ppb : rate error in parts per billion, positive if running fast
+  * @retval true if an estimate was made
+  */
+bool DRIFT_Estimate(const DRIFT_Estimator *est, uint32_t minSpan, int32_t *ppb)
+{
+  uint32_t first = est->time[0];
+  uint32_t span = 0;
+  uint32_t dt;
+  uint16_t pairs = 0;
+  uint16_t i, j, k;
+  int32_t slope;
+
+  if (est->count < 2)
+  {
+    return false;
+  }
+
+  for (i = 0; i < est->count; i++)
+  {
+    if ((int32_t)(est->time[i] - first) < 0)
+    {
+      first = est->time[i];
+    }
+  }
+  for (i = 0; i < est->count; i++)
+  {
+    if (est->time[i] - first > span)
+    {
+      span = est->time[i] - first;
+    }
+  }
+  if (span < minSpan)
+  {
+    return false;
+  }
+
+  for (i = 0; i < est->count; i++)
+  {
+    for (j = 0; j < est->count; j++)
+    {
+      dt = est->time[j] - est->time[i];
+      if ((int32_t)dt <= 0 || dt < span / 2)
+      {
+        continue;
+      }
+
+      /* ms per s is 10^6 ppb */
+      slope = (int32_t)(((int64_t)(est->phase[j] - est->phase[i]) * 1000000) / (int32_t)dt);
+
+      /* Insertion sort, there are at most a few dozen long pairs */
+      k = pairs++;
+      while (k > 0 && slopes[k - 1] > slope)
+      {
+        slopes[k] = slopes[k - 1];
+        k--;
+      }
+      slopes[k] = slope;
+    }
+  }
+
+  if (pairs == 0)
+  {
+    return false;
+  }
+
+  if (pairs & 1)
+  {
+    *ppb = slopes[pairs / 2];
+  }
+  else
+  {
+    *ppb = (slopes[pairs / 2 - 1] + slopes[pairs / 2]) / 2;
+  }
+  return true;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    epoch.c
+  * @author  Louis Barrett
+  * @brief   Conversions between the BCD calendar and seconds since 2000
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "epoch.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Days in four years starting with a leap year, 2000-2099 only */
+#define DAYS_PER_4_YEARS    1461
+/* 2000-01-01, day 0 of the epoch, was a Saturday */
+#define EPOCH_WEEKDAY       6
+
+/* Private variables ---------------------------------------------------------*/
+/* Days before the first of each month in a common year, plus the year length */
+static const uint16_t daysBefore[13] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365};
+
+/* Private functions ---------------------------------------------------------*/
+static uint8_t EPOCH_FromBCD(uint8_t bcd)
+{
+  return (uint8_t)((bcd >> 4) * 10 + (bcd & 0x0F));
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/* Converts 0-99 to packed BCD. The tens are found with a multiply and shift
+   (205 / 2048 ~ 1 / 10, exact below 1029) instead of the subtraction loop
+   in RTC_ByteToBcd2(). */
+uint8_t EPOCH_ToBCD(uint8_t value)
+{
+  uint8_t tens = (uint8_t)((value * 205U) >> 11);
+  return (uint8_t)((tens << 4) | (value - tens * 10));
+}
+
+/* Returns the number of days in a month (1-12) of a year (0-99) */
+uint8_t EPOCH_MonthDays(uint8_t year, uint8_t month)
+{
+  uint8_t days = (uint8_t)(daysBefore[month] - daysBefore[month - 1]);
+
+  return (month == 2 && (year & 3) == 0) ? days + 1 : days;
+}
+
+/**
+  * @brief  Converts a BCD calendar to seconds since 2000-01-01 00:00:00.
+  *         The day number comes from the year times 365 plus the leap days
+  *         before it and a table of month starts, so there are no loops.
+  * @param  calendar : date 2000-2099 and 24 hour time, the weekday is ignored
+  * @retval Seconds since the epoch
+  */
+uint32_t EPOCH_FromCalendar(const EPOCH_Calendar *calendar)
+{
+  uint32_t year = EPOCH_FromBCD(calendar->year);
+  uint32_t month = EPOCH_FromBCD(calendar->month);
+  uint32_t days;
+
+  /* Every fourth year from 2000 is a leap year, (year + 3) / 4 were before */
+  days = year * 365 + ((year + 3) >> 2) + daysBefore[month - 1] + EPOCH_FromBCD(calendar->date) - 1;
+  if (month > 2 && (year & 3) == 0)
+  {
+    days++;
+  }
+
+  return ((days * 24 + EPOCH_FromBCD(calendar->hours)) * 60 + EPOCH_FromBCD(calendar->minutes)) * 60
+         + EPOCH_FromBCD(calendar->seconds);
+}
+
+/**
+  * @brief  Converts seconds since 2000-01-01 00:00:00 to a BCD calendar.
+  *         Divisions split off the day and the four year cycle, and the
+  *         weekday is the day modulo 7. The year within the cycle takes at
+  *         most three subtractions, the month one compare after a table
+  *         lookup, and the time reciprocal multiplies.
+  * @param  seconds : seconds since the epoch, up to the end of 2099
+  * @param  calendar : receives the date, weekday and time
+  * @retval None
+  */
+void EPOCH_ToCalendar(uint32_t seconds, EPOCH_Calendar *calendar)
+{
+  uint32_t days = seconds / 86400;
+  uint32_t rest = seconds - days * 86400;
+  uint32_t cycle = days / DAYS_PER_4_YEARS;
+  uint32_t day = days - cycle * DAYS_PER_4_YEARS;
+  uint32_t year = cycle * 4;
+  uint32_t leap = 0;
+  uint32_t month;
+  uint32_t value;
+
+  /* The first year of each cycle has 366 days */
+  if (day < 366)
+  {
+    leap = 1;
+  }
+  else
+  {
+    day -= 366;
+    year++;
+    while (day >= 365)
+    {
+      day -= 365;
+      year++;
+    }
+  }
+
+  /* No month is longer than 32 days, so day / 32 is the month or one short */
+  month = day >> 5;
+  if (day >= daysBefore[month + 1] + ((month + 1 >= 2) ? leap : 0))
+  {
+    month++;
+  }
+  day -= daysBefore[month] + ((month >= 2) ? leap : 0);
+
+  calendar->year = EPOCH_ToBCD((uint8_t)year);
+  calendar->month = EPOCH_ToBCD((uint8_t)(month + 1));
+  calendar->date = EPOCH_ToBCD((uint8_t)(day + 1));
+  calendar->weekday = (uint8_t)((days + EPOCH_WEEKDAY - 1) % 7 + 1);
+
+  /* 37283 / 2^27 ~ 1 / 3600 and 2185 / 2^17 ~ 1 / 60, both exact in range */
+  value = (rest * 37283U) >> 27;
+  calendar->hours = EPOCH_ToBCD((uint8_t)value);
+  rest -= value * 3600;
+  value = (rest * 2185U) >> 17;
+  calendar->minutes = EPOCH_ToBCD((uint8_t)value);
+  calendar->seconds = EPOCH_ToBCD((uint8_t)(rest - value * 60));
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,267 @@
+/**
+  ******************************************************************************
+  * @file    gps.c
+  * @author  Louis Barrett
+  * @brief   Sets the RTC from the time sentences of a GPS receiver
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "gps.h"
+#include "nmea.h"
+#include "rtc.h"
+#include "calib.h"
+#include "tz.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Time from the second boundary to the end of the RMC sentence at 9600
+   baud. It comes first in each burst and is about 70 characters long, the
+   ZDA sentence comes after a varying number of others. */
+#define GPS_RMC_DELAY_MS                    80
+/* One character (start, 8 data and stop bit) on the wire, in us */
+#define GPS_CHAR_US                         (10000000UL / GPS_BAUDRATE)
+/* Phase errors from this up are shifted out, two RTC subsecond ticks */
+#define GPS_MIN_PHASE_MS                    8
+/* Phase errors from this up step the calendar instead */
+#define GPS_MAX_PHASE_MS                    750
+/* Beyond this the calibration history is useless, e.g. after a cold boot */
+#define GPS_MAX_SYNC_STEP                   (24L * 3600)
+
+/* Private variables ---------------------------------------------------------*/
+UART_HandleTypeDef GpsHandle;
+DMA_HandleTypeDef GpsRxDmaHandle;
+
+static uint8_t gpsBuffer[GPS_RX_BUFFER_SIZE];
+static uint16_t gpsTail = 0;
+/* Set on idle line, half and full buffer, cleared by GPS_Run() */
+static volatile bool gpsEvent = false;
+static volatile bool gpsRestart = false;
+static NMEA_Parser gpsParser;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void GPS_StartReceive(void)
+{
+  gpsTail = 0;
+  HAL_UART_Receive_DMA(&GpsHandle, gpsBuffer, GPS_RX_BUFFER_SIZE);
+  __HAL_UART_CLEAR_IDLEFLAG(&GpsHandle);
+  __HAL_UART_ENABLE_IT(&GpsHandle, UART_IT_IDLE);
+}
+
+/* Sets the calendar to a fix that is age ms old. Setting it restarts the
+   subseconds at zero, so it is set to the last whole second and the rest
+   of the age is shifted in, leaving no phase error behind. */
+static void GPS_Step(uint32_t reference, int32_t age)
+{
+  TZ_SetUTC(reference + age / 1000);
+  RTC_ShiftMs((int16_t)(age % 1000));
+}
+
+/**
+  * @brief  Compares the RTC against one fix and corrects it. Every
+  *         comparison feeds the drift estimate. A phase error of a few ms
+  *         is shifted out without stopping the RTC, and one of
+  *         GPS_MAX_PHASE_MS or more steps the calendar. Either way the
+  *         calibration is told how far the clock was moved.
+  * @param  fix : time of the last second boundary, from the receiver
+  * @param  pending : characters received since the end of the sentence
+  * @retval None
+  */
+static void GPS_Sync(const NMEA_Fix *fix, uint16_t pending)
+{
+  RTC_TimeTypeDef time = {0};
+  RTC_DateTypeDef date = {0};
+  uint16_t subSeconds;
+  uint32_t now = TZ_GetUTC(&subSeconds);
+  uint32_t reference;
+  int32_t seconds;
+  int32_t offset;
+  int32_t age;
+
+  time.Hours = fix->hours;
+  time.Minutes = fix->minutes;
+  time.Seconds = fix->seconds;
+  date.Date = fix->date;
+  date.Month = fix->month;
+  date.Year = fix->year;
+  reference = RTC_ToEpoch(&time, &date);
+
+  /* The sentence is late by its own length on the wire, and by whatever
+     arrived after it before the idle line woke GPS_Run() up */
+  age = fix->ms + GPS_RMC_DELAY_MS + (int32_t)((pending * GPS_CHAR_US) / 1000);
+  seconds = (int32_t)(now - reference);
+
+  if (seconds <= -GPS_MAX_SYNC_STEP || seconds >= GPS_MAX_SYNC_STEP)
+  {
+    /* Any sentence gets the date right, an RMC one then fixes the phase */
+    CALIB_Restart();
+    GPS_Step(reference, age);
+    return;
+  }
+  /* The delay of a ZDA sentence is not known well enough to compare */
+  if (fix->sentence != NMEA_RMC)
+  {
+    return;
+  }
+
+  offset = seconds * 1000 + ((subSeconds * 1000) >> 8) - age;
+  CALIB_Sync(reference, offset);
+
+  if (offset <= -GPS_MAX_PHASE_MS || offset >= GPS_MAX_PHASE_MS)
+  {
+    /* The step takes out the whole offset */
+    CALIB_Stepped(-offset);
+    GPS_Step(reference, age);
+  }
+  else if (offset <= -GPS_MIN_PHASE_MS || offset >= GPS_MIN_PHASE_MS)
+  {
+    CALIB_Stepped(-offset);
+    RTC_ShiftMs((int16_t)-offset);
+  }
+}
+
+void GPS_MspInit(UART_HandleTypeDef *huart)
+{
+  GPIO_InitTypeDef  GPIO_InitStruct;
+  RCC_PeriphCLKInitTypeDef PeriphClkInit;
+
+  /*##-1- Enable peripherals and GPIO Clocks #################################*/
+  /* Clocked from the LSE, which RTC_Init() has already started */
+  PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_LPUART1;
+  PeriphClkInit.Lpuart1ClockSelection = RCC_LPUART1CLKSOURCE_LSE;
+  HAL_RCCEx_PeriphCLKConfig(&PeriphClkInit);
+
+  GPS_GPIO_CLK_ENABLE();
+  GPS_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /*##-2- Configure peripheral GPIO ##########################################*/
+  GPIO_InitStruct.Pin       = GPS_RX_PIN;
+  GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
+  GPIO_InitStruct.Pull      = GPIO_PULLUP;
+  GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_LOW;
+  GPIO_InitStruct.Alternate = GPS_RX_AF;
+  HAL_GPIO_Init(GPS_RX_GPIO_PORT, &GPIO_InitStruct);
+
+  /*##-3- Configure the DMA for reception ####################################*/
+  GpsRxDmaHandle.Instance                 = GPS_RX_DMA_CHANNEL;
+  GpsRxDmaHandle.Init.Request             = GPS_RX_DMA_REQUEST;
+  GpsRxDmaHandle.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+  GpsRxDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+  GpsRxDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+  GpsRxDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+  GpsRxDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+  GpsRxDmaHandle.Init.Mode                = DMA_CIRCULAR;
+  GpsRxDmaHandle.Init.Priority            = DMA_PRIORITY_MEDIUM;
+  HAL_DMA_Init(&GpsRxDmaHandle);
+  __HAL_LINKDMA(huart, hdmarx, GpsRxDmaHandle);
+
+  /*##-4- Configure the NVIC #################################################*/
+  /* The DMA interrupt is enabled by UART_Init() */
+  HAL_NVIC_SetPriority(GPS_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(GPS_IRQn);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/* There is no separate LPUART driver in this HAL, the UART one covers it */
+void GPS_Init(void)
+{
+  GpsHandle.Instance            = GPS_PORT;
+  GpsHandle.Init.BaudRate       = GPS_BAUDRATE;
+  GpsHandle.Init.WordLength     = UART_WORDLENGTH_8B;
+  GpsHandle.Init.StopBits       = UART_STOPBITS_1;
+  GpsHandle.Init.Parity         = UART_PARITY_NONE;
+  GpsHandle.Init.HwFlowCtl      = UART_HWCONTROL_NONE;
+  GpsHandle.Init.Mode           = UART_MODE_RX;
+  GpsHandle.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
+
+  HAL_UART_Init(&GpsHandle);
+  NMEA_Init(&gpsParser);
+  GPS_StartReceive();
+}
+
+UART_HandleTypeDef* GPS_GetHandle(void)
+{
+  return &GpsHandle;
+}
+
+/* Parses whatever arrived straight out of the DMA ring, call from the main
+   loop. A sentence split over the end of the ring just continues in place. */
+void GPS_Run(void)
+{
+  const uint8_t *data;
+  uint16_t head;
+  uint16_t length;
+  uint16_t used;
+  bool found;
+  NMEA_Fix fix;
+
+  if (!gpsEvent && !gpsRestart)
+  {
+    return;
+  }
+  gpsEvent = false;
+
+  if (gpsRestart)
+  {
+    gpsRestart = false;
+    NMEA_Init(&gpsParser);
+    GPS_StartReceive();
+    return;
+  }
+
+  do
+  {
+    head = (GPS_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&GpsRxDmaHandle)) & (GPS_RX_BUFFER_SIZE - 1);
+    data = &gpsBuffer[gpsTail];
+    length = (head >= gpsTail) ? (head - gpsTail) : (GPS_RX_BUFFER_SIZE - gpsTail);
+
+    found = NMEA_Parse(&gpsParser, data, length, &used, &fix);
+    gpsTail = (gpsTail + used) & (GPS_RX_BUFFER_SIZE - 1);
+    if (found)
+    {
+      head = (GPS_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&GpsRxDmaHandle)) & (GPS_RX_BUFFER_SIZE - 1);
+      GPS_Sync(&fix, (head - gpsTail) & (GPS_RX_BUFFER_SIZE - 1));
+    }
+  } while (length != 0);
+}
+
+/* Called from RNG_LPUART1_IRQHandler when the line goes idle after a burst,
+   and from the UART callbacks in uart.c on half and full buffer */
+void GPS_RxCallback(void)
+{
+  gpsEvent = true;
+}
+
+/* Called from the UART callbacks in uart.c for the LPUART1 handle */
+void GPS_RxRestart(void)
+{
+  gpsRestart = true;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -34,15 +34,33 @@
 #include "lcd.h"
 #include "ugui.h"
 #include "rtc.h"
+#include "tz.h"
+#include "trace.h"
+#include "raster.h"
 #include "stm32l0xx_hal_spi.h"
 #include <stdbool.h>
+#include <string.h>
 
 // Width of LCD panel
-#define LCD_WIDTH   128
+#define LCD_WIDTH   RASTER_WIDTH
 // Height of LCD panel
-#define LCD_HEIGHT  32
+#define LCD_HEIGHT  RASTER_HEIGHT
 // Frame buffer size
 #define FRAME_BUFFER_SIZE         (LCD_HEIGHT * (LCD_WIDTH / 8))
+// Pages of 8 pixel rows, one frame buffer byte is a column of a page
+#define LCD_PAGES                 (LCD_HEIGHT / 8)
+// Raster operations of LCD_Raster()
+#define LCD_ROP_CLEAR             RASTER_ROP_CLEAR
+#define LCD_ROP_SET               RASTER_ROP_SET
+#define LCD_ROP_XOR               RASTER_ROP_XOR
+// Screenshot scratch area, room for two pages that do not compress at all
+#define LCD_SHOT_SIZE             (2 * (LCD_WIDTH + 1))
+// Characters per line of the world clock, 9 pixels each in FONT_8X14
+#define LCD_WORLD_COLUMNS         14
+// Text mode font and cell pitch, the glyph plus one blank column
+#define LCD_TEXT_FONT             FONT_8X14
+#define LCD_TEXT_PITCH            9
+#define LCD_TEXT_ROW_PITCH        16
 
 /* LCD pre-defined initialization commands */
 #define LCD_CASET                  0x21
@@ -90,10 +108,36 @@ SPI_HandleTypeDef SpiHandler;
 
 static uint8_t frameBuffer[FRAME_BUFFER_SIZE];
 bool firstTime = true;
+/* The frame buffer holds the next second, waiting for its boundary */
+static bool frameReady = false;
+/* What LCD_Run() draws, see LCD_FACE_* in lcd.h */
+static uint8_t lcdFace = LCD_FACE_TIME;
+/* Pages changed since the last transfer, bit n for page n, and the columns
+   changed in each of them */
+static uint8_t dirtyPages = 0;
+static uint8_t dirtyFirst[LCD_PAGES];
+static uint8_t dirtyLast[LCD_PAGES];
+/* Text mode: the cells asked for and the cells in the frame buffer */
+static char textChars[LCD_TEXT_ROWS][LCD_TEXT_COLUMNS];
+static uint8_t textAttrs[LCD_TEXT_ROWS][LCD_TEXT_COLUMNS];
+static char shownChars[LCD_TEXT_ROWS][LCD_TEXT_COLUMNS];
+static uint8_t shownAttrs[LCD_TEXT_ROWS][LCD_TEXT_COLUMNS];
+/* Rows in use and the pixel row of the first, 0 rows until a layout is set */
+static uint8_t textRows = 0;
+static uint8_t textTop = 0;
+static bool presentDue = false;
+/* GUI draws into frameBuffer through LCD_PSet() and LCD_FillFrame() */
+static UG_GUI lcdGui;
+/* Screenshot: compressed pages, taken right after a frame was presented */
+static uint8_t shotBuffer[LCD_SHOT_SIZE];
+static uint16_t shotLength = 0;
+/* Next page to capture, LCD_PAGES when there is no capture going on */
+static uint8_t shotPage = LCD_PAGES;
+static bool shotArmed = false;
 
 void WaitForSPI(void);
 void delay(uint32_t milliseconds);
-void LCD_PutChar(char chr, int16_t x, int16_t y, const UG_FONT *font);
+int16_t LCD_PutChar(char chr, int16_t x, int16_t y, const UG_FONT *font);
 void LCD_Print(char *s, uint16_t x, uint16_t y);
 void LCD_Init_GPIO(void);
 void WriteCmd(uint8_t command);
@@ -121,99 +165,302 @@ void delay(uint32_t milliseconds)
 /* Adds a given string to the character buffer */
 void PrintText(char *s, uint16_t x, uint16_t y, const UG_FONT *font, uint16_t fc, uint16_t bc)
 {
+  uint8_t last = 0;
+
   /* Pointer to each incremental character */
   while(*s != 0)
   {
-    LCD_PutChar(*s, x, y, font);
+    x += UG_FontGetKerning(font, last, (uint8_t)*s);
+    last = (uint8_t)*s;
 
-    /* Move the next character over by the font width plus one so they don't touch */
-    x += font->char_width + 1;
+    /* Move the next character over by its advance plus one so they don't touch */
+    x += LCD_PutChar(*s, x, y, font) + 1;
     s++;
   }
 }
 
+/* Blits a whole glyph a column at a time: the rows of each glyph column are
+   gathered into one word first, then each page it covers is written once
+   instead of once per pixel. Registered as the DRIVER_PUT_CHAR accelerator,
+   it takes glyphs that lie fully on the panel (at most 32 rows). */
+static UG_RESULT LCD_PutGlyph(const unsigned char *p, UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, UG_COLOR fc, UG_COLOR bc)
+{
+  uint32_t column[8];
+  uint32_t fg;
+  uint32_t bg;
+  uint32_t bits;
+  uint32_t mask;
+  uint32_t rows;
+  uint8_t *dst;
+  uint8_t b;
+  int16_t i, j, k, n, bn;
+
+  if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > LCD_WIDTH || y + h > LCD_HEIGHT)
+  {
+    return UG_RESULT_FAIL;
+  }
+
+  fg = (fc != C_BLACK) ? 0xFFFFFFFF : 0;
+  bg = (bc != C_BLACK) ? 0xFFFFFFFF : 0;
+  rows = (h == 32) ? 0xFFFFFFFF : ((1UL << h) - 1);
+  bn = (w + 7) >> 3;
+
+  /* Eight columns per pass, from one byte of each glyph row */
+  for (i = 0; i < w; i += 8)
+  {
+    n = (w - i < 8) ? (w - i) : 8;
+    for (k = 0; k < 8; k++)
+    {
+      column[k] = 0;
+    }
+    for (j = 0; j < h; j++)
+    {
+      for (b = p[j * bn + (i >> 3)], k = 0; b != 0; b >>= 1, k++)
+      {
+        if (b & 0x01)
+        {
+          column[k] |= 1UL << j;
+        }
+      }
+    }
+
+    /* y + h fits the panel, so the shifted column never leaves the word */
+    for (k = 0; k < n; k++)
+    {
+      bits = ((column[k] & fg) | (~column[k] & bg)) << (y & 7);
+      mask = rows << (y & 7);
+      for (dst = &frameBuffer[x + i + k + (y / 8) * LCD_WIDTH]; mask != 0; dst += LCD_WIDTH)
+      {
+        *dst = (uint8_t)((*dst & ~mask) | (bits & mask));
+        bits >>= 8;
+        mask >>= 8;
+      }
+    }
+  }
+  return UG_RESULT_OK;
+}
+
+/* Sets or clears rows y0 up to y1 of one frame buffer column, both already
+   on the panel */
+static void LCD_VSpan(uint8_t *column, int16_t y0, int16_t y1, uint8_t set)
+{
+  uint8_t mask;
+  int16_t page;
+  int16_t last = y1 >> 3;
+
+  mask = (uint8_t)(0xFF << (y0 & 7));
+  for (page = y0 >> 3; page <= last; page++)
+  {
+    if (page == last)
+    {
+      mask &= (uint8_t)(0xFF >> (7 - (y1 & 7)));
+    }
+    if (set)
+    {
+      column[page * LCD_WIDTH] |= mask;
+    }
+    else
+    {
+      column[page * LCD_WIDTH] &= (uint8_t)~mask;
+    }
+    mask = 0xFF;
+  }
+}
+
+/* Decodes glyph n of a run length coded font into the frame buffer. The runs
+   come column by column, so each run is one or two masked writes per page it
+   covers and no glyph bitmap is built first. Parts outside the clip
+   rectangle are skipped run by run. */
+static void LCD_PutRle(const UG_FONT_RLE *rle, uint16_t n, int16_t x, int16_t y, int16_t w, int16_t h, const UG_AREA *clip)
+{
+  const uint8_t *s = &rle->data[rle->offset[n]];
+  const uint8_t *end = &rle->data[rle->offset[n + 1]];
+  uint32_t bits = 0;
+  uint8_t have = 0;
+  uint8_t size = rle->bits_bg;
+  uint8_t fg = 0;
+  uint16_t run;
+  int16_t col = 0;
+  int16_t row = 0;
+  int16_t k, y0, y1;
+
+  while (col < w)
+  {
+    while (have < size && s < end)
+    {
+      bits |= (uint32_t)*s++ << have;
+      have += 8;
+    }
+    if (have < size)
+    {
+      /* End of the data, the rest of the glyph is background */
+      fg = 0;
+      run = (w - col) * h - row;
+    }
+    else
+    {
+      run = bits & ((1 << size) - 1);
+      bits >>= size;
+      have -= size;
+    }
+
+    while (run != 0 && col < w)
+    {
+      k = h - row;
+      if (k > run)
+      {
+        k = run;
+      }
+      if (x + col >= clip->xs && x + col <= clip->xe)
+      {
+        y0 = y + row;
+        y1 = y0 + k - 1;
+        y0 = (y0 < clip->ys) ? clip->ys : y0;
+        y1 = (y1 > clip->ye) ? clip->ye : y1;
+        if (y0 <= y1)
+        {
+          LCD_VSpan(&frameBuffer[x + col], y0, y1, fg);
+        }
+      }
+      run -= k;
+      row += k;
+      if (row == h)
+      {
+        row = 0;
+        col++;
+      }
+    }
+    fg ^= 1;
+    size = fg ? rle->bits_fg : rle->bits_bg;
+  }
+}
+
 /* Adds given character to the frame buffer, this code is nearly identical to
    the PutChar function in ugui.c with some minor tweaks for this specific use */
-void LCD_PutChar(char chr, int16_t x, int16_t y, const UG_FONT *font)
+int16_t LCD_PutChar(char chr, int16_t x, int16_t y, const UG_FONT *font)
 {
-  uint16_t i,j,k;
-  uint16_t xo;
-  uint16_t yo;
-  uint16_t c;
+  int16_t i,j;
+  int16_t i0,i1,j0,j1;
+  int16_t w,h,advance;
   uint16_t bn;
-  uint8_t b;
+  uint16_t index = 0;
   uint8_t bt;
+  uint8_t mask;
   uint8_t* p;
-  uint8_t* lut;
+  uint8_t* dst;
+  const UG_GLYPH* glyph;
+  UG_AREA clip;
   
   bt = (uint8_t)chr;
-  switch ( bt )
+
+  if (font->prop != NULL)
   {
-    case 0xF6: bt = 0x94; break; // 
-    case 0xD6: bt = 0x99; break; // 
-    case 0xFC: bt = 0x81; break; // 
-    case 0xDC: bt = 0x9A; break; // 
-    case 0xE4: bt = 0x84; break; // 
-    case 0xC4: bt = 0x8E; break; // 
-    case 0xB5: bt = 0xE6; break; // 
-    case 0xB0: bt = 0xF8; break; // 
+    /* Proportional fonts index their glyphs by the Latin-1 code itself and
+       only store the bounding box of the ink */
+    glyph = UG_FontGetGlyph(font, bt);
+    if (glyph == NULL)
+    {
+      return 0;
+    }
+    p = (uint8_t *)&font->prop->bitmap[glyph->offset];
+    x += glyph->x_ofs;
+    y += glyph->y_ofs;
+    w = glyph->width;
+    h = glyph->height;
+    advance = glyph->advance;
   }
+  else
+  {
+    /* Only codes from 0xB0 on are remapped, plain ASCII skips the switch.
+       Sparse fonts map every code through their LUT instead. */
+    if ( bt >= 0xB0 && font->LUT == NULL )
+    {
+      switch ( bt )
+      {
+        case 0xF6: bt = 0x94; break; // 
+        case 0xD6: bt = 0x99; break; // 
+        case 0xFC: bt = 0x81; break; // 
+        case 0xDC: bt = 0x9A; break; // 
+        case 0xE4: bt = 0x84; break; // 
+        case 0xC4: bt = 0x8E; break; // 
+        case 0xB5: bt = 0xE6; break; // 
+        case 0xB0: bt = 0xF8; break; // 
+      }
+    }
+    w = font->char_width;
+    h = font->char_height;
+    advance = w;
 
-  yo = y;
-  if (font->char_width == 0)
+    bn = w;
+    bn >>= 3;
+    if ( w % 8 ) 
+    {
+      bn++;
+    }
+
+    // If the given font has a LUT, use this for computing the character's pixel definition
+    index = (font->LUT == NULL) ? bt : font->LUT[bt];
+    // Pointer to start of font bit table
+    p = font->p + index * h * bn;
+  }
+
+  if (w == 0 || h == 0)
   {
-    return;
+    return advance;
   }
-  
-  bn = font->char_width;
-  bn >>= 3;
-  if ( font->char_width % 8 ) 
+
+  /* Cut off the rows and columns outside the clip rectangle (at most the
+     panel) up front, a glyph fully off screen is not touched at all */
+  UG_ClipGetArea(&clip);
+  j0 = (y < clip.ys) ? clip.ys - y : 0;
+  j1 = (y + h - 1 > clip.ye) ? clip.ye - y : h - 1;
+  i0 = (x < clip.xs) ? clip.xs - x : 0;
+  i1 = (x + w - 1 > clip.xe) ? clip.xe - x : w - 1;
+  if ((j0 > j1) || (i0 > i1))
   {
-    bn++;
+    return advance;
   }
-  
-  // Pointer to start of font bit table
-  p = font->p;
-  lut = font->LUT;
-  // If the given font has a LUT, use this for computing the character's pixel definition
-  if(lut == NULL)
+
+  /* Run length coded glyphs are decoded straight into the frame buffer */
+  if (font->prop == NULL && font->rle != NULL)
   {
-    p+= bt * font->char_height * bn;
+    LCD_PutRle(font->rle, index, x, y, w, h, &clip);
+    return advance;
   }
-  else
+
+  /* Glyphs that are fully visible are blitted by column */
+  if ((j0 == 0) && (i0 == 0) && (j1 == h - 1) && (i1 == w - 1))
   {
-    lut += bt - 1;
-    p += *lut * font->char_height * bn;
+    if (LCD_PutGlyph(p, x, y, w, h, C_WHITE, C_BLACK) == UG_RESULT_OK)
+    {
+      return advance;
+    }
   }
   
-  for( j = 0; j < font->char_height; j++ )
+  bn = (w + 7) >> 3;
+  p += j0 * bn;
+  for( j = j0; j <= j1; j++ )
   {
-    xo = x;
-    c = font->char_width;
+    /* Every pixel of this row lands in the same bit of a page */
+    mask = 1 << ((y + j) & 7);
+    dst = &frameBuffer[x + ((y + j) / 8) * LCD_WIDTH];
     /* Iterate each row of pixels of the character */
-    for( i = 0; i < bn; i++ )
+    for( i = i0; i <= i1; i++ )
     {
-      b = *p++;
-      for( k=0; (k<8) && c; k++ )
+      if( p[i >> 3] & (1 << (i & 7)) )
       {
-        if( b & 0x01 )
-        {
-          // Print the pixel as a foreground (white)
-          frameBuffer[xo + (yo/8)*LCD_WIDTH] |= (1 << (yo & 7));
-        }
-        else
-        {
-          // Print the pixel as a background (black)
-          frameBuffer[xo + (yo/8)*LCD_WIDTH] &= ~(1 << (yo & 7));
-        }
-        b >>= 1;
-        xo++;
-        c--;
+        // Print the pixel as a foreground (white)
+        dst[i] |= mask;
+      }
+      else
+      {
+        // Print the pixel as a background (black)
+        dst[i] &= ~mask;
       }
     }
-    yo++;
+    p += bn;
   }
-  return;
+  return advance;
 }
 
 void LCD_Init_GPIO(void)
@@ -356,37 +603,105 @@ void HAL_SPI_MspInit(SPI_HandleTypeDef *hspi)
   }
 }
 
-/* Used to fill a rectangle of a given color (black or white), primarily used
-   to clear the screen. */
-void FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, bool color)
+/* Applies a raster operation to a rectangle of the frame buffer, see
+   RASTER_Apply() */
+static void LCD_Raster(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t rop, uint8_t pattern)
 {
-  uint16_t count = 0;
-  
-  //Make sure SPI is not busy
-  WaitForSPI();
-  
-  LCD_SetCSPin(GPIO_PIN_SET);
-  LCD_SetCSPin(GPIO_PIN_RESET);
+  RASTER_Apply(frameBuffer, x1, y1, x2, y2, rop, pattern);
+}
 
-  //Fill the frame buffer with all 0's or all FF's to make the screen
-  //white or black
-  LCD_SetDCPin(GPIO_PIN_SET);
-  if(color == 0)
+/* GUI pixel output, anything off the panel is dropped */
+static void LCD_PSet(UG_S16 x, UG_S16 y, UG_COLOR c)
+{
+  if (x < 0 || x >= LCD_WIDTH || y < 0 || y >= LCD_HEIGHT)
   {
-    for(; count < FRAME_BUFFER_SIZE; count++)
-    {
-      frameBuffer[count] = 0x00;
-    }
+    return;
+  }
+  if (c != C_BLACK)
+  {
+    frameBuffer[x + (y/8)*LCD_WIDTH] |= (1 << (y & 7));
   }
-  if(color == 1)
+  else
+  {
+    frameBuffer[x + (y/8)*LCD_WIDTH] &= ~(1 << (y & 7));
+  }
+}
+
+/* Registered as the DRIVER_FILL_FRAME accelerator, so UG_FillFrame(),
+   UG_FillScreen() and window clears come here instead of a pset per pixel.
+   C_BLACK clears, any other color lights the pixels. */
+static UG_RESULT LCD_FillFrame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c)
+{
+  LCD_Raster(x1, y1, x2, y2, (c != C_BLACK) ? LCD_ROP_SET : LCD_ROP_CLEAR, 0);
+  return UG_RESULT_OK;
+}
+
+/* Marks a rectangle of the frame buffer, clipped to the panel, to go out
+   with the next LCD_DrawDirty(). Each page keeps the span of its changed
+   columns. */
+static void LCD_MarkDirty(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+  uint8_t page;
+
+  x1 = (x1 < 0) ? 0 : x1;
+  y1 = (y1 < 0) ? 0 : y1;
+  x2 = (x2 >= LCD_WIDTH) ? LCD_WIDTH - 1 : x2;
+  y2 = (y2 >= LCD_HEIGHT) ? LCD_HEIGHT - 1 : y2;
+  if (x1 > x2 || y1 > y2)
+  {
+    return;
+  }
+
+  for (page = y1 >> 3; page <= (y2 >> 3); page++)
   {
-    for(; count < FRAME_BUFFER_SIZE; count++)
+    if (!(dirtyPages & (1 << page)))
     {
-      frameBuffer[count] = 0xFF;
+      dirtyPages |= (1 << page);
+      dirtyFirst[page] = (uint8_t)x1;
+      dirtyLast[page] = (uint8_t)x2;
+      continue;
+    }
+    if (x1 < dirtyFirst[page])
+    {
+      dirtyFirst[page] = (uint8_t)x1;
+    }
+    if (x2 > dirtyLast[page])
+    {
+      dirtyLast[page] = (uint8_t)x2;
     }
   }
 }
 
+/* Registered as the DRIVER_DIRTY_AREA hook, UG_Update() reports each area it
+   repainted. The columns it covers go out with the next LCD_DrawDirty(). */
+static void LCD_DirtyArea(UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye)
+{
+  LCD_MarkDirty(xs, ys, xe, ye);
+}
+
+/* Fills a rectangle of the frame buffer with a given color (black or
+   white). Only the frame buffer changes, it is sent by the next present. */
+void FillRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, bool color)
+{
+  LCD_Raster(x1, y1, x2, y2, color ? LCD_ROP_SET : LCD_ROP_CLEAR, 0);
+  LCD_MarkDirty(x1, y1, x2, y2);
+}
+
+/* Inverts a rectangle of the frame buffer, e.g. to highlight a field */
+void InvertRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+{
+  LCD_Raster(x1, y1, x2, y2, LCD_ROP_XOR, 0xFF);
+  LCD_MarkDirty(x1, y1, x2, y2);
+}
+
+/* XORs a rectangle with a vertical pattern, bit n of pattern for row n of
+   each page (0x55 and 0xAA give alternate row stripes) */
+void XorRectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t pattern)
+{
+  LCD_Raster(x1, y1, x2, y2, LCD_ROP_XOR, pattern);
+  LCD_MarkDirty(x1, y1, x2, y2);
+}
+
 void ClearScreen(bool color)
 {
   FillRectangle(0, 0, LCD_WIDTH-1, LCD_HEIGHT-1, color);
@@ -425,9 +740,9 @@ void WriteCmd(uint8_t command)
   LCD_SetCSPin(GPIO_PIN_SET);
 }
 
-/* Select the whole RAM buffer in the LCD memory to write/update
-   the whole screen at once */
-void drawScreen(void)
+/* Selects the given columns of the given pages in the LCD memory, the data
+   that follows fills them in order */
+static void LCD_SetWindow(uint8_t firstPage, uint8_t lastPage, uint8_t firstColumn, uint8_t lastColumn)
 {
   WaitForSPI();
   
@@ -440,12 +755,12 @@ void drawScreen(void)
   {
   }
   WaitForSPI();
-  SPIx_PORT->DR = 0x00;
+  SPIx_PORT->DR = firstColumn;
   while(!(SPIx_PORT->SR & SPI_FLAG_TXE))
   {
   }
   WaitForSPI();
-  SPIx_PORT->DR = 0x7F;
+  SPIx_PORT->DR = lastColumn;
   while(!(SPIx_PORT->SR & SPI_FLAG_TXE))
   {
   }
@@ -455,18 +770,61 @@ void drawScreen(void)
   {
   }
   WaitForSPI();
-  SPIx_PORT->DR = 0x00;
+  SPIx_PORT->DR = firstPage;
   while(!(SPIx_PORT->SR & SPI_FLAG_TXE))
   {
   }
   WaitForSPI();
-  SPIx_PORT->DR = 0x1F;
+  SPIx_PORT->DR = lastPage;
 
   WaitForSPI();
 
   LCD_SetDCPin(GPIO_PIN_SET);
+}
+
+/* Select the whole RAM buffer in the LCD memory to write/update
+   the whole screen at once */
+void drawScreen(void)
+{
+  LCD_SetWindow(0x00, 0x1F, 0, LCD_WIDTH - 1);
 
+  TRACE_Event(TRACE_EVT_SPI_START, FRAME_BUFFER_SIZE);
   LCD_Transfer((uint16_t *)frameBuffer, FRAME_BUFFER_SIZE);
+  TRACE_Event(TRACE_EVT_SPI_DONE, 0);
+  dirtyPages = 0;
+}
+
+/* Sends only the columns marked in each page of dirtyPages. Runs of
+   adjacent pages that changed over the full width share one window. */
+static void LCD_DrawDirty(void)
+{
+  uint8_t first;
+  uint8_t last;
+  uint16_t length;
+
+  for (first = 0; first < LCD_PAGES; first = last + 1)
+  {
+    last = first;
+    if (!(dirtyPages & (1 << first)))
+    {
+      continue;
+    }
+    if (dirtyFirst[first] == 0 && dirtyLast[first] == LCD_WIDTH - 1)
+    {
+      while (last + 1 < LCD_PAGES && (dirtyPages & (1 << (last + 1))) &&
+             dirtyFirst[last + 1] == 0 && dirtyLast[last + 1] == LCD_WIDTH - 1)
+      {
+        last++;
+      }
+    }
+    length = (last - first) * LCD_WIDTH + dirtyLast[first] - dirtyFirst[first] + 1;
+
+    LCD_SetWindow(first, last, dirtyFirst[first], dirtyLast[first]);
+    TRACE_Event(TRACE_EVT_SPI_START, length);
+    LCD_Transfer((uint16_t *)&frameBuffer[first * LCD_WIDTH + dirtyFirst[first]], length);
+    TRACE_Event(TRACE_EVT_SPI_DONE, 0);
+  }
+  dirtyPages = 0;
 }
 
 void LCD_Transfer(uint16_t * SrcAddress, uint16_t DataLength)
@@ -484,6 +842,11 @@ void LCD_Transfer(uint16_t * SrcAddress, uint16_t DataLength)
 
 void LCD_Init(void)
 {
+  UG_Init(&lcdGui, LCD_PSet, LCD_WIDTH, LCD_HEIGHT);
+  UG_DriverRegister(DRIVER_FILL_FRAME, (void *)LCD_FillFrame);
+  UG_DriverRegister(DRIVER_DIRTY_AREA, (void *)LCD_DirtyArea);
+  UG_DriverRegister(DRIVER_PUT_CHAR, (void *)LCD_PutGlyph);
+
   LCD_Init_GPIO();
   LCD_SPI_Init();
   
@@ -506,15 +869,119 @@ void LCD_Init(void)
   LCD_SetCSPin(GPIO_PIN_SET);
   
   delay(10);
+  /* Whatever the panel RAM holds after reset goes with the first present */
   ClearScreen(0);
   
   delay(30);
 }
 
+/* Run length encodes one page into dst, in the format LCD_ApplyDelta()
+   takes. Writes at most LCD_WIDTH + 1 bytes, returns how many. */
+static uint16_t LCD_EncodePage(uint8_t *dst, const uint8_t *src)
+{
+  uint8_t *out = dst;
+  uint8_t *literal = NULL;
+  uint8_t i = 0;
+  uint8_t run;
+
+  while (i < LCD_WIDTH)
+  {
+    for (run = 1; i + run < LCD_WIDTH && src[i + run] == src[i]; run++)
+    {
+    }
+    if (run >= 3)
+    {
+      *out++ = 0x80 | (run - 1);
+      *out++ = src[i];
+      i += run;
+      literal = NULL;
+      continue;
+    }
+    /* Short runs go into a literal, a page never fills more than one */
+    if (literal == NULL)
+    {
+      literal = out++;
+      *literal = 0xFF;
+    }
+    (*literal)++;
+    *out++ = src[i++];
+  }
+  return (uint16_t)(out - dst);
+}
+
+/* Compresses as many of the remaining pages as are sure to fit, called
+   between a present and the next render so the pages match the panel. A
+   busy face may take several frames, each page is from a single frame. */
+static void LCD_CaptureShot(void)
+{
+  shotArmed = false;
+  shotLength = 0;
+  while (shotPage < LCD_PAGES && shotLength + LCD_WIDTH + 1 <= LCD_SHOT_SIZE)
+  {
+    shotLength += LCD_EncodePage(&shotBuffer[shotLength], &frameBuffer[shotPage * LCD_WIDTH]);
+    shotPage++;
+  }
+}
+
+/* Draws two zones of the world clock, one per line. With more than two
+   zones the page changes with the tens of seconds, every 10 s. */
+static void LCD_DrawWorld(void)
+{
+  RTC_TimeTypeDef time;
+  RTC_DateTypeDef date;
+  char line[LCD_WORLD_COLUMNS + 1];
+  uint8_t count = TZ_GetZoneCount();
+  uint8_t length;
+  uint8_t zone;
+  uint8_t i;
+
+  RTC_GetShownTime(&time, &date);
+  LCD_TextSetRows(2, 1);
+  zone = (uint8_t)(((time.Seconds >> 4) % ((count + 1) / 2)) * 2);
+
+  for (i = 0; i < 2; i++, zone++)
+  {
+    length = (zone < count) ? TZ_FormatZone(line, zone, &time) : 0;
+    /* Pad to the full width so nothing from the last page is left */
+    while (length < LCD_WORLD_COLUMNS)
+    {
+      line[length++] = ' ';
+    }
+    line[length] = 0;
+    LCD_TextPut(0, i, line, LCD_TEXT_NORMAL);
+  }
+  LCD_TextFlush();
+}
+
+/* Draws the time face, one line of text across the middle of the panel */
+static void LCD_DrawTime(void)
+{
+  uint8_t column;
+
+  LCD_TextSetRows(1, 9);
+  column = LCD_TextPut(0, 0, (char *)RTC_GetTime(), LCD_TEXT_NORMAL);
+  LCD_TextFill(column, 0, LCD_TEXT_COLUMNS - column, ' ', LCD_TEXT_NORMAL);
+  LCD_TextFlush();
+}
+
+/* Renders the face for the next second, RTC_Run() has already prepared the
+   text for it */
+static void LCD_Render(void)
+{
+  TRACE_Event(TRACE_EVT_RENDER_START, 0);
+  if (lcdFace == LCD_FACE_WORLD)
+  {
+    LCD_DrawWorld();
+  }
+  else
+  {
+    LCD_DrawTime();
+  }
+  TRACE_Event(TRACE_EVT_RENDER_END, 0);
+}
+
 void LCD_Run(void)
 {
-  static uint32_t lastScreenRefresh = 0;
-  
   if (firstTime)
   {
     LCD_SetCSPin(GPIO_PIN_RESET);
@@ -527,16 +994,306 @@ void LCD_Run(void)
     firstTime = false;
   }
   
-  if (HAL_GetTick() - lastScreenRefresh >= 100)
+  /* The host owns the frame buffer, nothing is rendered here */
+  if (lcdFace == LCD_FACE_REMOTE)
   {
-    LCD_Print((char *)RTC_GetTime(), 0, 9);
-    lastScreenRefresh = HAL_GetTick();
-    drawScreen();
+    if (presentDue)
+    {
+      LCD_DrawDirty();
+      TRACE_Event(TRACE_EVT_PRESENT, RTC_GetSubSeconds());
+      presentDue = false;
+    }
+    if (shotArmed && dirtyPages == 0)
+    {
+      LCD_CaptureShot();
+    }
+    return;
+  }
+  
+  /* Frames are rendered ahead of time and presented on the RTC update
+     boundary, so the panel changes together with the RTC instead of up to a
+     polling period plus a render later. */
+  if (RTC_UpdateDue())
+  {
+    /* The boundary came before the frame for it was rendered, render it
+       now rather than present the second that just ended again */
+    if (!frameReady)
+    {
+      LCD_Render();
+    }
+    /* Only the cells that changed for this second go out */
+    LCD_DrawDirty();
+    TRACE_Event(TRACE_EVT_PRESENT, RTC_GetSubSeconds());
+    frameReady = false;
+    if (shotArmed)
+    {
+      LCD_CaptureShot();
+    }
+  }
+  else if (!frameReady)
+  {
+    LCD_Render();
+    frameReady = true;
+  }
+}
+
+/* Sets the panel contrast, which is its brightness on an OLED */
+void LCD_SetBrightness(uint8_t level)
+{
+  WriteCmd(LCD_SETCONTRAST);
+  WriteCmd(level);
+}
+
+/* Returns the frame buffer for reading, one byte per 8 pixel column of a
+   page, LCD_WIDTH bytes per page */
+const uint8_t* LCD_GetFrameBuffer(uint16_t *size)
+{
+  *size = FRAME_BUFFER_SIZE;
+  return frameBuffer;
+}
+
+/* Selects what LCD_Run() draws from the next frame on. The remote face
+   starts from a blank frame buffer, which is what the host deltas against. */
+void LCD_SetFace(uint8_t face)
+{
+  lcdFace = face;
+  ClearScreen(0);
+  frameReady = false;
+  /* The next face sets up its own text layout */
+  textRows = 0;
+  presentDue = (face == LCD_FACE_REMOTE);
+}
+
+uint8_t LCD_GetFace(void)
+{
+  return lcdFace;
+}
+
+/**
+  * @brief  XORs a run length encoded delta into one page of the frame
+  *         buffer, for the remote face. Each run starts with a control
+  *         byte n: below 0x80 the next n + 1 bytes are literal, from 0x80
+  *         the next byte is repeated (n & 0x7F) + 1 times. Repeated zeros
+  *         leave their columns alone. The page is sent to the panel on the
+  *         next LCD_Present().
+  * @param  page : page of 8 pixel rows
+  * @param  column : first column the delta applies to
+  * @param  data : encoded delta
+  * @param  length : number of bytes in data
+  * @retval false if the delta is malformed or runs past the page, the
+  *         frame buffer is left unchanged then
+  */
+bool LCD_ApplyDelta(uint8_t page, uint8_t column, const uint8_t *data, uint16_t length)
+{
+  uint8_t *dst;
+  uint16_t end = column;
+  uint16_t i;
+  uint8_t count;
+
+  if (page >= LCD_PAGES || column >= LCD_WIDTH)
+  {
+    return false;
+  }
+
+  /* Walk the runs once without writing, a bad delta must not tear the page */
+  for (i = 0; i < length; )
+  {
+    count = (data[i] & 0x7F) + 1;
+    end += count;
+    i += (data[i] & 0x80) ? 2 : count + 1;
+  }
+  if (i != length || end > LCD_WIDTH)
+  {
+    return false;
+  }
+
+  dst = &frameBuffer[page * LCD_WIDTH + column];
+  for (i = 0; i < length; )
+  {
+    count = (data[i] & 0x7F) + 1;
+    if (data[i++] & 0x80)
+    {
+      if (data[i] == 0)
+      {
+        dst += count;
+      }
+      else
+      {
+        while (count--)
+        {
+          *dst++ ^= data[i];
+        }
+      }
+      i++;
+    }
+    else
+    {
+      while (count--)
+      {
+        *dst++ ^= data[i++];
+      }
+    }
+  }
+  LCD_MarkDirty(column, page * 8, end - 1, page * 8 + 7);
+  return true;
+}
+
+/* Sends the pages changed since the last call to the panel, from LCD_Run() */
+void LCD_Present(void)
+{
+  presentDue = true;
+}
+
+/* Starts a screenshot, the first pages are captured after the next present.
+   Returns false if one is already going on. */
+bool LCD_RequestShot(void)
+{
+  if (shotPage < LCD_PAGES)
+  {
+    return false;
+  }
+  shotPage = 0;
+  shotLength = 0;
+  shotArmed = true;
+  return true;
+}
+
+/**
+  * @brief  Returns the pages of a screenshot captured so far, run length
+  *         encoded one page after the other like LCD_ApplyDelta() takes
+  *         them. Call LCD_ReleaseShot() once they have been sent.
+  * @param  data : receives a pointer to the encoded pages
+  * @param  last : receives true if these are the last pages
+  * @retval Number of bytes, 0 while the capture is still pending
+  */
+uint16_t LCD_GetShot(const uint8_t **data, bool *last)
+{
+  *data = shotBuffer;
+  *last = (shotPage == LCD_PAGES);
+  return shotArmed ? 0 : shotLength;
+}
+
+/* Frees the scratch area, the remaining pages are captured after the next
+   present */
+void LCD_ReleaseShot(void)
+{
+  shotLength = 0;
+  if (shotPage < LCD_PAGES)
+  {
+    shotArmed = true;
   }
 }
 
 void LCD_Print(char *s, uint16_t x, uint16_t y)
 {
   PrintText(s, x, y, &FONT_8X14, C_WHITE, C_BLACK);
+  LCD_MarkDirty(x, y, LCD_WIDTH - 1, y + FONT_8X14.char_height - 1);
+}
+
+/**
+  * @brief  Lays the text grid out as rows of LCD_TEXT_FONT, 16 pixels apart.
+  *         A new layout starts from a blank screen with all cells blank,
+  *         the same layout again keeps the cells.
+  * @param  rows : rows in use, at most LCD_TEXT_ROWS
+  * @param  top : pixel row of the first text row
+  */
+void LCD_TextSetRows(uint8_t rows, uint8_t top)
+{
+  if (rows > LCD_TEXT_ROWS)
+  {
+    rows = LCD_TEXT_ROWS;
+  }
+  if (rows == textRows && top == textTop)
+  {
+    return;
+  }
+  textRows = rows;
+  textTop = top;
+
+  /* Blank cells match the cleared frame buffer, nothing to draw for them */
+  memset(textChars, ' ', sizeof(textChars));
+  memset(textAttrs, LCD_TEXT_NORMAL, sizeof(textAttrs));
+  memset(shownChars, ' ', sizeof(shownChars));
+  memset(shownAttrs, LCD_TEXT_NORMAL, sizeof(shownAttrs));
+  ClearScreen(0);
+}
+
+/* Writes a string into the grid from the given cell on, cut at the end of
+   the row. Returns the column after the last character written. */
+uint8_t LCD_TextPut(uint8_t column, uint8_t row, const char *s, uint8_t attr)
+{
+  if (row >= textRows)
+  {
+    return column;
+  }
+  for (; *s != 0 && column < LCD_TEXT_COLUMNS; s++, column++)
+  {
+    textChars[row][column] = *s;
+    textAttrs[row][column] = attr;
+  }
+  return column;
+}
+
+/* Sets count cells of a row from the given one on to the same character */
+void LCD_TextFill(uint8_t column, uint8_t row, uint8_t count, char c, uint8_t attr)
+{
+  if (row >= textRows)
+  {
+    return;
+  }
+  for (; count != 0 && column < LCD_TEXT_COLUMNS; count--, column++)
+  {
+    textChars[row][column] = c;
+    textAttrs[row][column] = attr;
+  }
+}
+
+/* Draws the cells whose character or attribute changed since they were last
+   drawn and marks their columns for the next present. Returns the number of
+   cells drawn. */
+uint8_t LCD_TextFlush(void)
+{
+  uint8_t row;
+  uint8_t column;
+  uint8_t attr;
+  uint8_t drawn = 0;
+  int16_t x;
+  int16_t y;
+  int16_t x2;
+  int16_t y2;
+
+  for (row = 0; row < textRows; row++)
+  {
+    for (column = 0; column < LCD_TEXT_COLUMNS; column++)
+    {
+      attr = textAttrs[row][column];
+      if (textChars[row][column] == shownChars[row][column] && attr == shownAttrs[row][column])
+      {
+        continue;
+      }
+      x = column * LCD_TEXT_PITCH;
+      y = textTop + row * LCD_TEXT_ROW_PITCH;
+      x2 = x + LCD_TEXT_PITCH - 1;
+      y2 = y + LCD_TEXT_FONT.char_height - 1;
+
+      /* The glyph covers all but the blank column on its right */
+      LCD_PutChar(textChars[row][column], x, y, &LCD_TEXT_FONT);
+      LCD_Raster(x2, y, x2, y2, LCD_ROP_CLEAR, 0);
+      if (attr & LCD_TEXT_UNDERLINE)
+      {
+        LCD_Raster(x, y2, x2, y2, LCD_ROP_SET, 0);
+      }
+      if (attr & LCD_TEXT_INVERT)
+      {
+        LCD_Raster(x, y, x2, y2, LCD_ROP_XOR, 0xFF);
+      }
+      LCD_MarkDirty(x, y, x2, y2);
+
+      shownChars[row][column] = textChars[row][column];
+      shownAttrs[row][column] = attr;
+      drawn++;
+    }
+  }
+  return drawn;
 }
 /************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
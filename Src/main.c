@@ -35,6 +35,13 @@
 /* Includes ------------------------------------------------------------------*/
 #include "lcd.h"
 #include "rtc.h"
+#include "uart.h"
+#include "trace.h"
+#include "alarm.h"
+#include "calib.h"
+#include "tz.h"
+#include "proto.h"
+#include "gps.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -69,13 +76,23 @@ int main(void)
   /* Configure the system clock to 2 MHz */
   SystemClock_Config();
   
+  UART_Init();
   RTC_Init();
+  CALIB_Init();
+  TZ_Init();
+  ALARM_Init();
   LCD_Init();
+  PROTO_Init();
+  GPS_Init();
   
   while (1)
   {
     RTC_Run();
+    ALARM_Run();
     LCD_Run();
+    PROTO_Run();
+    GPS_Run();
+    TRACE_Run();
   }
 }
 
@@ -0,0 +1,354 @@
+/**
+  ******************************************************************************
+  * @file    nmea.c
+  * @author  Louis Barrett
+  * @brief   Incremental NMEA 0183 time sentence parser
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "nmea.h"
+
+/* Private define ------------------------------------------------------------*/
+/* Parser states */
+#define NMEA_IDLE            0
+#define NMEA_ADDRESS         1
+#define NMEA_FIELDS          2
+#define NMEA_CHECK_HIGH      3
+#define NMEA_CHECK_LOW       4
+
+#define NMEA_TYPE(a, b, c)   (((uint32_t)(a) << 16) | ((uint32_t)(b) << 8) | (c))
+
+/* Index into bcd[] */
+#define NMEA_HOURS           0
+#define NMEA_MINUTES         1
+#define NMEA_SECONDS         2
+#define NMEA_DATE            3
+#define NMEA_MONTH           4
+#define NMEA_YEAR            5
+
+/* Bits of have, set once a field was complete and well formed */
+#define NMEA_HAVE_TIME       (1<<0)
+#define NMEA_HAVE_VALID      (1<<1)
+#define NMEA_HAVE_DATE       (1<<2)
+#define NMEA_HAVE_MONTH      (1<<3)
+#define NMEA_HAVE_YEAR       (1<<4)
+#define NMEA_HAVE_ALL        (NMEA_HAVE_TIME | NMEA_HAVE_DATE | NMEA_HAVE_MONTH | NMEA_HAVE_YEAR)
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Shifts a digit into a BCD field, a four digit year keeps its last two */
+static void NMEA_PutDigit(NMEA_Parser *parser, uint8_t index, uint8_t digit)
+{
+  parser->bcd[index] = (uint8_t)((parser->bcd[index] << 4) | digit);
+}
+
+/* Takes hhmmss[.sss] */
+static void NMEA_TimeChar(NMEA_Parser *parser, uint8_t c)
+{
+  uint8_t digit = c - '0';
+
+  if (parser->digits < 6 && digit <= 9)
+  {
+    NMEA_PutDigit(parser, NMEA_HOURS + (parser->digits >> 1), digit);
+  }
+  else if (parser->digits == 6 && c == '.')
+  {
+    parser->fraction = 0;
+  }
+  else if (parser->digits > 6 && digit <= 9)
+  {
+    if (parser->fraction < 3)
+    {
+      parser->ms = parser->ms * 10 + digit;
+      parser->fraction++;
+    }
+  }
+  else
+  {
+    parser->broken = 1;
+  }
+}
+
+/* Takes one character of a field, only the fields needed are looked at */
+static void NMEA_FieldChar(NMEA_Parser *parser, uint8_t c)
+{
+  uint8_t digit = c - '0';
+
+  if (parser->field == 1)
+  {
+    NMEA_TimeChar(parser, c);
+  }
+  else if (parser->sentence == NMEA_RMC && parser->field == 2)
+  {
+    /* Status, A for a valid fix and V for a receiver warning */
+    parser->broken |= (c != 'A');
+  }
+  else if (digit > 9)
+  {
+    parser->broken |= (parser->sentence == NMEA_RMC) ? (parser->field == 9) : (parser->field <= 4);
+  }
+  else if (parser->sentence == NMEA_RMC && parser->field == 9 && parser->digits < 6)
+  {
+    /* ddmmyy */
+    NMEA_PutDigit(parser, NMEA_DATE + (parser->digits >> 1), digit);
+  }
+  else if (parser->sentence == NMEA_ZDA && parser->field >= 2 && parser->field <= 4)
+  {
+    /* dd,mm,yyyy each in a field of its own */
+    NMEA_PutDigit(parser, NMEA_DATE + parser->field - 2, digit);
+  }
+  parser->digits++;
+}
+
+/* Records a field as complete at its ',' or '*' */
+static void NMEA_EndField(NMEA_Parser *parser)
+{
+  uint8_t have = 0;
+
+  if (parser->broken)
+  {
+    return;
+  }
+  if (parser->field == 1 && parser->digits >= 6)
+  {
+    have = NMEA_HAVE_TIME;
+  }
+  else if (parser->sentence == NMEA_RMC)
+  {
+    if (parser->field == 2 && parser->digits == 1)
+    {
+      have = NMEA_HAVE_VALID;
+    }
+    else if (parser->field == 9 && parser->digits == 6)
+    {
+      have = NMEA_HAVE_DATE | NMEA_HAVE_MONTH | NMEA_HAVE_YEAR;
+    }
+  }
+  else if (parser->field == 2 && parser->digits == 2)
+  {
+    have = NMEA_HAVE_DATE;
+  }
+  else if (parser->field == 3 && parser->digits == 2)
+  {
+    have = NMEA_HAVE_MONTH;
+  }
+  else if (parser->field == 4 && parser->digits == 4)
+  {
+    have = NMEA_HAVE_YEAR;
+  }
+  parser->have |= have;
+}
+
+/* Checks a sentence with a good checksum and hands out its time */
+static bool NMEA_Complete(NMEA_Parser *parser, NMEA_Fix *fix)
+{
+  const uint8_t *bcd = parser->bcd;
+  uint16_t ms = parser->ms;
+  uint8_t need = NMEA_HAVE_ALL;
+
+  if (parser->sentence == NMEA_RMC)
+  {
+    need |= NMEA_HAVE_VALID;
+  }
+  if ((parser->have & need) != need)
+  {
+    return false;
+  }
+  /* Leap seconds (ss = 60) cannot be set into the RTC */
+  if (bcd[NMEA_HOURS] > 0x23 || bcd[NMEA_MINUTES] > 0x59 || bcd[NMEA_SECONDS] > 0x59 ||
+      bcd[NMEA_DATE] == 0 || bcd[NMEA_DATE] > 0x31 || bcd[NMEA_MONTH] == 0 || bcd[NMEA_MONTH] > 0x12)
+  {
+    return false;
+  }
+
+  while (parser->fraction < 3)
+  {
+    ms *= 10;
+    parser->fraction++;
+  }
+
+  fix->hours = bcd[NMEA_HOURS];
+  fix->minutes = bcd[NMEA_MINUTES];
+  fix->seconds = bcd[NMEA_SECONDS];
+  fix->date = bcd[NMEA_DATE];
+  fix->month = bcd[NMEA_MONTH];
+  fix->year = bcd[NMEA_YEAR];
+  fix->sentence = parser->sentence;
+  fix->ms = ms;
+  return true;
+}
+
+static uint8_t NMEA_Hex(uint8_t c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  if (c >= 'A' && c <= 'F')
+  {
+    return c - 'A' + 10;
+  }
+  return 0xFF;
+}
+
+/* Runs the state machine on one character, true when a fix is complete */
+static bool NMEA_Char(NMEA_Parser *parser, uint8_t c, NMEA_Fix *fix)
+{
+  uint8_t value;
+
+  if (c == '$')
+  {
+    parser->state = NMEA_ADDRESS;
+    parser->checksum = 0;
+    parser->address = 0;
+    parser->digits = 0;
+    return false;
+  }
+
+  switch (parser->state)
+  {
+    case NMEA_ADDRESS:
+      parser->checksum ^= c;
+      if (c == ',')
+      {
+        switch (parser->address & 0xFFFFFF)
+        {
+          case NMEA_TYPE('R', 'M', 'C'): parser->sentence = NMEA_RMC; break;
+          case NMEA_TYPE('Z', 'D', 'A'): parser->sentence = NMEA_ZDA; break;
+          default:                       parser->sentence = NMEA_OTHER; break;
+        }
+        parser->state = NMEA_FIELDS;
+        parser->field = 1;
+        parser->digits = 0;
+        parser->broken = 0;
+        parser->have = 0;
+        parser->fraction = 0;
+        parser->ms = 0;
+      }
+      else if (c < 'A' || c > 'Z' || ++parser->digits > 5)
+      {
+        parser->state = NMEA_IDLE;
+      }
+      else
+      {
+        parser->address = (parser->address << 8) | c;
+      }
+      return false;
+
+    case NMEA_FIELDS:
+      if (c == '*')
+      {
+        NMEA_EndField(parser);
+        parser->state = NMEA_CHECK_HIGH;
+        return false;
+      }
+      if (c < 0x20 || c > 0x7E)
+      {
+        parser->state = NMEA_IDLE;
+        parser->bad++;
+        return false;
+      }
+      parser->checksum ^= c;
+      if (parser->sentence == NMEA_OTHER)
+      {
+        return false;
+      }
+      if (c == ',')
+      {
+        NMEA_EndField(parser);
+        parser->field++;
+        parser->digits = 0;
+        parser->broken = 0;
+        return false;
+      }
+      NMEA_FieldChar(parser, c);
+      return false;
+
+    case NMEA_CHECK_HIGH:
+      value = NMEA_Hex(c);
+      parser->expected = (uint8_t)(value << 4);
+      parser->state = (value > 0x0F) ? NMEA_IDLE : NMEA_CHECK_LOW;
+      if (value > 0x0F)
+      {
+        parser->bad++;
+      }
+      return false;
+
+    case NMEA_CHECK_LOW:
+      value = NMEA_Hex(c);
+      parser->state = NMEA_IDLE;
+      if (value > 0x0F || (parser->expected | value) != parser->checksum)
+      {
+        parser->bad++;
+        return false;
+      }
+      parser->good++;
+      return (parser->sentence != NMEA_OTHER) && NMEA_Complete(parser, fix);
+
+    default:
+      return false;
+  }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+void NMEA_Init(NMEA_Parser *parser)
+{
+  parser->state = NMEA_IDLE;
+  parser->good = 0;
+  parser->bad = 0;
+}
+
+/**
+  * @brief  Parses NMEA 0183 data in place, as it sits in the DMA ring.
+  *         Fields are converted character by character, so nothing is
+  *         copied into a line buffer and a sentence may be split across
+  *         any number of calls. Stops after the first valid time.
+  * @param  data : received bytes
+  * @param  length : number of bytes
+  * @param  used : receives the number of bytes consumed
+  * @param  fix : receives the time of a valid $--RMC or $--ZDA sentence
+  * @retval true if fix was filled in
+  */
+bool NMEA_Parse(NMEA_Parser *parser, const uint8_t *data, uint16_t length, uint16_t *used, NMEA_Fix *fix)
+{
+  uint16_t i;
+
+  for (i = 0; i < length; i++)
+  {
+    if (NMEA_Char(parser, data[i], fix))
+    {
+      *used = i + 1;
+      return true;
+    }
+  }
+  *used = length;
+  return false;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
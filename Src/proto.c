@@ -0,0 +1,519 @@
+/**
+  ******************************************************************************
+  * @file    proto.c
+  * @author  Louis Barrett
+  * @brief   Framed command protocol on the debug UART
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "proto.h"
+#include "uart.h"
+#include "lcd.h"
+#include "rtc.h"
+#include "tz.h"
+#include "calib.h"
+
+/* Private define ------------------------------------------------------------*/
+/* cmd, seq, status, payload and CRC */
+#define PROTO_MAX_FRAME      (3 + PROTO_MAX_PAYLOAD + 2)
+/* COBS adds one byte per 254 plus one, the two delimiters go around it */
+#define PROTO_MAX_ENCODED    (PROTO_MAX_FRAME + PROTO_MAX_FRAME / 254 + 1)
+
+/* Offsets beyond this many seconds do not fit the drift estimator */
+#define PROTO_MAX_SYNC_STEP  (24L * 3600)
+
+/* Private variables ---------------------------------------------------------*/
+/* Frame being received, still COBS encoded until its delimiter arrives */
+static uint8_t rxFrame[PROTO_MAX_ENCODED];
+static uint16_t rxLength = 0;
+static bool rxOverflow = false;
+/* Set while received bytes are left to look at */
+static bool rxPending = false;
+
+/* Reply being built, then its encoded form handed to the UART DMA */
+static uint8_t reply[PROTO_MAX_FRAME];
+static uint8_t txFrame[PROTO_MAX_ENCODED + 2];
+/* Length of an encoded reply still waiting for the UART */
+static uint16_t txLength = 0;
+
+/* Screenshot being sent, see PROTO_CMD_SCREENSHOT */
+static bool shotActive = false;
+static uint8_t shotSeq;
+static uint16_t shotOffset;
+/* Bytes of the pages LCD_GetShot() returns that are already sent */
+static uint16_t shotSent;
+
+static uint16_t framesGood = 0;
+static uint16_t framesBad = 0;
+static uint16_t framesDropped = 0;
+
+/* CRC-16/CCITT-FALSE, four bits at a time from a 32 byte table */
+static const uint16_t crcTable[16] =
+{
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+static uint16_t PROTO_Crc(const uint8_t *data, uint16_t length)
+{
+  uint16_t crc = 0xFFFF;
+
+  while (length--)
+  {
+    crc = (crc << 4) ^ crcTable[(crc >> 12) ^ (*data >> 4)];
+    crc = (crc << 4) ^ crcTable[(crc >> 12) ^ (*data & 0x0F)];
+    data++;
+  }
+  return crc;
+}
+
+static uint16_t PROTO_Get16(const uint8_t *p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t PROTO_Get32(const uint8_t *p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint8_t* PROTO_Put16(uint8_t *p, uint16_t value)
+{
+  *p++ = (uint8_t)value;
+  *p++ = (uint8_t)(value >> 8);
+  return p;
+}
+
+static uint8_t* PROTO_Put32(uint8_t *p, uint32_t value)
+{
+  p = PROTO_Put16(p, (uint16_t)value);
+  return PROTO_Put16(p, (uint16_t)(value >> 16));
+}
+
+/* Decodes a COBS frame in place, returns its length or 0 if malformed */
+static uint16_t PROTO_Decode(uint8_t *data, uint16_t length)
+{
+  uint16_t in = 0;
+  uint16_t out = 0;
+  uint8_t code;
+  uint8_t i;
+
+  while (in < length)
+  {
+    code = data[in++];
+    if (code == 0 || in + code - 1 > length)
+    {
+      return 0;
+    }
+    for (i = 1; i < code; i++)
+    {
+      data[out++] = data[in++];
+    }
+    /* A full block of 254 is not followed by an implied zero */
+    if (code != 0xFF && in < length)
+    {
+      data[out++] = 0;
+    }
+  }
+  return out;
+}
+
+/* COBS encodes the reply into txFrame between two delimiters */
+static uint16_t PROTO_Encode(const uint8_t *data, uint16_t length)
+{
+  uint8_t *out = txFrame;
+  uint8_t *code;
+  uint16_t i;
+
+  *out++ = 0;
+  code = out++;
+  *code = 1;
+  for (i = 0; i < length; i++)
+  {
+    if (data[i] == 0)
+    {
+      code = out++;
+      *code = 1;
+      continue;
+    }
+    *out++ = data[i];
+    if (++(*code) == 0xFF && i + 1 < length)
+    {
+      code = out++;
+      *code = 1;
+    }
+  }
+  *out++ = 0;
+  return (uint16_t)(out - txFrame);
+}
+
+/* Finishes the reply in reply[] with its CRC and starts sending it. The
+   UART was idle when the frame came in, so this only waits if the trace
+   took it in between. */
+static void PROTO_Send(uint16_t length)
+{
+  PROTO_Put16(&reply[length], PROTO_Crc(reply, length));
+  txLength = PROTO_Encode(reply, length + 2);
+  if (UART_Transmit(txFrame, txLength) == HAL_OK)
+  {
+    txLength = 0;
+  }
+}
+
+/* Sets the clock from a host reference and feeds the calibration */
+static uint8_t PROTO_SetTime(const uint8_t *payload, uint8_t *out)
+{
+  uint32_t reference = PROTO_Get32(payload);
+  uint16_t ms = PROTO_Get16(payload + 4);
+  uint16_t subSeconds;
+  uint32_t now = TZ_GetUTC(&subSeconds);
+  int32_t seconds = (int32_t)(now - reference);
+  int32_t offset = 0;
+
+  if (ms > 999)
+  {
+    return PROTO_ERR_RANGE;
+  }
+
+  if (seconds > -PROTO_MAX_SYNC_STEP && seconds < PROTO_MAX_SYNC_STEP)
+  {
+    offset = seconds * 1000 + ((subSeconds * 1000) >> 8) - ms;
+    CALIB_Sync(reference, offset);
+    CALIB_Stepped(-offset);
+  }
+  else
+  {
+    /* Far off, e.g. the first sync after a cold boot */
+    CALIB_Restart();
+  }
+  /* The calendar restarts at reference.000, the host is already at .ms */
+  TZ_SetUTC(reference);
+  RTC_ShiftMs((int16_t)ms);
+
+  PROTO_Put32(out, (uint32_t)offset);
+  return PROTO_OK;
+}
+
+/* Sends the next part of a screenshot once the LCD has captured it */
+static void PROTO_SendShot(void)
+{
+  const uint8_t *data;
+  uint8_t *out = &reply[3];
+  uint16_t length;
+  uint16_t chunk;
+  bool last;
+
+  length = LCD_GetShot(&data, &last);
+  if (length == 0)
+  {
+    return;
+  }
+
+  chunk = length - shotSent;
+  if (chunk > PROTO_SHOT_CHUNK)
+  {
+    chunk = PROTO_SHOT_CHUNK;
+  }
+  last = last && (shotSent + chunk == length);
+
+  reply[0] = PROTO_CMD_SCREENSHOT | PROTO_RESPONSE;
+  reply[1] = shotSeq;
+  reply[2] = PROTO_OK;
+  out = PROTO_Put16(out, shotOffset);
+  *out++ = last;
+  data += shotSent;
+  shotSent += chunk;
+  shotOffset += chunk;
+  while (chunk--)
+  {
+    *out++ = *data++;
+  }
+  PROTO_Send((uint16_t)(out - reply));
+
+  if (shotSent == length)
+  {
+    /* The pages are copied into txFrame, the LCD may capture the next ones */
+    shotSent = 0;
+    shotActive = !last;
+    LCD_ReleaseShot();
+  }
+}
+
+/**
+  * @brief  Handles one decoded frame and sends the reply.
+  * @param  frame : cmd, seq and payload, the CRC already checked
+  * @param  length : payload length
+  * @retval None
+  */
+static void PROTO_Dispatch(const uint8_t *frame, uint16_t length)
+{
+  const uint8_t *payload = &frame[2];
+  const uint8_t *fb;
+  uint8_t *out = &reply[3];
+  uint8_t status = PROTO_OK;
+  uint16_t fbSize;
+  uint16_t offset;
+  uint16_t subSeconds;
+
+  reply[0] = frame[0] | PROTO_RESPONSE;
+  reply[1] = frame[1];
+
+  switch (frame[0])
+  {
+    case PROTO_CMD_SET_TIME:
+      if (length != 6)
+      {
+        status = PROTO_ERR_LENGTH;
+        break;
+      }
+      status = PROTO_SetTime(payload, out);
+      if (status == PROTO_OK)
+      {
+        out += 4;
+      }
+      break;
+
+    case PROTO_CMD_GET_STATS:
+      /* u32 UTC, u16 subseconds, u32 uptime ms, i16 calibration pulses,
+         u16 good, bad and dropped frames */
+      out = PROTO_Put32(out, TZ_GetUTC(&subSeconds));
+      out = PROTO_Put16(out, subSeconds);
+      out = PROTO_Put32(out, HAL_GetTick());
+      out = PROTO_Put16(out, (uint16_t)CALIB_GetPulses());
+      out = PROTO_Put16(out, framesGood);
+      out = PROTO_Put16(out, framesBad);
+      out = PROTO_Put16(out, framesDropped);
+      break;
+
+    case PROTO_CMD_SET_BRIGHTNESS:
+      if (length != 1)
+      {
+        status = PROTO_ERR_LENGTH;
+        break;
+      }
+      LCD_SetBrightness(payload[0]);
+      break;
+
+    case PROTO_CMD_READ_FB:
+      if (length != 3)
+      {
+        status = PROTO_ERR_LENGTH;
+        break;
+      }
+      fb = LCD_GetFrameBuffer(&fbSize);
+      offset = PROTO_Get16(payload);
+      length = payload[2];
+      if (length > PROTO_MAX_PAYLOAD - 2 || offset + length > fbSize)
+      {
+        status = PROTO_ERR_RANGE;
+        break;
+      }
+      out = PROTO_Put16(out, offset);
+      while (length--)
+      {
+        *out++ = fb[offset++];
+      }
+      break;
+
+    case PROTO_CMD_SET_FACE:
+      if (length != 1)
+      {
+        status = PROTO_ERR_LENGTH;
+        break;
+      }
+      if (payload[0] > LCD_FACE_REMOTE)
+      {
+        status = PROTO_ERR_RANGE;
+        break;
+      }
+      LCD_SetFace(payload[0]);
+      break;
+
+    case PROTO_CMD_FB_DELTA:
+      if (length < 2)
+      {
+        status = PROTO_ERR_LENGTH;
+        break;
+      }
+      if (LCD_GetFace() != LCD_FACE_REMOTE)
+      {
+        status = PROTO_ERR_STATE;
+        break;
+      }
+      if (!LCD_ApplyDelta(payload[0] & ~PROTO_FB_PRESENT, payload[1], &payload[2], length - 2))
+      {
+        status = PROTO_ERR_RANGE;
+        break;
+      }
+      if (payload[0] & PROTO_FB_PRESENT)
+      {
+        LCD_Present();
+      }
+      break;
+
+    case PROTO_CMD_SCREENSHOT:
+      if (length != 0)
+      {
+        status = PROTO_ERR_LENGTH;
+        break;
+      }
+      if (shotActive || !LCD_RequestShot())
+      {
+        status = PROTO_ERR_STATE;
+        break;
+      }
+      /* Answered by PROTO_SendShot() after the next present */
+      shotActive = true;
+      shotSeq = frame[1];
+      shotOffset = 0;
+      shotSent = 0;
+      return;
+
+    default:
+      status = PROTO_ERR_COMMAND;
+      break;
+  }
+
+  reply[2] = status;
+  if (status != PROTO_OK)
+  {
+    out = &reply[3];
+  }
+  PROTO_Send((uint16_t)(out - reply));
+}
+
+/* Called at every delimiter */
+static void PROTO_Frame(void)
+{
+  uint16_t length;
+
+  if (rxOverflow)
+  {
+    rxOverflow = false;
+    rxLength = 0;
+    framesDropped++;
+    return;
+  }
+  if (rxLength == 0)
+  {
+    return;
+  }
+
+  length = PROTO_Decode(rxFrame, rxLength);
+  rxLength = 0;
+  if (length < 4 || PROTO_Crc(rxFrame, length - 2) != PROTO_Get16(&rxFrame[length - 2]))
+  {
+    framesBad++;
+    return;
+  }
+  framesGood++;
+  PROTO_Dispatch(rxFrame, length - 4);
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+void PROTO_Init(void)
+{
+  rxLength = 0;
+  rxOverflow = false;
+  rxPending = false;
+  txLength = 0;
+  shotActive = false;
+}
+
+/**
+  * @brief  Parses received bytes straight from the UART DMA ring, call from
+  *         the main loop. Nothing is done until the line goes idle or the
+  *         ring is half full. Replies go out by DMA, a frame is left in the
+  *         ring until the UART is free for its reply.
+  * @param  None
+  * @retval None
+  */
+void PROTO_Run(void)
+{
+  const uint8_t *data;
+  uint16_t count;
+  uint16_t i;
+
+  /* A reply held back by a trace transfer goes first */
+  if (txLength != 0)
+  {
+    if (UART_TxBusy() || UART_Transmit(txFrame, txLength) != HAL_OK)
+    {
+      return;
+    }
+    txLength = 0;
+  }
+
+  if (shotActive && !UART_TxBusy())
+  {
+    PROTO_SendShot();
+  }
+
+  if (UART_RxEvent())
+  {
+    rxPending = true;
+  }
+  if (!rxPending)
+  {
+    return;
+  }
+
+  while ((count = UART_RxPeek(&data)) != 0)
+  {
+    for (i = 0; i < count; i++)
+    {
+      if (data[i] != 0)
+      {
+        if (rxLength < sizeof(rxFrame))
+        {
+          rxFrame[rxLength++] = data[i];
+        }
+        else
+        {
+          rxOverflow = true;
+        }
+        continue;
+      }
+
+      /* txFrame may still be on the wire, come back for this frame later */
+      if (rxLength != 0 && UART_TxBusy())
+      {
+        UART_RxConsume(i);
+        return;
+      }
+      PROTO_Frame();
+    }
+    UART_RxConsume(count);
+  }
+  rxPending = false;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file    raster.c
+  * @author  Louis Barrett
+  * @brief   Raster operations on a page organised monochrome frame buffer
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "raster.h"
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Applies (old & keep) ^ flip to count bytes of one page. Once the pointer
+   is word aligned four columns go per store. */
+static void RASTER_Span(uint8_t *p, uint16_t count, uint8_t keep, uint8_t flip)
+{
+  uint32_t keep32 = keep * 0x01010101UL;
+  uint32_t flip32 = flip * 0x01010101UL;
+  uint32_t *word;
+
+  for (; count != 0 && ((uintptr_t)p & 3) != 0; count--, p++)
+  {
+    *p = (*p & keep) ^ flip;
+  }
+
+  word = (uint32_t *)p;
+  if (keep == 0)
+  {
+    /* Whole page bytes are set or cleared without reading them */
+    for (; count >= 4; count -= 4)
+    {
+      *word++ = flip32;
+    }
+  }
+  else
+  {
+    for (; count >= 4; count -= 4)
+    {
+      *word = (*word & keep32) ^ flip32;
+      word++;
+    }
+  }
+
+  for (p = (uint8_t *)word; count != 0; count--, p++)
+  {
+    *p = (*p & keep) ^ flip;
+  }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Applies a raster operation to a rectangle of a frame buffer,
+  *         one span per page with the rows outside it masked off at the top
+  *         and bottom page. The rectangle is clipped to the panel and its
+  *         corners may come in either order.
+  * @param  frame : frame buffer, RASTER_WIDTH bytes per page
+  * @param  x1, y1 : one corner
+  * @param  x2, y2 : the opposite corner, inclusive
+  * @param  rop : RASTER_ROP_CLEAR, RASTER_ROP_SET or RASTER_ROP_XOR
+  * @param  pattern : for RASTER_ROP_XOR, the rows of each page to flip
+  * @retval None
+  */
+void RASTER_Apply(uint8_t *frame, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t rop, uint8_t pattern)
+{
+  int16_t swap;
+  int16_t page;
+  uint8_t top;
+  uint8_t bottom;
+  uint8_t mask;
+
+  if (x2 < x1)
+  {
+    swap = x2;
+    x2 = x1;
+    x1 = swap;
+  }
+  if (y2 < y1)
+  {
+    swap = y2;
+    y2 = y1;
+    y1 = swap;
+  }
+  x1 = (x1 < 0) ? 0 : x1;
+  y1 = (y1 < 0) ? 0 : y1;
+  x2 = (x2 >= RASTER_WIDTH) ? RASTER_WIDTH - 1 : x2;
+  y2 = (y2 >= RASTER_HEIGHT) ? RASTER_HEIGHT - 1 : y2;
+  if (x1 > x2 || y1 > y2)
+  {
+    return;
+  }
+
+  for (page = y1 >> 3; page <= (y2 >> 3); page++)
+  {
+    top = (page == (y1 >> 3)) ? (y1 & 7) : 0;
+    bottom = (page == (y2 >> 3)) ? (y2 & 7) : 7;
+    mask = (uint8_t)((0xFF << top) & (0xFF >> (7 - bottom)));
+
+    switch (rop)
+    {
+      case RASTER_ROP_SET:
+        RASTER_Span(&frame[page * RASTER_WIDTH + x1], x2 - x1 + 1, (uint8_t)~mask, mask);
+        break;
+      case RASTER_ROP_XOR:
+        RASTER_Span(&frame[page * RASTER_WIDTH + x1], x2 - x1 + 1, 0xFF, pattern & mask);
+        break;
+      default:
+        RASTER_Span(&frame[page * RASTER_WIDTH + x1], x2 - x1 + 1, (uint8_t)~mask, 0);
+        break;
+    }
+  }
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
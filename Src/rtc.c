@@ -32,6 +32,9 @@
   */
   
 #include "rtc.h"
+#include "trace.h"
+#include "epoch.h"
+#include <stdbool.h>
 
 /* Private variables ---------------------------------------------------------*/
 /* RTC handler declaration */
@@ -40,6 +43,46 @@ RTC_HandleTypeDef RtcHandle;
 /* Buffer used for displaying Time */
 uint8_t aShowTime[50] = {0};
 
+/* Set when the RTC kept running through the last reset */
+static bool rtcWarmBoot = false;
+
+/* Set by the wakeup or alarm B interrupt whenever the display is due */
+static volatile bool rtcUpdateDue = false;
+/* Set by the same interrupts for RTC_Run() to look for rollovers */
+static volatile bool rtcRolloverDue = false;
+/* How often the display changes, see RTC_UPDATE_* in rtc.h */
+static uint8_t updateRate = RTC_UPDATE_SECOND;
+/* Set once aShowTime has been shown and the next second must be prepared */
+static bool showTimeStale = true;
+
+/* Layout used by RTC_Run() to fill aShowTime, see RTC_SHOW_* in rtc.h */
+static uint8_t showLayout = RTC_SHOW_SECONDS;
+
+/* The BCD time and date aShowTime was formatted from */
+static RTC_TimeTypeDef showTime;
+static RTC_DateTypeDef showDate;
+
+/* Rollover subscribers and the calendar they were last told about */
+static struct
+{
+  uint8_t events;
+  RTC_RolloverHandler handler;
+} subscribers[RTC_MAX_SUBSCRIBERS];
+static uint8_t subscriberCount = 0;
+static RTC_TimeTypeDef lastTime;
+static RTC_DateTypeDef lastDate;
+static bool lastValid = false;
+
+/* 24h BCD hour (as binary index) to 12h BCD hour */
+static const uint8_t hour12[24] =
+{
+  0x12, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+  0x12, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11
+};
+
+/* Three letter weekday names, RTC_WEEKDAY_MONDAY (1) to RTC_WEEKDAY_SUNDAY (7) */
+static const char weekdayNames[] = "MonTueWedThuFriSatSun";
+
 /* Private define ------------------------------------------------------------*/
 
 //Defines for LSI clock source
@@ -48,9 +91,139 @@ uint8_t aShowTime[50] = {0};
 
 #define WAKEUP_TIMER_ENABLE 0x32F2
 
+/* RTC_UPDATE_FAST period: 256 ticks of RTCCLK/16 (2048 Hz) = 1/8 s */
+#define FAST_WAKEUP_COUNT   (256 - 1)
+
+/* Written to RTC_BKP_DR0 once the calendar has been set */
+#define CALENDAR_VALID      0x5A3C
+
 /* Private function prototypes -----------------------------------------------*/\
 /* Private functions ---------------------------------------------------------*/
 
+/* Checks whether the backup domain survived the reset with the RTC running
+   from the LSE and a calendar that was set by us. Backup access must be
+   enabled before calling. */
+static bool RTC_IsConfigured(void)
+{
+  if ((RCC->CSR & RCC_CSR_RTCEN) == 0)
+  {
+    return false;
+  }
+  if (__HAL_RCC_GET_RTC_SOURCE() != RCC_RTCCLKSOURCE_LSE)
+  {
+    return false;
+  }
+  if (__HAL_RCC_GET_FLAG(RCC_FLAG_LSERDY) == RESET)
+  {
+    return false;
+  }
+  if ((RTC->ISR & RTC_ISR_INITS) == 0)
+  {
+    return false;
+  }
+  return (RTC->BKP0R == CALENDAR_VALID);
+}
+
+/* Writes a packed BCD byte as two ASCII digits */
+static char* RTC_PutBCD(char *p, uint8_t bcd)
+{
+  *p++ = '0' + (bcd >> 4);
+  *p++ = '0' + (bcd & 0x0F);
+  return p;
+}
+
+/* Increments a packed BCD byte */
+static uint8_t RTC_BCDInc(uint8_t bcd)
+{
+  bcd++;
+  if ((bcd & 0x0F) == 0x0A)
+  {
+    bcd += 0x06;
+  }
+  return bcd;
+}
+
+/* Compares the calendar with the one seen at the last wakeup and calls the
+   subscribers of every field that changed. Each subscriber is only called
+   for the fields it asked for, so minute work runs once a minute. */
+static void RTC_Publish(void)
+{
+  RTC_TimeTypeDef time;
+  RTC_DateTypeDef date;
+  uint8_t events = 0;
+  uint8_t i;
+
+  RTC_ReadCalendar(&time, &date);
+
+  if (lastValid)
+  {
+    events |= (time.Seconds != lastTime.Seconds) ? RTC_ROLL_SECOND : 0;
+    events |= (time.Minutes != lastTime.Minutes) ? RTC_ROLL_MINUTE : 0;
+    events |= (time.Hours != lastTime.Hours) ? RTC_ROLL_HOUR : 0;
+    events |= (date.Date != lastDate.Date) ? RTC_ROLL_DAY : 0;
+    events |= (date.Month != lastDate.Month) ? RTC_ROLL_MONTH : 0;
+    events |= (date.Year != lastDate.Year) ? RTC_ROLL_YEAR : 0;
+  }
+  lastTime = time;
+  lastDate = date;
+  lastValid = true;
+
+  for (i = 0; i < subscriberCount && events != 0; i++)
+  {
+    if (subscribers[i].events & events)
+    {
+      subscribers[i].handler(events, &time, &date);
+    }
+  }
+}
+
+/* Advances a BCD time and date by one second, carrying into the date */
+static void RTC_AddSecond(RTC_TimeTypeDef *time, RTC_DateTypeDef *date)
+{
+  uint8_t month;
+  uint8_t last;
+
+  time->Seconds = RTC_BCDInc(time->Seconds);
+  if (time->Seconds != 0x60)
+  {
+    return;
+  }
+  time->Seconds = 0x00;
+
+  time->Minutes = RTC_BCDInc(time->Minutes);
+  if (time->Minutes != 0x60)
+  {
+    return;
+  }
+  time->Minutes = 0x00;
+
+  time->Hours = RTC_BCDInc(time->Hours);
+  if (time->Hours != 0x24)
+  {
+    return;
+  }
+  time->Hours = 0x00;
+
+  date->WeekDay = (date->WeekDay == RTC_WEEKDAY_SUNDAY) ? RTC_WEEKDAY_MONDAY : date->WeekDay + 1;
+
+  month = RTC_Bcd2ToByte(date->Month);
+  last = EPOCH_MonthDays(RTC_Bcd2ToByte(date->Year), month);
+  if (RTC_Bcd2ToByte(date->Date) < last)
+  {
+    date->Date = RTC_BCDInc(date->Date);
+    return;
+  }
+  date->Date = 0x01;
+
+  if (date->Month != 0x12)
+  {
+    date->Month = RTC_BCDInc(date->Month);
+    return;
+  }
+  date->Month = RTC_MONTH_JANUARY;
+  date->Year = (date->Year == 0x99) ? 0x00 : RTC_BCDInc(date->Year);
+}
+
 void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc)
 {
   RCC_OscInitTypeDef        RCC_OscInitStruct;
@@ -67,18 +240,23 @@ void HAL_RTC_MspInit(RTC_HandleTypeDef *hrtc)
   __HAL_RCC_PWR_CLK_ENABLE();
   HAL_PWR_EnableBkUpAccess();
 	
-	__HAL_RCC_BACKUPRESET_FORCE();
-	__HAL_RCC_BACKUPRESET_RELEASE();
-  
-  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
-  RCC_OscInitStruct.LSIState = RCC_LSI_OFF;
-  RCC_OscInitStruct.LSEState = RCC_LSE_ON;
-  HAL_RCC_OscConfig(&RCC_OscInitStruct);
+  /* On a warm boot the LSE is still running and selected, resetting the
+     backup domain would lose the time and restart the slow LSE start-up */
+  if (!rtcWarmBoot)
+  {
+    __HAL_RCC_BACKUPRESET_FORCE();
+    __HAL_RCC_BACKUPRESET_RELEASE();
+    
+    RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_LSE;
+    RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
+    RCC_OscInitStruct.LSIState = RCC_LSI_OFF;
+    RCC_OscInitStruct.LSEState = RCC_LSE_ON;
+    HAL_RCC_OscConfig(&RCC_OscInitStruct);
 
-  PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
-  PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
-  HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
+    PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_RTC;
+    PeriphClkInitStruct.RTCClockSelection = RCC_RTCCLKSOURCE_LSE;
+    HAL_RCCEx_PeriphCLKConfig(&PeriphClkInitStruct);
+  }
   
   /*##-2- Enable RTC peripheral Clocks #######################################*/ 
   /* Enable RTC Clock */ 
@@ -94,7 +272,6 @@ void RTC_Init(void)
 {
   RTC_DateTypeDef  sdatestructure;
   RTC_TimeTypeDef  stimestructure;
-  RTC_AlarmTypeDef salarmstructure;
   
   RtcHandle.Instance = RTC;
 
@@ -115,7 +292,25 @@ void RTC_Init(void)
   RtcHandle.Init.OutPutPolarity = RTC_OUTPUT_POLARITY_HIGH;
   RtcHandle.Init.OutPutType     = RTC_OUTPUT_TYPE_OPENDRAIN;
   
-  HAL_RTC_Init(&RtcHandle);
+  /*##-1- Check whether the RTC survived the reset ############################*/
+  __HAL_RCC_PWR_CLK_ENABLE();
+  HAL_PWR_EnableBkUpAccess();
+  rtcWarmBoot = RTC_IsConfigured();
+  
+  if (rtcWarmBoot)
+  {
+    /* HAL_RTC_Init() would enter init mode and stop the calendar, so only
+       redo the clock/NVIC part and mark the handle as ready */
+    HAL_RTC_MspInit(&RtcHandle);
+    RtcHandle.State = HAL_RTC_STATE_READY;
+  }
+  else
+  {
+    HAL_RTC_Init(&RtcHandle);
+  }
+  
+  /* Read the calendar registers directly, see RTC_ReadCalendar() */
+  HAL_RTCEx_EnableBypassShadow(&RtcHandle);
 	
 	/*##-2- Check if data stored in BackUp register1: Wakeup timer enable #######*/
   /* Read the Back Up Register 1 Data */
@@ -129,14 +324,18 @@ void RTC_Init(void)
   }
   
   /*##-3- Configure the RTC Wakeup peripheral #################################*/
-  /* Setting the Wakeup time to 1 s
-       If RTC_WAKEUPCLOCK_CK_SPRE_16BITS is selected, the frequency is 1Hz, 
-       this allows to get a wakeup time equal to 1 s if the counter is 0x0 */
-  HAL_RTCEx_SetWakeUpTimer_IT(&RtcHandle, 0x0, RTC_WAKEUPCLOCK_CK_SPRE_16BITS);
+  /* Wake up as often as the display changes, 1 s by default */
+  RTC_SetUpdateRate(updateRate);
   
   /*##-4- Write 'wakeup timer enabled' tag in RTC Backup data Register 1 #######*/
   HAL_RTCEx_BKUPWrite(&RtcHandle, RTC_BKP_DR1, WAKEUP_TIMER_ENABLE);
   
+  /* The calendar is still valid, keep the time we have */
+  if (rtcWarmBoot)
+  {
+    return;
+  }
+  
   /* Begin setting the date and time */
   sdatestructure.Year = 0x14;
   sdatestructure.Month = RTC_MONTH_FEBRUARY;
@@ -154,21 +353,109 @@ void RTC_Init(void)
   stimestructure.StoreOperation = RTC_STOREOPERATION_RESET;
   
   HAL_RTC_SetTime(&RtcHandle,&stimestructure,RTC_FORMAT_BCD);
-
-  /* Set Alarm to 02:20:30 
-     RTC Alarm Generation: Alarm on Hours, Minutes and Seconds */
-  salarmstructure.Alarm = RTC_ALARM_A;
-  salarmstructure.AlarmDateWeekDay = RTC_WEEKDAY_MONDAY;
-  salarmstructure.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_WEEKDAY;
-  salarmstructure.AlarmMask = RTC_ALARMMASK_DATEWEEKDAY;
-  salarmstructure.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_NONE;
-  salarmstructure.AlarmTime.TimeFormat = RTC_HOURFORMAT12_AM;
-  salarmstructure.AlarmTime.Hours = 0x02;
-  salarmstructure.AlarmTime.Minutes = 0x20;
-  salarmstructure.AlarmTime.Seconds = 0x30;
-  salarmstructure.AlarmTime.SubSeconds = 0x56;
   
-  //HAL_RTC_SetAlarm_IT(&RtcHandle,&salarmstructure,RTC_FORMAT_BCD);
+  /* Mark the calendar as set so the next reset keeps it */
+  HAL_RTCEx_BKUPWrite(&RtcHandle, RTC_BKP_DR0, CALENDAR_VALID);
+}
+
+/**
+  * @brief  Selects how often the RTC interrupts to update the display.
+  *         RTC_UPDATE_SECOND uses the wakeup timer on ck_spre, the same 1 Hz
+  *         clock that advances the calendar, so it fires on the boundary.
+  *         RTC_UPDATE_MINUTE stops the wakeup timer and uses alarm B on
+  *         ss == 00 instead, which is 60 times fewer wakeups per hour.
+  *         RTC_UPDATE_FAST runs the wakeup timer from RTCCLK/16 at 8 Hz.
+  * @param  rate : one of RTC_UPDATE_*
+  * @retval None
+  */
+void RTC_SetUpdateRate(uint8_t rate)
+{
+  RTC_AlarmTypeDef salarmstructure = {0};
+
+  if (RtcHandle.Instance->CR & RTC_CR_WUTE)
+  {
+    HAL_RTCEx_DeactivateWakeUpTimer(&RtcHandle);
+  }
+  if (RtcHandle.Instance->CR & RTC_CR_ALRBE)
+  {
+    HAL_RTC_DeactivateAlarm(&RtcHandle, RTC_ALARM_B);
+  }
+
+  switch (rate)
+  {
+    case RTC_UPDATE_FAST:
+      HAL_RTCEx_SetWakeUpTimer_IT(&RtcHandle, FAST_WAKEUP_COUNT, RTC_WAKEUPCLOCK_RTCCLK_DIV16);
+      break;
+    case RTC_UPDATE_MINUTE:
+      /* Match the seconds only: fires when the calendar reaches hh:mm:00 */
+      salarmstructure.Alarm = RTC_ALARM_B;
+      salarmstructure.AlarmDateWeekDay = RTC_WEEKDAY_MONDAY;
+      salarmstructure.AlarmDateWeekDaySel = RTC_ALARMDATEWEEKDAYSEL_WEEKDAY;
+      salarmstructure.AlarmMask = RTC_ALARMMASK_DATEWEEKDAY | RTC_ALARMMASK_HOURS | RTC_ALARMMASK_MINUTES;
+      salarmstructure.AlarmSubSecondMask = RTC_ALARMSUBSECONDMASK_ALL;
+      salarmstructure.AlarmTime.TimeFormat = RTC_HOURFORMAT12_AM;
+      salarmstructure.AlarmTime.Seconds = 0x00;
+      HAL_RTC_SetAlarm_IT(&RtcHandle, &salarmstructure, RTC_FORMAT_BCD);
+      break;
+    default:
+      rate = RTC_UPDATE_SECOND;
+      HAL_RTCEx_SetWakeUpTimer_IT(&RtcHandle, 0x0, RTC_WAKEUPCLOCK_CK_SPRE_16BITS);
+      break;
+  }
+
+  updateRate = rate;
+  showTimeStale = true;
+}
+
+/* Called from RTC_IRQHandler once per wakeup timer period */
+void HAL_RTCEx_WakeUpTimerEventCallback(RTC_HandleTypeDef *hrtc)
+{
+  rtcUpdateDue = true;
+  rtcRolloverDue = true;
+  TRACE_Event(TRACE_EVT_RTC_WAKEUP, 0);
+}
+
+/* Called from RTC_IRQHandler on every minute boundary in RTC_UPDATE_MINUTE */
+void HAL_RTCEx_AlarmBEventCallback(RTC_HandleTypeDef *hrtc)
+{
+  rtcUpdateDue = true;
+  rtcRolloverDue = true;
+  TRACE_Event(TRACE_EVT_RTC_WAKEUP, 1);
+}
+
+/* Returns true once per display update boundary. The text in aShowTime
+   belongs to the period that just started, so RTC_Run() prepares the next. */
+bool RTC_UpdateDue(void)
+{
+  if (!rtcUpdateDue)
+  {
+    return false;
+  }
+  rtcUpdateDue = false;
+  showTimeStale = true;
+  return true;
+}
+
+/* Returns the time elapsed since the last second boundary in 1/256 s */
+uint16_t RTC_GetSubSeconds(void)
+{
+  /* With BYPSHAD set this does not lock the shadow registers */
+  uint16_t ssr = (uint16_t)RTC->SSR;
+  uint16_t prediv = (uint16_t)RtcHandle.Init.SynchPrediv;
+
+  /* Until the second an ADD1S shift added has passed, SSR counts down from
+     above PREDIV_S and the time is still in the second before */
+  if (ssr > prediv)
+  {
+    ssr -= prediv + 1;
+  }
+  return prediv - ssr;
+}
+
+/* Returns true if the time was kept across the last reset */
+bool RTC_IsWarmBoot(void)
+{
+  return rtcWarmBoot;
 }
 
 RTC_HandleTypeDef* RTC_GetHandle(void)
@@ -177,21 +464,376 @@ RTC_HandleTypeDef* RTC_GetHandle(void)
 }
 
 /**
-  * @brief  Display the current time.
-  * @param  showtime : pointer to buffer
+  * @brief  Converts a BCD time and date to seconds since 2000-01-01 00:00:00,
+  *         see EPOCH_FromCalendar()
+  * @param  time : 24 hour time in BCD format
+  * @param  date : date in BCD format, 2000-2099
+  * @retval Seconds since the epoch
+  */
+uint32_t RTC_ToEpoch(const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date)
+{
+  EPOCH_Calendar calendar;
+
+  calendar.year = date->Year;
+  calendar.month = date->Month;
+  calendar.date = date->Date;
+  calendar.hours = time->Hours;
+  calendar.minutes = time->Minutes;
+  calendar.seconds = time->Seconds;
+  return EPOCH_FromCalendar(&calendar);
+}
+
+/**
+  * @brief  Converts seconds since 2000-01-01 00:00:00 to a BCD time and date,
+  *         see EPOCH_ToCalendar()
+  * @param  seconds : seconds since the epoch, up to the end of 2099
+  * @param  time : 24 hour time in BCD format, SubSeconds is left alone
+  * @param  date : date in BCD format, including the weekday
+  * @retval None
+  */
+void RTC_FromEpoch(uint32_t seconds, RTC_TimeTypeDef *time, RTC_DateTypeDef *date)
+{
+  EPOCH_Calendar calendar;
+
+  EPOCH_ToCalendar(seconds, &calendar);
+  date->Year = calendar.year;
+  date->Month = calendar.month;
+  date->Date = calendar.date;
+  date->WeekDay = calendar.weekday;
+  time->Hours = calendar.hours;
+  time->Minutes = calendar.minutes;
+  time->Seconds = calendar.seconds;
+  time->TimeFormat = RTC_HOURFORMAT12_AM;
+}
+
+/**
+  * @brief  Reads time and date as one consistent pair, in BCD format.
+  *         BYPSHAD is set, so the registers are read directly rather than
+  *         through shadow copies that are stale until RSF is set again after
+  *         every wake from STOP. Without the shadow lock a second boundary
+  *         can fall between the reads, so TR is read before and after SSR
+  *         and DR and the whole read is repeated if it changed.
+  *         After an ADD1S shift SSR is above PREDIV_S until the added
+  *         second has passed, and the time is one second less than TR and
+  *         DR say. That case is returned as the second before, so SubSeconds
+  *         is never above SecondFraction.
+  * @param  time : receives the time, SubSeconds and SecondFraction included
+  * @param  date : receives the date
+  * @retval None
+  */
+void RTC_ReadCalendar(RTC_TimeTypeDef *time, RTC_DateTypeDef *date)
+{
+  uint32_t tr;
+  uint32_t dr;
+  uint32_t ssr;
+  uint32_t prediv;
+
+  do
+  {
+    tr = RTC->TR;
+    ssr = RTC->SSR;
+    dr = RTC->DR;
+  } while (tr != RTC->TR);
+
+  tr &= RTC_TR_RESERVED_MASK;
+  dr &= RTC_DR_RESERVED_MASK;
+
+  time->Hours = (uint8_t)((tr & (RTC_TR_HT | RTC_TR_HU)) >> 16U);
+  time->Minutes = (uint8_t)((tr & (RTC_TR_MNT | RTC_TR_MNU)) >> 8U);
+  time->Seconds = (uint8_t)(tr & (RTC_TR_ST | RTC_TR_SU));
+  time->TimeFormat = (uint8_t)((tr & RTC_TR_PM) >> 16U);
+  prediv = RTC->PRER & RTC_PRER_PREDIV_S;
+  time->SubSeconds = ssr;
+  time->SecondFraction = prediv;
+
+  date->Year = (uint8_t)((dr & (RTC_DR_YT | RTC_DR_YU)) >> 16U);
+  date->Month = (uint8_t)((dr & (RTC_DR_MT | RTC_DR_MU)) >> 8U);
+  date->Date = (uint8_t)(dr & (RTC_DR_DT | RTC_DR_DU));
+  date->WeekDay = (uint8_t)((dr & RTC_DR_WDU) >> 13U);
+
+  /* Only for up to a second after RTC_ShiftMs(), so the slow way is fine */
+  if (ssr > prediv)
+  {
+    RTC_FromEpoch(RTC_ToEpoch(time, date) - 1, time, date);
+    time->SubSeconds = ssr - (prediv + 1);
+  }
+}
+
+/**
+  * @brief  Reads the calendar as seconds since 2000-01-01 00:00:00.
+  * @param  subSeconds : if not NULL, receives the fraction in 1/256 s
+  * @retval Seconds since the epoch
+  */
+uint32_t RTC_GetEpoch(uint16_t *subSeconds)
+{
+  RTC_DateTypeDef date;
+  RTC_TimeTypeDef time;
+
+  RTC_ReadCalendar(&time, &date);
+
+  if (subSeconds != NULL)
+  {
+    *subSeconds = (uint16_t)(time.SecondFraction - time.SubSeconds);
+  }
+  return RTC_ToEpoch(&time, &date);
+}
+
+/* Sets the calendar to seconds since 2000-01-01 00:00:00, the subseconds
+   restart from zero */
+void RTC_SetEpoch(uint32_t seconds)
+{
+  RTC_DateTypeDef date;
+  RTC_TimeTypeDef time;
+
+  RTC_FromEpoch(seconds, &time, &date);
+  time.DayLightSaving = RTC_DAYLIGHTSAVING_NONE;
+  /* HAL_RTC_SetTime() rewrites the BKP bit, keep the daylight saving state */
+  time.StoreOperation = RtcHandle.Instance->CR & RTC_CR_BCK;
+
+  HAL_RTC_SetDate(&RtcHandle, &date, RTC_FORMAT_BCD);
+  HAL_RTC_SetTime(&RtcHandle, &time, RTC_FORMAT_BCD);
+  HAL_RTCEx_BKUPWrite(&RtcHandle, RTC_BKP_DR0, CALENDAR_VALID);
+
+  showTimeStale = true;
+}
+
+/**
+  * @brief  Moves the calendar by less than a second with RTC_SHIFTR, without
+  *         stopping it. A step forward adds a second (ADD1S) and takes the
+  *         rest of it back in subseconds (SUBFS), a step back is SUBFS only.
+  * @param  ms : milliseconds to move the calendar forward, -999 to 999
+  * @retval None
+  */
+void RTC_ShiftMs(int16_t ms)
+{
+  uint32_t ticks = RtcHandle.Init.SynchPrediv + 1;
+  uint32_t fraction = ((uint32_t)((ms < 0) ? -ms : ms) * ticks + 500) / 1000;
+
+  if (fraction == 0)
+  {
+    return;
+  }
+  if (ms > 0)
+  {
+    HAL_RTCEx_SetSynchroShift(&RtcHandle, RTC_SHIFTADD1S_SET, ticks - fraction);
+  }
+  else
+  {
+    HAL_RTCEx_SetSynchroShift(&RtcHandle, RTC_SHIFTADD1S_RESET, fraction);
+  }
+
+  showTimeStale = true;
+}
+
+/**
+  * @brief  Records whether daylight saving time is in force in the BKP bit
+  *         of RTC_CR, which survives resets along with the calendar.
+  * @param  active : true when summer time starts, false when it ends
+  * @param  shift : also move the calendar an hour forward (ADD1H) or back
+  *         (SUB1H), done by the RTC without stopping it or the subseconds.
+  *         The RTC ignores SUB1H during hour 0.
+  * @retval None
+  */
+void RTC_SetDaylightSaving(bool active, bool shift)
+{
+  uint32_t cr = RtcHandle.Instance->CR;
+
+  if (active == ((cr & RTC_CR_BCK) != 0))
+  {
+    return;
+  }
+
+  __HAL_RTC_WRITEPROTECTION_DISABLE(&RtcHandle);
+  if (active)
+  {
+    RtcHandle.Instance->CR |= shift ? (RTC_CR_ADD1H | RTC_CR_BCK) : RTC_CR_BCK;
+  }
+  else
+  {
+    RtcHandle.Instance->CR = (RtcHandle.Instance->CR & ~RTC_CR_BCK) | (shift ? RTC_CR_SUB1H : 0);
+  }
+  __HAL_RTC_WRITEPROTECTION_ENABLE(&RtcHandle);
+
+  showTimeStale = true;
+}
+
+/* Returns true if the calendar is on daylight saving time */
+bool RTC_IsDaylightSaving(void)
+{
+  return ((RtcHandle.Instance->CR & RTC_CR_BCK) != 0);
+}
+
+/* Returns the BCD time and date of the text from RTC_GetTime() */
+void RTC_GetShownTime(RTC_TimeTypeDef *time, RTC_DateTypeDef *date)
+{
+  *time = showTime;
+  *date = showDate;
+}
+
+/**
+  * @brief  Registers a handler for calendar rollovers. The calendar is only
+  *         compared on RTC wakeups, so the finest event delivered follows
+  *         the update rate: RTC_ROLL_SECOND arrives once a minute in
+  *         RTC_UPDATE_MINUTE.
+  * @param  events : combination of RTC_ROLL_* the handler wants
+  * @param  handler : called from RTC_Run() in the main loop
+  * @retval false if all subscriber slots are used
+  */
+bool RTC_Subscribe(uint8_t events, RTC_RolloverHandler handler)
+{
+  if (subscriberCount >= RTC_MAX_SUBSCRIBERS)
+  {
+    return false;
+  }
+  subscribers[subscriberCount].events = events;
+  subscribers[subscriberCount].handler = handler;
+  subscriberCount++;
+  return true;
+}
+
+/**
+  * @brief  Formats a time and date read in RTC_FORMAT_BCD without printf.
+  *         The RTC registers already hold one digit per nibble, so every
+  *         digit is a shift or mask plus '0'.
+  *         Output: [Www ]hh:mm[:ss[.t]][ AM|PM][ dd/mm/yy]
+  * @param  buf : destination, at least 27 bytes
+  * @param  time : time in BCD format, RTC_SHOW_TENTHS also uses SubSeconds
+  *                and SecondFraction
+  * @param  date : date in BCD format
+  * @param  layout : combination of RTC_SHOW_* flags
+  * @retval Number of characters written, excluding the terminator
+  */
+uint8_t RTC_FormatTime(char *buf, const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date, uint8_t layout)
+{
+  char *p = buf;
+  const char *name;
+  uint8_t hours = time->Hours;
+  uint8_t index;
+
+  if (layout & RTC_SHOW_WEEKDAY)
+  {
+    name = &weekdayNames[(date->WeekDay - 1) * 3];
+    *p++ = name[0];
+    *p++ = name[1];
+    *p++ = name[2];
+    *p++ = ' ';
+  }
+
+  if (layout & RTC_SHOW_12H)
+  {
+    index = (hours >> 4) * 10 + (hours & 0x0F);
+    hours = hour12[index];
+  }
+
+  p = RTC_PutBCD(p, hours);
+  *p++ = ':';
+  p = RTC_PutBCD(p, time->Minutes);
+
+  if (layout & (RTC_SHOW_SECONDS | RTC_SHOW_TENTHS))
+  {
+    *p++ = ':';
+    p = RTC_PutBCD(p, time->Seconds);
+  }
+
+  if (layout & RTC_SHOW_TENTHS)
+  {
+    /* SubSeconds counts down from SecondFraction to 0 over the second */
+    *p++ = '.';
+    *p++ = '0' + (char)(((time->SecondFraction - time->SubSeconds) * 10) / (time->SecondFraction + 1));
+  }
+
+  if (layout & RTC_SHOW_12H)
+  {
+    *p++ = ' ';
+    *p++ = (index < 12) ? 'A' : 'P';
+    *p++ = 'M';
+  }
+
+  if (layout & RTC_SHOW_DATE)
+  {
+    *p++ = ' ';
+    p = RTC_PutBCD(p, date->Date);
+    *p++ = '/';
+    p = RTC_PutBCD(p, date->Month);
+    *p++ = '/';
+    p = RTC_PutBCD(p, date->Year);
+  }
+
+  *p = 0;
+  return (uint8_t)(p - buf);
+}
+
+/* Selects what RTC_Run() shows and wakes up only as often as that changes */
+void RTC_SetLayout(uint8_t layout)
+{
+  showLayout = layout;
+  if (layout & RTC_SHOW_TENTHS)
+  {
+    RTC_SetUpdateRate(RTC_UPDATE_FAST);
+  }
+  else
+  {
+    RTC_SetUpdateRate((layout & RTC_SHOW_SECONDS) ? RTC_UPDATE_SECOND : RTC_UPDATE_MINUTE);
+  }
+}
+
+/**
+  * @brief  Prepare the time to display at the next update boundary.
+  *         The text is formatted one period ahead so the frame can be
+  *         rendered before the boundary and only sent when it arrives.
+  * @param  None
   * @retval None
   */
 void RTC_Run(void)
 {
   RTC_DateTypeDef sdatestructureget;
   RTC_TimeTypeDef stimestructureget;
+  uint32_t fast;
+  
+  /* The first call only takes the snapshot the next wakeup is compared to */
+  if (rtcRolloverDue || !lastValid)
+  {
+    rtcRolloverDue = false;
+    RTC_Publish();
+  }
   
-  /* Get the RTC current Time */
-  HAL_RTC_GetTime(&RtcHandle, &stimestructureget, RTC_FORMAT_BIN);
-  /* Get the RTC current Date */
-  HAL_RTC_GetDate(&RtcHandle, &sdatestructureget, RTC_FORMAT_BIN);
-  /* Display time Format : hh:mm:ss */
-  sprintf((char*)aShowTime,"%02d:%02d:%02d",stimestructureget.Hours, stimestructureget.Minutes, stimestructureget.Seconds);
+  if (!showTimeStale)
+  {
+    return;
+  }
+  /* A boundary that passed before we got here is already covered by the
+     time we are about to read */
+  rtcUpdateDue = false;
+  showTimeStale = false;
+  
+  /* Get the RTC current Time and Date, left in BCD as read from the registers */
+  RTC_ReadCalendar(&stimestructureget, &sdatestructureget);
+  /* Display time Format : hh:mm:ss unless another layout was selected */
+  if (updateRate == RTC_UPDATE_MINUTE)
+  {
+    /* Round up to the next hh:mm:00 */
+    stimestructureget.Seconds = 0x59;
+    RTC_AddSecond(&stimestructureget, &sdatestructureget);
+  }
+  else if (updateRate == RTC_UPDATE_SECOND)
+  {
+    RTC_AddSecond(&stimestructureget, &sdatestructureget);
+  }
+  else
+  {
+    /* The wakeups are not aligned to the second, so step the fraction read
+       now by one 1/8 s period and carry into the seconds */
+    fast = (stimestructureget.SecondFraction + 1) / 8;
+    if (stimestructureget.SubSeconds < fast)
+    {
+      stimestructureget.SubSeconds += stimestructureget.SecondFraction + 1;
+      RTC_AddSecond(&stimestructureget, &sdatestructureget);
+    }
+    stimestructureget.SubSeconds -= fast;
+  }
+  RTC_FormatTime((char*)aShowTime, &stimestructureget, &sdatestructureget, showLayout);
+  showTime = stimestructureget;
+  showDate = sdatestructureget;
 }
 
 uint8_t* RTC_GetTime(void)
@@ -39,6 +39,8 @@
 #include "stm32l0xx_it.h"
 #include "stm32l0xx_hal.h"
 #include "rtc.h"
+#include "uart.h"
+#include "gps.h"
 
 /** @addtogroup STM32L0xx_HAL_Examples
   * @{
@@ -53,6 +55,8 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 extern RTC_HandleTypeDef RtcHandle;
+extern UART_HandleTypeDef UartHandle;
+extern UART_HandleTypeDef GpsHandle;
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -173,6 +177,54 @@ void SysTick_Handler(void)
 void RTC_IRQHandler(void)
 {
   HAL_RTCEx_WakeUpTimerIRQHandler(&RtcHandle);
+  HAL_RTC_AlarmIRQHandler(&RtcHandle);
+}
+
+/**
+  * @brief  This function handles USART2 interrupt request.
+  * @param  None
+  * @retval None
+  */
+void USART2_IRQHandler(void)
+{
+  /* The HAL does not handle idle line detection */
+  if (__HAL_UART_GET_IT(&UartHandle, UART_IT_IDLE) != RESET)
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(&UartHandle);
+    UART_IdleCallback();
+  }
+  HAL_UART_IRQHandler(&UartHandle);
+}
+
+/**
+  * @brief  This function handles LPUART1 interrupt request.
+  * @param  None
+  * @retval None
+  */
+void RNG_LPUART1_IRQHandler(void)
+{
+  if (__HAL_UART_GET_IT(&GpsHandle, UART_IT_IDLE) != RESET)
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(&GpsHandle);
+    GPS_RxCallback();
+  }
+  HAL_UART_IRQHandler(&GpsHandle);
+}
+
+/**
+  * @brief  This function handles DMA1 channel 4 to 7 interrupt request.
+  * @param  None
+  * @retval None
+  */
+void DMA1_Channel4_5_6_7_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(UartHandle.hdmatx);
+  HAL_DMA_IRQHandler(UartHandle.hdmarx);
+  /* Not linked until GPS_Init(), which runs after UART_Init() */
+  if (GpsHandle.hdmarx != NULL)
+  {
+    HAL_DMA_IRQHandler(GpsHandle.hdmarx);
+  }
 }
 
 /**
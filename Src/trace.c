@@ -0,0 +1,157 @@
+/**
+  ******************************************************************************
+  * @file    trace.c
+  * @author  Louis Barrett
+  * @brief   Binary event trace, recorded into RAM and drained over UART DMA
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "trace.h"
+#include "uart.h"
+
+#ifdef TRACE_ENABLED
+
+/* Private define ------------------------------------------------------------*/
+#define TRACE_BUFFER_MASK                   (TRACE_BUFFER_SIZE - 1)
+
+/* Private variables ---------------------------------------------------------*/
+static TRACE_Record traceBuffer[TRACE_BUFFER_SIZE];
+
+/* Free running record counters, only the low bits index the buffer.
+   traceHead is written by producers, traceTail only by TRACE_Run(). */
+static volatile uint16_t traceHead = 0;
+static volatile uint16_t traceTail = 0;
+/* Records currently being sent by the UART DMA */
+static uint16_t traceInFlight = 0;
+static uint16_t traceDropped = 0;
+static uint8_t traceSeq = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Returns the time in SysTick input clocks. Must be called with interrupts
+   masked: if the SysTick counter already wrapped but its handler has not run
+   yet, the pending tick is accounted for here. */
+static uint32_t TRACE_Timestamp(void)
+{
+  uint32_t reload = SysTick->LOAD + 1;
+  uint32_t tick = HAL_GetTick();
+  uint32_t elapsed = SysTick->LOAD - SysTick->VAL;
+
+  if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) && (elapsed < (reload >> 1)))
+  {
+    tick++;
+  }
+  return tick * reload + elapsed;
+}
+
+/* Appends one record, caller has checked for room and masked interrupts */
+static void TRACE_Put(uint32_t timestamp, uint8_t event, uint16_t payload)
+{
+  TRACE_Record *rec = &traceBuffer[traceHead & TRACE_BUFFER_MASK];
+
+  rec->timestamp = timestamp;
+  rec->payload = payload;
+  rec->event = event;
+  rec->seq = traceSeq++;
+  traceHead++;
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/* Records an event. Safe to call from the main loop and from any ISR.
+   The Cortex-M0+ has no exclusive load/store, so the slot is claimed and
+   filled inside a critical section of a few dozen cycles. When the ring is
+   full the new event is dropped (never the ones the DMA may be reading) and
+   an overflow record is emitted once there is room again. */
+void TRACE_Event(uint8_t event, uint16_t payload)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t timestamp;
+  uint16_t used;
+
+  __disable_irq();
+
+  timestamp = TRACE_Timestamp();
+  used = (uint16_t)(traceHead - traceTail);
+
+  if (traceDropped != 0 && used < TRACE_BUFFER_SIZE)
+  {
+    TRACE_Put(timestamp, TRACE_EVT_OVERFLOW, traceDropped);
+    traceDropped = 0;
+    used++;
+  }
+
+  if (used < TRACE_BUFFER_SIZE)
+  {
+    TRACE_Put(timestamp, event, payload);
+  }
+  else if (traceDropped != 0xFFFF)
+  {
+    traceDropped++;
+  }
+
+  __set_PRIMASK(primask);
+}
+
+/* Drains the ring in the background, call from the main loop. Sends the
+   longest contiguous run of records with a single DMA transfer. */
+void TRACE_Run(void)
+{
+  uint16_t start;
+  uint16_t count;
+
+  if (UART_TxBusy())
+  {
+    return;
+  }
+
+  /* The previous transfer is finished, release its records */
+  traceTail += traceInFlight;
+  traceInFlight = 0;
+
+  count = (uint16_t)(traceHead - traceTail);
+  if (count == 0)
+  {
+    return;
+  }
+
+  start = traceTail & TRACE_BUFFER_MASK;
+  if (start + count > TRACE_BUFFER_SIZE)
+  {
+    count = TRACE_BUFFER_SIZE - start;
+  }
+
+  if (UART_Transmit((uint8_t *)&traceBuffer[start], count * sizeof(TRACE_Record)) == HAL_OK)
+  {
+    traceInFlight = count;
+  }
+}
+
+#endif /* TRACE_ENABLED */
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,519 @@
+/**
+  ******************************************************************************
+  * @file    tz.c
+  * @author  Louis Barrett
+  * @brief   Time zones with POSIX TZ style daylight saving rules
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "tz.h"
+#include "rtc.h"
+#include "alarm.h"
+#include "epoch.h"
+#include <stddef.h>
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  TZ_Zone zone;
+  uint32_t next;                            /* UTC epoch seconds of the next change */
+  int16_t current;                          /* offset in force now, minutes         */
+  bool dst;
+} TZ_State;
+
+/* Private define ------------------------------------------------------------*/
+/* Marks a zone without any further change */
+#define TZ_NEVER             0xFFFFFFFFUL
+/* POSIX default time of a change when the rule gives none: 02:00 */
+#define TZ_DEFAULT_CHANGE    (2 * 60)
+
+/* Private variables ---------------------------------------------------------*/
+static TZ_State zones[TZ_MAX_ZONES];
+static uint8_t zoneCount = 0;
+
+/* Offset the RTC calendar is on, the home zone's offset once applied */
+static int16_t rtcOffset = 0;
+
+/* Zones set up by TZ_Init(), home first */
+static const char * const defaultZones[] =
+{
+  "UTC0",
+  "GMT0BST,M3.5.0/1,M10.5.0",
+  "EST5EDT,M3.2.0,M11.1.0",
+  "JST-9"
+};
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Reads an unsigned decimal number */
+static const char* TZ_ParseNumber(const char *p, int16_t *value)
+{
+  if (*p < '0' || *p > '9')
+  {
+    return NULL;
+  }
+  *value = 0;
+  while (*p >= '0' && *p <= '9' && *value < 1000)
+  {
+    *value = *value * 10 + (*p++ - '0');
+  }
+  return p;
+}
+
+/* Reads an abbreviation, three or more letters or anything quoted in <> */
+static const char* TZ_ParseName(const char *p, char *name)
+{
+  uint8_t length = 0;
+  bool quoted = (*p == '<');
+
+  if (quoted)
+  {
+    p++;
+  }
+  while (*p != 0)
+  {
+    if (quoted ? (*p == '>') : !((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z')))
+    {
+      break;
+    }
+    if (length < TZ_NAME_LENGTH - 1)
+    {
+      name[length] = *p;
+    }
+    length++;
+    p++;
+  }
+  if (quoted)
+  {
+    if (*p++ != '>')
+    {
+      return NULL;
+    }
+  }
+  name[(length < TZ_NAME_LENGTH - 1) ? length : TZ_NAME_LENGTH - 1] = 0;
+  return (length < 3) ? NULL : p;
+}
+
+/* Reads [+|-]hh[:mm[:ss]] as minutes, the seconds are dropped */
+static const char* TZ_ParseTime(const char *p, int16_t *minutes)
+{
+  int16_t value;
+  int16_t part;
+  bool negative = (*p == '-');
+
+  if (*p == '+' || *p == '-')
+  {
+    p++;
+  }
+  p = TZ_ParseNumber(p, &value);
+  if (p == NULL)
+  {
+    return NULL;
+  }
+  value *= 60;
+  if (*p == ':')
+  {
+    p = TZ_ParseNumber(p + 1, &part);
+    if (p == NULL)
+    {
+      return NULL;
+    }
+    value += part;
+    if (*p == ':')
+    {
+      p = TZ_ParseNumber(p + 1, &part);
+    }
+  }
+  *minutes = negative ? -value : value;
+  return p;
+}
+
+/* Reads ,Mm.w.d[/time], the only rule form supported */
+static const char* TZ_ParseRule(const char *p, TZ_Rule *rule)
+{
+  int16_t month;
+  int16_t week;
+  int16_t weekday;
+
+  if (p == NULL || p[0] != ',' || p[1] != 'M')
+  {
+    return NULL;
+  }
+  p = TZ_ParseNumber(p + 2, &month);
+  if (p == NULL || *p++ != '.')
+  {
+    return NULL;
+  }
+  p = TZ_ParseNumber(p, &week);
+  if (p == NULL || *p++ != '.')
+  {
+    return NULL;
+  }
+  p = TZ_ParseNumber(p, &weekday);
+  if (p == NULL || month < 1 || month > 12 || week < 1 || week > 5 || weekday > 6)
+  {
+    return NULL;
+  }
+
+  rule->month = (uint8_t)month;
+  rule->week = (uint8_t)week;
+  rule->weekday = (uint8_t)weekday;
+  rule->minutes = TZ_DEFAULT_CHANGE;
+  if (*p == '/')
+  {
+    p = TZ_ParseTime(p + 1, &rule->minutes);
+  }
+  return p;
+}
+
+/* Returns the UTC epoch seconds of a rule in the given year (0-99), the
+   rule's time being local time at the given offset */
+static uint32_t TZ_RuleTime(const TZ_Rule *rule, uint8_t year, int16_t offset)
+{
+  EPOCH_Calendar calendar = {0};
+  uint32_t first;
+  uint8_t last;
+  uint8_t day;
+
+  calendar.year = EPOCH_ToBCD(year);
+  calendar.month = EPOCH_ToBCD(rule->month);
+  calendar.date = 0x01;
+  first = EPOCH_FromCalendar(&calendar) / 86400;
+
+  /* Day 0 of the epoch was a Saturday, weekday 6 */
+  day = (uint8_t)((rule->weekday + 7 - (first + 6) % 7) % 7 + (rule->week - 1) * 7);
+  last = EPOCH_MonthDays(year, rule->month);
+  while (day >= last)
+  {
+    day -= 7;
+  }
+
+  return (first + day) * 86400 + (int32_t)(rule->minutes - offset) * 60;
+}
+
+/* Works out the offset in force at utc and when it changes next. Only runs
+   at a change or when the zone or the time is set, not every second. */
+static void TZ_Update(TZ_State *state, uint32_t utc)
+{
+  const TZ_Zone *zone = &state->zone;
+  EPOCH_Calendar calendar;
+  uint32_t start;
+  uint32_t end;
+  uint8_t year;
+
+  state->dst = false;
+  state->current = zone->offset;
+  state->next = TZ_NEVER;
+  if (!zone->hasDst)
+  {
+    return;
+  }
+
+  EPOCH_ToCalendar(utc + zone->offset * 60, &calendar);
+  year = RTC_Bcd2ToByte(calendar.year);
+  start = TZ_RuleTime(&zone->start, year, zone->offset);
+  end = TZ_RuleTime(&zone->end, year, zone->dstOffset);
+
+  /* Southern zones start summer time late in the year and end it early */
+  if (start < end)
+  {
+    state->dst = (utc >= start && utc < end);
+  }
+  else
+  {
+    state->dst = (utc >= start || utc < end);
+  }
+  if (state->dst)
+  {
+    state->current = zone->dstOffset;
+  }
+
+  if (start > utc)
+  {
+    state->next = start;
+  }
+  if (end > utc && end < state->next)
+  {
+    state->next = end;
+  }
+  if (state->next == TZ_NEVER && year < 99)
+  {
+    start = TZ_RuleTime(&zone->start, year + 1, zone->offset);
+    end = TZ_RuleTime(&zone->end, year + 1, zone->dstOffset);
+    state->next = (start < end) ? start : end;
+  }
+}
+
+/* Moves the RTC calendar onto the home zone's current offset. A one hour
+   daylight saving change uses the RTC's ADD1H/SUB1H, anything else steps
+   the calendar. SUB1H does nothing during hour 0, so a change back to
+   standard time at local midnight steps the calendar as well. Returns true
+   if the calendar moved. */
+static bool TZ_ApplyHome(void)
+{
+  const TZ_State *home = &zones[TZ_HOME];
+  int16_t diff = home->current - rtcOffset;
+  bool moved = (diff != 0);
+
+  if ((diff == 60 && home->dst && !RTC_IsDaylightSaving()) ||
+      (diff == -60 && !home->dst && RTC_IsDaylightSaving() && RTC_GetEpoch(NULL) % 86400 >= 3600))
+  {
+    RTC_SetDaylightSaving(home->dst, true);
+    diff = 0;
+  }
+  if (diff != 0)
+  {
+    RTC_SetEpoch(RTC_GetEpoch(NULL) + diff * 60);
+  }
+  RTC_SetDaylightSaving(home->dst, false);
+
+  rtcOffset = home->current;
+  return moved;
+}
+
+/* Applies daylight saving changes. Rules are given to the minute, so this
+   only needs to run when the minute rolls over. */
+static void TZ_Rollover(uint8_t events, const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date)
+{
+  uint32_t utc = RTC_ToEpoch(time, date) - rtcOffset * 60;
+  uint8_t i;
+
+  for (i = 0; i < zoneCount; i++)
+  {
+    if (utc < zones[i].next)
+    {
+      continue;
+    }
+    TZ_Update(&zones[i], utc);
+    if (i == TZ_HOME && TZ_ApplyHome())
+    {
+      ALARM_Reschedule();
+    }
+  }
+}
+
+/* Public functions ----------------------------------------------------------*/
+
+/**
+  * @brief  Sets up the default zones. The RTC keeps home local time and the
+  *         BKP bit says whether that includes summer time, so a warm boot
+  *         carries on where it left off. Call after RTC_Init().
+  * @param  None
+  * @retval None
+  */
+void TZ_Init(void)
+{
+  TZ_State *home = &zones[TZ_HOME];
+  uint8_t i;
+
+  TZ_Parse(defaultZones[TZ_HOME], &home->zone);
+  zoneCount = 1;
+
+  rtcOffset = home->zone.offset;
+  if (RTC_IsDaylightSaving())
+  {
+    rtcOffset = home->zone.hasDst ? home->zone.dstOffset : home->zone.offset + 60;
+  }
+  TZ_Update(home, TZ_GetUTC(NULL));
+  TZ_ApplyHome();
+
+  for (i = 1; i < sizeof(defaultZones) / sizeof(defaultZones[0]); i++)
+  {
+    TZ_SetZone(i, defaultZones[i]);
+  }
+  RTC_Subscribe(RTC_ROLL_MINUTE, TZ_Rollover);
+}
+
+/**
+  * @brief  Parses a POSIX TZ string such as "CET-1CEST,M3.5.0,M10.5.0/3".
+  *         The offset is hours west of UTC as in POSIX, it is stored as
+  *         minutes east. Only the Mm.w.d rule form is supported.
+  * @param  spec : TZ string
+  * @param  zone : receives the parsed zone
+  * @retval true if the string was understood
+  */
+bool TZ_Parse(const char *spec, TZ_Zone *zone)
+{
+  const char *p;
+  int16_t west;
+
+  p = TZ_ParseName(spec, zone->name);
+  if (p == NULL)
+  {
+    return false;
+  }
+  p = TZ_ParseTime(p, &west);
+  if (p == NULL)
+  {
+    return false;
+  }
+  zone->offset = -west;
+  zone->dstOffset = zone->offset;
+  zone->dstName[0] = 0;
+  zone->hasDst = false;
+  if (*p == 0)
+  {
+    return true;
+  }
+
+  p = TZ_ParseName(p, zone->dstName);
+  if (p == NULL)
+  {
+    return false;
+  }
+  zone->dstOffset = zone->offset + 60;
+  if (*p != ',' && *p != 0)
+  {
+    p = TZ_ParseTime(p, &west);
+    if (p == NULL)
+    {
+      return false;
+    }
+    zone->dstOffset = -west;
+  }
+  p = TZ_ParseRule(p, &zone->start);
+  p = TZ_ParseRule(p, &zone->end);
+  if (p == NULL || *p != 0)
+  {
+    return false;
+  }
+  zone->hasDst = true;
+  return true;
+}
+
+/* Sets or adds (index == TZ_GetZoneCount()) a zone from a POSIX TZ string.
+   Changing the home zone moves the RTC calendar to the new local time. */
+bool TZ_SetZone(uint8_t index, const char *spec)
+{
+  TZ_Zone zone;
+  uint32_t utc;
+
+  if (index > zoneCount || index >= TZ_MAX_ZONES || !TZ_Parse(spec, &zone))
+  {
+    return false;
+  }
+
+  utc = TZ_GetUTC(NULL);
+  zones[index].zone = zone;
+  if (index == zoneCount)
+  {
+    zoneCount++;
+  }
+  TZ_Update(&zones[index], utc);
+  if (index == TZ_HOME && TZ_ApplyHome())
+  {
+    ALARM_Reschedule();
+  }
+  return true;
+}
+
+uint8_t TZ_GetZoneCount(void)
+{
+  return zoneCount;
+}
+
+/* Returns a zone's offset from UTC in force now, in minutes */
+int16_t TZ_GetOffset(uint8_t index)
+{
+  return zones[index].current;
+}
+
+/* Returns a zone's abbreviation in force now, e.g. "CEST" */
+const char* TZ_GetName(uint8_t index)
+{
+  return zones[index].dst ? zones[index].zone.dstName : zones[index].zone.name;
+}
+
+/* Reads the time as UTC epoch seconds, see RTC_GetEpoch() */
+uint32_t TZ_GetUTC(uint16_t *subSeconds)
+{
+  return RTC_GetEpoch(subSeconds) - rtcOffset * 60;
+}
+
+/* Sets the RTC from UTC epoch seconds, e.g. from a time sync */
+void TZ_SetUTC(uint32_t seconds)
+{
+  uint8_t i;
+
+  RTC_SetEpoch(seconds + rtcOffset * 60);
+  for (i = 0; i < zoneCount; i++)
+  {
+    TZ_Update(&zones[i], seconds);
+  }
+  TZ_ApplyHome();
+  ALARM_Reschedule();
+}
+
+/**
+  * @brief  Formats a zone's local time for the world clock as "NAME  hh:mm"
+  *         with '+' or '-' after it when the zone is on another day. The
+  *         offset to home time is kept up to date on every minute, so this is
+  *         a minute addition rather than a calendar conversion.
+  * @param  buf : destination, at least 13 bytes
+  * @param  index : zone to show
+  * @param  home : home local time in BCD format, e.g. from RTC_GetShownTime()
+  * @retval Number of characters written, excluding the terminator
+  */
+uint8_t TZ_FormatZone(char *buf, uint8_t index, const RTC_TimeTypeDef *home)
+{
+  const char *name = TZ_GetName(index);
+  char *p = buf;
+  char day = ' ';
+  int16_t minutes;
+  uint8_t hours;
+
+  minutes = RTC_Bcd2ToByte(home->Hours) * 60 + RTC_Bcd2ToByte(home->Minutes)
+            + zones[index].current - rtcOffset;
+  if (minutes < 0)
+  {
+    minutes += 24 * 60;
+    day = '-';
+  }
+  else if (minutes >= 24 * 60)
+  {
+    minutes -= 24 * 60;
+    day = '+';
+  }
+  hours = (uint8_t)(minutes / 60);
+  minutes -= hours * 60;
+
+  while (p < buf + TZ_NAME_LENGTH)
+  {
+    *p++ = (*name != 0) ? *name++ : ' ';
+  }
+  *p++ = '0' + hours / 10;
+  *p++ = '0' + hours % 10;
+  *p++ = ':';
+  *p++ = '0' + minutes / 10;
+  *p++ = '0' + minutes % 10;
+  *p++ = day;
+  *p = 0;
+  return (uint8_t)(p - buf);
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
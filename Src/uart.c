@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file    uart.c
+  * @author  Louis Barrett
+  * @brief   Main control class for the debug UART (USART2)
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "uart.h"
+#include "gps.h"
+
+/* Private variables ---------------------------------------------------------*/
+/* UART handler declaration */
+UART_HandleTypeDef UartHandle;
+DMA_HandleTypeDef UartTxDmaHandle;
+DMA_HandleTypeDef UartRxDmaHandle;
+
+/* Written by the RX DMA in circular mode, read from rxTail onwards */
+static uint8_t rxBuffer[UART_RX_BUFFER_SIZE];
+static uint16_t rxTail = 0;
+/* Set on idle line, half and full buffer, cleared by UART_RxEvent() */
+static volatile bool rxEvent = false;
+/* Set when a receive error stopped the DMA */
+static volatile bool rxRestart = false;
+
+/* Private functions ---------------------------------------------------------*/
+
+/* Starts the circular RX DMA. Only the idle line, half and full buffer
+   interrupts are left, there is no interrupt per byte. */
+static void UART_StartReceive(void)
+{
+  rxTail = 0;
+  HAL_UART_Receive_DMA(&UartHandle, rxBuffer, UART_RX_BUFFER_SIZE);
+  __HAL_UART_CLEAR_IDLEFLAG(&UartHandle);
+  __HAL_UART_ENABLE_IT(&UartHandle, UART_IT_IDLE);
+}
+
+void HAL_UART_MspInit(UART_HandleTypeDef *huart)
+{
+  GPIO_InitTypeDef  GPIO_InitStruct;
+
+  if (huart->Instance == USARTx_PORT)
+  {
+    /*##-1- Enable peripherals and GPIO Clocks #################################*/
+    USARTx_GPIO_CLK_ENABLE();
+    USARTx_CLK_ENABLE();
+    __HAL_RCC_DMA1_CLK_ENABLE();
+
+    /*##-2- Configure peripheral GPIO ##########################################*/
+    GPIO_InitStruct.Pin       = USARTx_TX_PIN;
+    GPIO_InitStruct.Mode      = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull      = GPIO_PULLUP;
+    GPIO_InitStruct.Speed     = GPIO_SPEED_FREQ_HIGH;
+    GPIO_InitStruct.Alternate = USARTx_TX_AF;
+    HAL_GPIO_Init(USARTx_TX_GPIO_PORT, &GPIO_InitStruct);
+
+    GPIO_InitStruct.Pin       = USARTx_RX_PIN;
+    GPIO_InitStruct.Alternate = USARTx_RX_AF;
+    HAL_GPIO_Init(USARTx_RX_GPIO_PORT, &GPIO_InitStruct);
+
+    /*##-3- Configure the DMA for transmission #################################*/
+    UartTxDmaHandle.Instance                 = USARTx_TX_DMA_CHANNEL;
+    UartTxDmaHandle.Init.Request             = USARTx_TX_DMA_REQUEST;
+    UartTxDmaHandle.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+    UartTxDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+    UartTxDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+    UartTxDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    UartTxDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    UartTxDmaHandle.Init.Mode                = DMA_NORMAL;
+    UartTxDmaHandle.Init.Priority            = DMA_PRIORITY_LOW;
+    HAL_DMA_Init(&UartTxDmaHandle);
+    __HAL_LINKDMA(huart, hdmatx, UartTxDmaHandle);
+
+    /*##-4- Configure the DMA for reception ####################################*/
+    /* Circular, the DMA never stops and UART_RxPeek() follows its counter */
+    UartRxDmaHandle.Instance                 = USARTx_RX_DMA_CHANNEL;
+    UartRxDmaHandle.Init.Request             = USARTx_RX_DMA_REQUEST;
+    UartRxDmaHandle.Init.Direction           = DMA_PERIPH_TO_MEMORY;
+    UartRxDmaHandle.Init.PeriphInc           = DMA_PINC_DISABLE;
+    UartRxDmaHandle.Init.MemInc              = DMA_MINC_ENABLE;
+    UartRxDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    UartRxDmaHandle.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    UartRxDmaHandle.Init.Mode                = DMA_CIRCULAR;
+    UartRxDmaHandle.Init.Priority            = DMA_PRIORITY_HIGH;
+    HAL_DMA_Init(&UartRxDmaHandle);
+    __HAL_LINKDMA(huart, hdmarx, UartRxDmaHandle);
+
+    /*##-5- Configure the NVIC #################################################*/
+    /* The DMA completes the copy, the USART interrupt signals the last stop bit */
+    HAL_NVIC_SetPriority(USARTx_DMA_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(USARTx_DMA_IRQn);
+    HAL_NVIC_SetPriority(USARTx_IRQn, 1, 0);
+    HAL_NVIC_EnableIRQ(USARTx_IRQn);
+  }
+  else if (huart->Instance == GPS_PORT)
+  {
+    GPS_MspInit(huart);
+  }
+}
+
+/* Public functions ----------------------------------------------------------*/
+void UART_Init(void)
+{
+  UartHandle.Instance            = USARTx_PORT;
+  UartHandle.Init.BaudRate       = USARTx_BAUDRATE;
+  UartHandle.Init.WordLength     = UART_WORDLENGTH_8B;
+  UartHandle.Init.StopBits       = UART_STOPBITS_1;
+  UartHandle.Init.Parity         = UART_PARITY_NONE;
+  UartHandle.Init.HwFlowCtl      = UART_HWCONTROL_NONE;
+  UartHandle.Init.Mode           = UART_MODE_TX_RX;
+  /* With a 2 MHz PCLK, 8x oversampling keeps the 115200 baud error under 1% */
+  UartHandle.Init.OverSampling   = UART_OVERSAMPLING_8;
+  UartHandle.AdvancedInit.AdvFeatureInit = UART_ADVFEATURE_NO_INIT;
+
+  HAL_UART_Init(&UartHandle);
+  UART_StartReceive();
+}
+
+UART_HandleTypeDef* UART_GetHandle(void)
+{
+  return &UartHandle;
+}
+
+/* Returns true while a previous DMA transmission is still on the wire */
+bool UART_TxBusy(void)
+{
+  return (UartHandle.gState != HAL_UART_STATE_READY);
+}
+
+/* Starts a background DMA transmission. The buffer must stay untouched until
+   UART_TxBusy() returns false again. Returns HAL_BUSY if the UART is in use. */
+HAL_StatusTypeDef UART_Transmit(uint8_t *data, uint16_t length)
+{
+  return HAL_UART_Transmit_DMA(&UartHandle, data, length);
+}
+
+/* Returns true once after the line went idle or the RX buffer filled up to
+   its half or end, i.e. when there is something worth looking at */
+bool UART_RxEvent(void)
+{
+  if (!rxEvent && !rxRestart)
+  {
+    return false;
+  }
+  rxEvent = false;
+  return true;
+}
+
+/**
+  * @brief  Returns the received bytes not consumed yet, in place. Only the
+  *         run up to the end of the ring is returned, call again after
+  *         UART_RxConsume() for the rest.
+  * @param  data : receives a pointer to the first byte
+  * @retval Number of contiguous bytes available
+  */
+uint16_t UART_RxPeek(const uint8_t **data)
+{
+  uint16_t head;
+
+  if (rxRestart)
+  {
+    /* Anything received before the error is lost */
+    rxRestart = false;
+    UART_StartReceive();
+  }
+
+  head = (UART_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&UartRxDmaHandle)) & (UART_RX_BUFFER_SIZE - 1);
+  *data = &rxBuffer[rxTail];
+  return (head >= rxTail) ? (head - rxTail) : (UART_RX_BUFFER_SIZE - rxTail);
+}
+
+/* Releases bytes returned by UART_RxPeek() */
+void UART_RxConsume(uint16_t length)
+{
+  rxTail = (rxTail + length) & (UART_RX_BUFFER_SIZE - 1);
+}
+
+/* Called from USART2_IRQHandler when the line goes idle after a burst */
+void UART_IdleCallback(void)
+{
+  rxEvent = true;
+}
+
+void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == GPS_PORT)
+  {
+    GPS_RxCallback();
+    return;
+  }
+  rxEvent = true;
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == GPS_PORT)
+  {
+    GPS_RxCallback();
+    return;
+  }
+  rxEvent = true;
+}
+
+/* Framing, noise or overrun errors abort the RX DMA, restart it from the
+   main loop */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return;
+  }
+  if (huart->Instance == GPS_PORT)
+  {
+    GPS_RxRestart();
+  }
+  else
+  {
+    rxRestart = true;
+  }
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
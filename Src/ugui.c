@@ -37,10 +37,27 @@
  void _UG_TextboxUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
  void _UG_ButtonUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
  void _UG_ImageUpdate(UG_WINDOW* wnd, UG_OBJECT* obj);
+ void _UG_PSetClipped( UG_S16 x0, UG_S16 y0, UG_COLOR c );
+ void _UG_PutGlyph( const unsigned char* p, UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, UG_COLOR fc, UG_COLOR bc );
+ void _UG_PutRleGlyph( const UG_FONT_RLE* rle, UG_U16 n, UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, UG_COLOR fc, UG_COLOR bc );
+ UG_U8 _UG_RemapChar( UG_U8 bt );
+ const UG_GLYPH* _UG_PropGlyph( const UG_FONT_PROP* prop, UG_U8 bt );
+ UG_S16 _UG_PropKerning( const UG_FONT_PROP* prop, UG_U8 left, UG_U8 right );
+ UG_S16 _UG_PropWidth( const UG_FONT_PROP* prop, const char* str, UG_S16 h_space );
+ UG_S16 _UG_PutPropChar( const UG_FONT_PROP* prop, UG_U8 bt, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc );
+ UG_S16 _UG_LineWidth( const UG_FONT* font, const char* str, UG_S16 h_space );
+ void _UG_TextLayout( UG_TEXT* txt, UG_TEXT_LAYOUT* l, UG_U16 first );
+ void _UG_PutTextLine( UG_TEXT* txt, char* str, UG_S16 xp, UG_S16 yp );
+ void _UG_ObjectInvalidate( UG_WINDOW* wnd, UG_OBJECT* obj );
+ void _UG_RedrawDirty( UG_WINDOW* wnd );
+ void _UG_DirtyReport( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye );
 
  /* Pointer to the gui */
 static UG_GUI* gui;
 
+typedef void (*UG_PSET)(UG_S16,UG_S16,UG_COLOR);
+static UG_PSET _UG_ClipPSet( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2 );
+
 #ifdef USE_FONT_4X6
 __UG_CONST unsigned char font_4x6[256][6]={
 {0x00,0x00,0x00,0x00,0x00,0x00}, // 0x00
@@ -1869,7 +1886,7 @@ __UG_CONST unsigned char font_8x8[256][8]={
 #endif
 
 #ifdef USE_FONT_8X12_KRPM
-__UG_CONST unsigned char font_8x12_KRPM[256][12]={
+__UG_CONST unsigned char font_8x12_KRPM[10][12]={
 {0x00,0x1E,0x33,0x30,0x18,0x0C,0x0C,0x00,0x0C,0x0C,0x00,0x00}, // 0x00 (default, set to '?')
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x01 (Space)
 {0x00,0x67,0x66,0x36,0x36,0x1E,0x36,0x36,0x66,0x67,0x00,0x00}, // 0x02 (K)
@@ -1882,15 +1899,15 @@ __UG_CONST unsigned char font_8x12_KRPM[256][12]={
 {0x00,0x00,0x00,0x00,0x37,0x76,0x6E,0x06,0x06,0x0F,0x00,0x00}, // 0x09 (r)
 };
 
-uint8_t LUT_8x12_KRPM[256]={
+__UG_CONST UG_U8 LUT_8x12_KRPM[256]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x00,0x00,0x04,
-  0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x00,0x08,
-  0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x00,0x00,
+  0x04,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x00,0x00,
+  0x08,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -2424,6 +2441,172 @@ __UG_CONST unsigned char font_8x14[256][14]={
 };
 #endif
 
+#ifdef USE_FONT_8X14P
+/* Proportional FONT_8X14P, generated by Tools/fontconv.py from font_8x14 */
+__UG_CONST UG_U8 font_8x14p_bitmap[832]={
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x09,0x09,0x09,0x09,0x90,0x90,
+  0x48,0xFE,0x48,0x24,0xFF,0x24,0x12,0x12,0x04,0x1E,0x05,0x05,0x05,0x06,0x0C,0x14,
+  0x14,0x14,0x0F,0x04,0x86,0x49,0x29,0x29,0x16,0x68,0x94,0x94,0x92,0x61,0x18,0x24,
+  0x24,0x14,0x0C,0x8B,0x91,0x71,0x63,0xFE,0x01,0x01,0x01,0x01,0x18,0x0C,0x02,0x02,
+  0x01,0x01,0x01,0x01,0x01,0x02,0x02,0x0C,0x18,0x03,0x06,0x08,0x08,0x10,0x10,0x10,
+  0x10,0x10,0x08,0x08,0x06,0x03,0x04,0x04,0x33,0x0A,0x16,0x12,0x08,0x08,0x08,0x7F,
+  0x08,0x08,0x08,0x03,0x03,0x02,0x01,0x3F,0x03,0x03,0x20,0x10,0x10,0x10,0x08,0x08,
+  0x0C,0x04,0x04,0x02,0x02,0x02,0x01,0x0C,0x12,0x21,0x21,0x21,0x21,0x21,0x21,0x12,
+  0x0C,0x08,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x7F,0x0F,0x10,0x10,0x10,0x08,
+  0x08,0x04,0x02,0x01,0x1F,0x0F,0x10,0x10,0x10,0x0E,0x10,0x10,0x10,0x10,0x0F,0x10,
+  0x18,0x14,0x14,0x12,0x11,0x3F,0x10,0x10,0x10,0x1F,0x01,0x01,0x01,0x07,0x18,0x10,
+  0x10,0x10,0x0F,0x1C,0x02,0x01,0x01,0x1D,0x23,0x21,0x21,0x22,0x1C,0x3F,0x20,0x10,
+  0x10,0x08,0x04,0x04,0x04,0x02,0x02,0x1E,0x21,0x21,0x11,0x0E,0x12,0x21,0x21,0x21,
+  0x1E,0x0E,0x11,0x21,0x21,0x31,0x2E,0x20,0x20,0x10,0x0E,0x03,0x03,0x00,0x00,0x00,
+  0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x03,0x03,0x02,0x01,0x20,0x18,0x04,0x03,0x04,
+  0x18,0x20,0x3F,0x00,0x00,0x3F,0x01,0x06,0x08,0x30,0x08,0x06,0x01,0x1F,0x21,0x20,
+  0x10,0x08,0x04,0x04,0x00,0x04,0x04,0x3C,0x46,0x72,0x49,0x49,0x49,0x69,0xDB,0x22,
+  0x3C,0x10,0x18,0x28,0x24,0x24,0x42,0x7E,0x42,0x81,0x1F,0x21,0x21,0x11,0x0F,0x11,
+  0x21,0x21,0x1F,0x7C,0x02,0x01,0x01,0x01,0x01,0x01,0x02,0x7C,0x1F,0x21,0x41,0x41,
+  0x41,0x41,0x41,0x21,0x1F,0x3F,0x01,0x01,0x01,0x1F,0x01,0x01,0x01,0x3F,0x3F,0x01,
+  0x01,0x01,0x1F,0x01,0x01,0x01,0x01,0x7C,0x02,0x01,0x01,0x01,0x71,0x41,0x42,0x7C,
+  0x21,0x21,0x21,0x21,0x3F,0x21,0x21,0x21,0x21,0x1F,0x04,0x04,0x04,0x04,0x04,0x04,
+  0x04,0x1F,0x1E,0x10,0x10,0x10,0x10,0x10,0x10,0x10,0x0F,0x21,0x11,0x09,0x05,0x03,
+  0x05,0x09,0x11,0x21,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x3F,0x63,0x63,0x63,
+  0x55,0x55,0x55,0x49,0x41,0x41,0x21,0x23,0x23,0x25,0x25,0x29,0x29,0x31,0x21,0x1C,
+  0x22,0x41,0x41,0x41,0x41,0x41,0x22,0x1C,0x1F,0x21,0x21,0x21,0x31,0x0F,0x01,0x01,
+  0x01,0x1C,0x22,0x41,0x41,0x41,0x41,0x41,0x22,0x1C,0x60,0xC0,0x0F,0x11,0x11,0x11,
+  0x0F,0x09,0x19,0x11,0x21,0x3E,0x01,0x01,0x03,0x0C,0x30,0x20,0x20,0x1F,0x7F,0x08,
+  0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x1E,
+  0x81,0x42,0x42,0x22,0x24,0x14,0x14,0x08,0x08,0x81,0x81,0xC9,0x59,0x5A,0x5A,0x66,
+  0x66,0x24,0x81,0x42,0x24,0x18,0x18,0x18,0x24,0x42,0x81,0x81,0x42,0x22,0x14,0x18,
+  0x08,0x08,0x08,0x08,0x7F,0x40,0x20,0x10,0x08,0x04,0x02,0x01,0x7F,0x0F,0x01,0x01,
+  0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x0F,0x01,0x02,0x02,0x02,0x04,0x04,
+  0x0C,0x08,0x08,0x10,0x10,0x10,0x20,0x0F,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,
+  0x08,0x08,0x08,0x0F,0x08,0x08,0x0C,0x14,0x14,0x12,0x22,0x21,0xFF,0x01,0x02,0x1E,
+  0x20,0x20,0x3E,0x21,0x21,0x7E,0x01,0x01,0x01,0x01,0x1D,0x23,0x21,0x21,0x21,0x23,
+  0x1D,0x3C,0x02,0x01,0x01,0x01,0x02,0x3C,0x20,0x20,0x20,0x20,0x2E,0x31,0x21,0x21,
+  0x21,0x31,0x2E,0x1E,0x22,0x21,0x3F,0x01,0x01,0x3E,0x38,0x04,0x04,0x04,0x3F,0x04,
+  0x04,0x04,0x04,0x04,0x04,0x3E,0x31,0x21,0x21,0x21,0x31,0x2E,0x20,0x20,0x1E,0x01,
+  0x01,0x01,0x01,0x1D,0x23,0x21,0x21,0x21,0x21,0x21,0x0C,0x0C,0x00,0x00,0x0F,0x08,
+  0x08,0x08,0x08,0x08,0x08,0x18,0x18,0x00,0x00,0x1E,0x10,0x10,0x10,0x10,0x10,0x10,
+  0x10,0x10,0x0F,0x01,0x01,0x01,0x01,0x11,0x09,0x05,0x03,0x0D,0x11,0x21,0x0F,0x08,
+  0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x08,0x6D,0x5B,0x49,0x49,0x49,0x49,0x49,
+  0x1D,0x23,0x21,0x21,0x21,0x21,0x21,0x1C,0x22,0x41,0x41,0x41,0x22,0x1C,0x1D,0x23,
+  0x21,0x21,0x21,0x23,0x1D,0x01,0x01,0x01,0x2E,0x31,0x21,0x21,0x21,0x31,0x2E,0x20,
+  0x20,0x20,0x1D,0x13,0x01,0x01,0x01,0x01,0x01,0x1E,0x01,0x03,0x0C,0x10,0x10,0x0F,
+  0x04,0x04,0x7F,0x04,0x04,0x04,0x04,0x04,0x78,0x21,0x21,0x21,0x21,0x21,0x31,0x2E,
+  0x81,0x42,0x42,0x22,0x14,0x14,0x08,0x81,0x91,0x5A,0x5A,0x66,0x24,0x24,0x21,0x12,
+  0x0C,0x0C,0x0C,0x12,0x21,0x81,0x42,0x42,0x24,0x24,0x18,0x18,0x08,0x0C,0x07,0x7F,
+  0x20,0x10,0x08,0x04,0x02,0x7F,0x38,0x04,0x04,0x04,0x04,0x04,0x03,0x04,0x04,0x04,
+  0x04,0x04,0x38,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+  0x07,0x08,0x08,0x08,0x08,0x08,0x30,0x08,0x08,0x08,0x08,0x08,0x07,0x86,0x99,0x61,
+};
+
+__UG_CONST UG_GLYPH font_8x14p_glyph[95]={
+{0,0,0,0,0,4}, // 0x20
+{0,1,10,0,1,1}, // 0x21
+{10,4,4,0,0,4}, // 0x22
+{14,8,10,0,1,8}, // 0x23
+{24,5,12,0,0,5}, // 0x24
+{36,8,10,0,1,8}, // 0x25
+{46,8,10,0,1,8}, // 0x26
+{56,1,4,0,0,1}, // 0x27
+{60,5,13,0,0,5}, // 0x28
+{73,5,13,0,0,5}, // 0x29
+{86,6,6,0,1,6}, // 0x2A
+{92,7,7,0,4,7}, // 0x2B
+{99,2,4,0,9,2}, // 0x2C
+{103,6,1,0,6,6}, // 0x2D
+{104,2,2,0,9,2}, // 0x2E
+{106,6,13,0,0,6}, // 0x2F
+{119,6,10,0,1,7}, // 0x30
+{129,7,10,0,1,7}, // 0x31
+{139,5,10,1,1,7}, // 0x32
+{149,5,10,1,1,7}, // 0x33
+{159,6,10,0,1,7}, // 0x34
+{169,5,10,1,1,7}, // 0x35
+{179,6,10,0,1,7}, // 0x36
+{189,6,10,0,1,7}, // 0x37
+{199,6,10,0,1,7}, // 0x38
+{209,6,10,0,1,7}, // 0x39
+{219,2,7,0,4,2}, // 0x3A
+{226,2,9,0,4,2}, // 0x3B
+{235,6,7,0,4,6}, // 0x3C
+{242,6,4,0,5,6}, // 0x3D
+{246,6,7,0,4,6}, // 0x3E
+{253,6,10,0,1,6}, // 0x3F
+{263,8,10,0,1,8}, // 0x40
+{273,8,9,0,2,8}, // 0x41
+{282,6,9,0,2,6}, // 0x42
+{291,7,9,0,2,7}, // 0x43
+{300,7,9,0,2,7}, // 0x44
+{309,6,9,0,2,6}, // 0x45
+{318,6,9,0,2,6}, // 0x46
+{327,7,9,0,2,7}, // 0x47
+{336,6,9,0,2,6}, // 0x48
+{345,5,9,0,2,5}, // 0x49
+{354,5,9,0,2,5}, // 0x4A
+{363,6,9,0,2,6}, // 0x4B
+{372,6,9,0,2,6}, // 0x4C
+{381,7,9,0,2,7}, // 0x4D
+{390,6,9,0,2,6}, // 0x4E
+{399,7,9,0,2,7}, // 0x4F
+{408,6,9,0,2,6}, // 0x50
+{417,8,11,0,2,8}, // 0x51
+{428,6,9,0,2,6}, // 0x52
+{437,6,9,0,2,6}, // 0x53
+{446,7,9,0,2,7}, // 0x54
+{455,6,9,0,2,6}, // 0x55
+{464,8,9,0,2,8}, // 0x56
+{473,8,9,0,2,8}, // 0x57
+{482,8,9,0,2,8}, // 0x58
+{491,8,9,0,2,8}, // 0x59
+{500,7,9,0,2,7}, // 0x5A
+{509,4,13,0,0,4}, // 0x5B
+{522,6,13,0,0,6}, // 0x5C
+{535,4,13,0,0,4}, // 0x5D
+{548,6,8,0,1,6}, // 0x5E
+{556,8,1,0,11,8}, // 0x5F
+{557,2,2,0,0,2}, // 0x60
+{559,7,7,0,4,7}, // 0x61
+{566,6,11,0,0,6}, // 0x62
+{577,6,7,0,4,6}, // 0x63
+{584,6,11,0,0,6}, // 0x64
+{595,6,7,0,4,6}, // 0x65
+{602,6,11,0,0,6}, // 0x66
+{613,6,10,0,4,6}, // 0x67
+{623,6,11,0,0,6}, // 0x68
+{634,4,11,0,0,4}, // 0x69
+{645,5,14,0,0,5}, // 0x6A
+{659,6,11,0,0,6}, // 0x6B
+{670,4,11,0,0,4}, // 0x6C
+{681,7,7,0,4,7}, // 0x6D
+{688,6,7,0,4,6}, // 0x6E
+{695,7,7,0,4,7}, // 0x6F
+{702,6,10,0,4,6}, // 0x70
+{712,6,10,0,4,6}, // 0x71
+{722,5,7,0,4,5}, // 0x72
+{729,5,7,0,4,5}, // 0x73
+{736,7,9,0,2,7}, // 0x74
+{745,6,7,0,4,6}, // 0x75
+{752,8,7,0,4,8}, // 0x76
+{759,8,7,0,4,8}, // 0x77
+{766,6,7,0,4,6}, // 0x78
+{773,8,10,0,4,8}, // 0x79
+{783,7,7,0,4,7}, // 0x7A
+{790,6,13,0,0,6}, // 0x7B
+{803,1,13,0,0,1}, // 0x7C
+{816,6,13,0,0,6}, // 0x7D
+{829,8,3,0,5,8}, // 0x7E
+};
+
+__UG_CONST UG_KERN font_8x14p_kern[5]={
+{0x41,0x56,-1}, // AV
+{0x4C,0x54,-1}, // LT
+{0x54,0x65,-1}, // Te
+{0x54,0x6F,-1}, // To
+{0x56,0x41,-1}, // VA
+};
+
+__UG_CONST UG_FONT_PROP font_8x14p_prop={font_8x14p_bitmap,font_8x14p_glyph,font_8x14p_kern,5,0x20,0x7E};
+#endif
+
 #ifdef USE_FONT_10X16
 __UG_CONST unsigned char font_10x16[256][32]={
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},   // 0x00
@@ -3206,15 +3389,15 @@ __UG_CONST unsigned char font_12x20[256][40]={
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}   // 0xFF
 };
 
-uint8_t LUT_12x20[256]={
+__UG_CONST UG_U8 LUT_12x20[256]={
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x00,0x6D,0x00,0x00,0x70,
-  0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6B,0x00,0x6D,0x00,0x00,
+  0x70,0x00,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -3504,11 +3687,11 @@ __UG_CONST unsigned char font_20x32[13][96]={
   {0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x1F,0x00,0xF0,0x7F,0x00,0xF8,0xFF,0x01,0x7C,0xF0,0x03,0x3E,0xC0,0x03,0x1E,0x80,0x07,0x0F,0x80,0x07,0x0F,0x00,0x07,0x0F,0x00,0x0F,0x0F,0x00,0x0F,0x0F,0x00,0x0F,0x0F,0x00,0x0F,0x1F,0x00,0x0F,0x3E,0x00,0x0F,0x7E,0xC0,0x0F,0xFC,0xFF,0x0F,0xF8,0x7F,0x0F,0xC0,0x1F,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x01,0x08,0xFC,0x00,0xF8,0x7F,0x00,0xF8,0x1F,0x00,0xF8,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00}  // 0x0C (nine)
 };
 
-uint8_t LUT_20x32[256]={
+__UG_CONST UG_U8 LUT_20x32[256]={
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,
-  0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+  0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0A,0x0B,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -4307,59 +4490,1847 @@ __UG_CONST unsigned char font_32x53[256][212]={
 };
 #endif
 
+#ifdef USE_FONT_24X40R
+/* Run length coded FONT_24X40R, generated by Tools/fontconv.py from font_24x40 */
+__UG_CONST UG_U8 font_24x40r_data[11494]={
+  0xFA,0xF9,0x16,0x47,0x0A,0xA2,0x8D,0x64,0x60,0xC3,0x08,0xC4,0xB0,0xC6,0x31,0x86,
+  0x51,0x89,0x61,0x10,0x62,0x10,0x95,0x18,0x46,0x21,0x04,0x41,0x09,0x62,0x18,0x42,
+  0x10,0x93,0x68,0x84,0x20,0x26,0xD1,0x08,0x41,0x4C,0xA2,0x11,0x82,0x98,0x44,0x23,
+  0x04,0x31,0x09,0x62,0x18,0x42,0x10,0x94,0x18,0x46,0x21,0x04,0x51,0x89,0x61,0x10,
+  0x62,0x10,0xD5,0x38,0xC6,0x30,0xAC,0x61,0x04,0x62,0x60,0x23,0x19,0x1A,0x29,0x08,
+  0xB7,0xBE,0x03,0xFA,0xF9,0x16,0xD7,0xB4,0x87,0xA5,0xE0,0x58,0x6A,0x30,0x55,0x19,
+  0x88,0x50,0xAA,0x32,0x14,0x81,0x50,0x66,0x30,0x02,0x99,0x9E,0x40,0xA6,0x27,0x90,
+  0xE9,0x09,0x64,0x7A,0x02,0x99,0xCC,0x60,0x04,0x42,0x95,0xA1,0x08,0xA4,0x2A,0x03,
+  0x11,0x4A,0xA5,0x06,0x63,0xA5,0xE0,0x60,0x4F,0x6B,0xDC,0xFA,0x0E,0xC8,0xF9,0x98,
+  0x06,0x31,0x59,0xD5,0xC9,0x4A,0x18,0xCA,0x50,0x7E,0xF4,0xA3,0xA1,0xFC,0xE4,0x46,
+  0x37,0xDA,0xC9,0x4E,0x7E,0x30,0x64,0xA5,0x4A,0x49,0x0B,0x6A,0xCC,0x3B,0x51,0x30,
+  0x07,0x59,0xC4,0x03,0x26,0x6F,0x71,0x4D,0x7B,0x58,0xAC,0xAA,0x74,0x21,0xCD,0xF4,
+  0x26,0x43,0x77,0x9A,0x56,0xCC,0xDC,0xB6,0xBC,0x04,0x1E,0xB1,0x90,0xC3,0x0C,0x50,
+  0x11,0x0F,0x98,0xBC,0xD5,0xAD,0x6E,0x59,0x45,0x58,0xD5,0xA4,0x26,0x35,0x8F,0xB1,
+  0x48,0x21,0x2D,0x7D,0xE9,0x8B,0x14,0xD2,0x32,0x8F,0xC1,0x4C,0x6B,0x5A,0x45,0x58,
+  0xDD,0xEA,0x56,0xB7,0xBC,0x04,0x1E,0xB1,0x00,0x51,0x11,0xCF,0xA7,0x3A,0xB6,0x35,
+  0xCD,0x65,0x0F,0x7B,0x57,0xB4,0xA2,0x31,0x9A,0x28,0xA0,0xA5,0x33,0xDC,0x81,0x02,
+  0x7A,0xA0,0x31,0x20,0x98,0xBD,0xCD,0x6D,0x8D,0x63,0x1C,0xEB,0x14,0x78,0xC4,0x02,
+  0xD3,0xF9,0x16,0xD7,0xB4,0x52,0x14,0x8C,0x24,0xE4,0x1A,0xCB,0xB0,0xC8,0x42,0xAA,
+  0xD1,0x8C,0x6A,0x34,0xA3,0x1A,0xCD,0xA8,0x46,0x33,0x1C,0x51,0x8C,0x66,0x34,0xA3,
+  0x20,0x0B,0x69,0x46,0x41,0x96,0xE1,0x8C,0xE1,0x24,0xA4,0x19,0xC2,0x2A,0x8A,0x33,
+  0x82,0x32,0xB4,0x07,0x15,0x0B,0x32,0xC9,0x89,0xCA,0x98,0x40,0x25,0x16,0x53,0x00,
+  0x3F,0xD0,0xCE,0xB7,0xB8,0xA6,0x95,0xA2,0x14,0x03,0x22,0x09,0x21,0x06,0x34,0x96,
+  0x41,0x8C,0x87,0x2C,0x64,0x18,0xCF,0x68,0xC6,0x30,0x9E,0xD1,0xB4,0x65,0x34,0x6D,
+  0x19,0x4D,0x5B,0x46,0x33,0x86,0xF1,0x90,0x85,0x0C,0x03,0x1A,0xCB,0x20,0x06,0x44,
+  0x12,0x42,0x8C,0xA8,0x14,0xA5,0x18,0x52,0xE3,0xD6,0x77,0x00,0xE2,0x18,0x8D,0x68,
+  0xC2,0x13,0x9E,0xF0,0x84,0x46,0x34,0x8C,0x76,0xF0,0x53,0x46,0x42,0x92,0x67,0x44,
+  0xC4,0x31,0x10,0x71,0xCC,0x43,0x9C,0xF3,0x10,0xE7,0x38,0xE4,0x39,0x0E,0x79,0x8C,
+  0x43,0x20,0xE3,0x64,0x07,0x03,0xF9,0x28,0xC7,0x17,0x8A,0x51,0x04,0x6C,0x0C,0x65,
+  0x18,0x57,0xC4,0x9E,0x56,0x86,0xB2,0x8D,0x63,0x68,0xE4,0x20,0xD9,0x48,0x86,0x65,
+  0x12,0x33,0x99,0xC4,0x4C,0x26,0x31,0x16,0x39,0x48,0x46,0x0E,0xA2,0x95,0xA1,0x6C,
+  0x0E,0x8B,0x17,0x09,0x8E,0x30,0x30,0x41,0x0C,0x42,0x7C,0xA3,0x1C,0xF1,0x95,0xEA,
+  0x54,0xA9,0x59,0x4D,0x2B,0x5E,0x11,0x7B,0xD9,0xD3,0xDA,0xD6,0xB8,0xE5,0xA5,0x2F,
+  0x81,0x27,0x3C,0x62,0x19,0x0B,0x39,0xCA,0x61,0x86,0x33,0x00,0x7C,0x38,0x83,0x39,
+  0xCA,0x41,0x96,0xB1,0x88,0x27,0x3C,0x60,0xFA,0x92,0xB7,0xB8,0xB6,0x35,0xED,0x65,
+  0x0F,0x8B,0x57,0xB4,0x66,0x35,0xA9,0x3A,0x55,0xE9,0x02,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0x50,0x8A,0x49,0x40,0xA2,0x12,0xCE,0xA8,0x06,0x33,0xAE,0x91,0x7C,0x40,0x18,0x1F,
+  0x20,0xC6,0x07,0x44,0x32,0xAE,0xC1,0x8C,0x6A,0x38,0xA2,0x12,0x90,0x98,0x04,0x3F,
+  0xF8,0xC1,0x0F,0xEC,0x4A,0x90,0xA5,0x12,0x64,0xA9,0x04,0x59,0x2A,0x41,0x7E,0xF0,
+  0x83,0x1F,0x58,0x95,0x20,0x4B,0x25,0xC8,0x52,0x09,0xB2,0x54,0x82,0x00,0x3F,0xF8,
+  0x0F,0xA8,0x3A,0xC6,0x35,0xCD,0x69,0x2F,0x7B,0xD9,0x07,0x48,0xF1,0x01,0x52,0x08,
+  0x53,0x98,0xC2,0x14,0xA6,0x30,0x3F,0x40,0x8A,0x0F,0x10,0x3F,0xF8,0xC1,0x0F,0xA4,
+  0x62,0x90,0x85,0x24,0x67,0x40,0xCA,0x40,0x68,0x32,0x0E,0x32,0x18,0x82,0x24,0xC4,
+  0x18,0x44,0x31,0x48,0x32,0x8A,0x61,0x10,0x83,0x24,0xA3,0x18,0xC7,0x38,0x08,0x32,
+  0x8A,0x71,0x90,0x63,0x20,0xA3,0x18,0x07,0x39,0xC8,0x31,0x8A,0x81,0x10,0x83,0x1C,
+  0xA3,0x18,0x48,0x31,0x48,0x31,0x8C,0x91,0x94,0xE1,0x0C,0xC4,0x20,0x09,0x45,0x86,
+  0x82,0x04,0x74,0x15,0xA3,0x00,0xF5,0x09,0x4F,0x78,0xC2,0x13,0x9E,0xF0,0x84,0x27,
+  0x3C,0xE1,0x09,0x4F,0x78,0xC2,0x13,0x9E,0xF0,0x84,0x27,0x3C,0xE1,0x09,0x4F,0x78,
+  0xC2,0x13,0x9E,0xF0,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0x30,0x0A,0x49,0x20,0xC3,0x10,
+  0x94,0x38,0x46,0x31,0xA8,0x61,0x0C,0x62,0x58,0xA3,0x18,0xC2,0x07,0xC2,0x30,0x82,
+  0x0F,0x0C,0x61,0x08,0x1F,0x08,0xC3,0x20,0x86,0x35,0x8A,0x51,0x0C,0x6A,0x18,0xC3,
+  0x10,0x94,0x38,0xC6,0x21,0x24,0x81,0x0C,0x3F,0xF8,0xC1,0x0F,0x7E,0x50,0x8A,0x52,
+  0x94,0x83,0x1C,0xE3,0x07,0x46,0xF1,0x01,0x62,0x7C,0x60,0x20,0xC3,0x1C,0xA6,0x38,
+  0x05,0x3F,0xF8,0xC1,0x0F,0x7E,0xA0,0x8B,0x53,0x98,0xC3,0x1C,0xC8,0x07,0x86,0xF1,
+  0x01,0x52,0x7C,0x60,0x8C,0x83,0x1C,0xA5,0x28,0x05,0x3F,0x20,0x47,0x39,0xCA,0x51,
+  0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x30,0x0C,0x63,0x08,
+  0xDD,0x08,0x46,0x30,0xBC,0x04,0x1E,0xB1,0x90,0xA3,0x1C,0x66,0x00,0x3F,0x28,0x83,
+  0x39,0xCA,0x41,0x16,0xF1,0x80,0xC9,0x1B,0xC1,0x08,0x46,0x17,0x86,0x31,0x84,0x70,
+  0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x00,
+  0x3F,0xE0,0xEA,0x54,0xA7,0x5A,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,
+  0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x0E,0x3F,0x28,0x83,
+  0x39,0xCA,0x41,0x16,0xF1,0x80,0xC9,0x1B,0xC1,0x08,0x46,0x17,0x86,0x31,0x84,0x70,
+  0x94,0xA3,0x1C,0xE5,0x08,0xC3,0x30,0x86,0xD0,0x8D,0x60,0x04,0xC3,0x4B,0xE0,0x11,
+  0x0B,0x39,0xCA,0x61,0x06,0x3F,0x40,0x42,0x39,0xC6,0x02,0x22,0x4F,0x71,0x4C,0x73,
+  0x18,0xAC,0xE6,0x54,0xA3,0x3B,0xD5,0x6A,0x5E,0x31,0x7B,0x5B,0xEB,0xD6,0x97,0xC2,
+  0x33,0x96,0x72,0x9C,0x01,0x71,0x38,0x47,0x59,0x46,0x04,0x2A,0x8F,0x71,0x4E,0x83,
+  0xD8,0xAC,0xEA,0x74,0xA3,0x3A,0xCD,0x2A,0x5E,0x2F,0x6B,0xDB,0xEA,0xD2,0x77,0xC2,
+  0x32,0x8E,0x32,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x64,0x95,0x20,0x4B,
+  0x25,0xC8,0x52,0x09,0xB2,0x54,0x82,0x00,0x3F,0xF8,0xC1,0x0F,0x18,0x23,0xAE,0x6E,
+  0x75,0xAB,0x33,0x3F,0xF8,0xC1,0x0F,0x5A,0x23,0xAE,0x6E,0x75,0xAB,0x33,0xFC,0x28,
+  0x47,0x37,0x8A,0x71,0x08,0x6A,0x14,0x63,0x30,0xD4,0x28,0x18,0x35,0x06,0x66,0xB9,
+  0xCB,0x59,0x4D,0x18,0x14,0x2B,0x06,0x65,0x86,0x51,0x8C,0x43,0x2C,0xE2,0x18,0xC5,
+  0x18,0x0C,0x35,0x0A,0x46,0x0D,0xA1,0x59,0xEE,0x72,0x16,0x1B,0x06,0xC5,0x8A,0x41,
+  0x99,0x61,0x14,0x83,0x12,0xC7,0x28,0x46,0x37,0x8A,0xD1,0x0D,0x3F,0xF8,0x41,0x4F,
+  0x20,0xF3,0x8C,0x07,0x39,0xC3,0x51,0xCD,0x68,0x58,0x33,0x18,0x42,0x14,0x66,0x2C,
+  0xC4,0x28,0xCB,0x58,0x06,0x42,0x96,0x91,0x7C,0x40,0x1C,0x1F,0x10,0xC9,0x50,0x48,
+  0x32,0x96,0xB1,0x90,0x83,0x2C,0x83,0x29,0x04,0x69,0xC6,0xD2,0x9A,0xC1,0x2C,0x67,
+  0x34,0x29,0x2C,0x47,0xA1,0x02,0x93,0x22,0xB1,0x2C,0x87,0x28,0xA4,0x18,0x0D,0x59,
+  0x04,0x32,0x16,0xC2,0x88,0x44,0x24,0xC4,0x11,0x89,0x40,0xC8,0x33,0x8E,0x61,0x94,
+  0x68,0x14,0xC3,0x20,0xD3,0x22,0x4A,0x95,0x08,0x92,0x95,0x82,0x88,0x84,0x28,0x1A,
+  0x19,0x92,0x55,0x86,0x45,0x91,0x62,0x14,0x43,0x2A,0x85,0x40,0x06,0x44,0x0E,0x91,
+  0x88,0x87,0x20,0x22,0x11,0x0D,0x51,0xC6,0x31,0x18,0xC2,0x8C,0x62,0x30,0xA4,0x59,
+  0x8C,0x80,0x52,0x13,0xA6,0x02,0x95,0x01,0x55,0xC7,0x36,0x97,0x95,0xC2,0x3C,0x85,
+  0x18,0x09,0x69,0xDA,0x42,0x16,0xB7,0x90,0xE5,0x2D,0x43,0x21,0x44,0x52,0x86,0x32,
+  0x10,0x84,0x0C,0x65,0x1C,0xEA,0x18,0xCA,0x30,0x88,0x70,0x8A,0xA1,0x10,0x82,0x10,
+  0x67,0x18,0xCB,0x3A,0x8C,0x30,0x98,0x94,0x24,0xE7,0x2C,0xE8,0x29,0x8E,0x11,0xCF,
+  0x97,0x32,0x15,0x90,0x2C,0x0D,0x23,0x3B,0x86,0xC8,0x88,0x12,0x00,0x3F,0xF8,0xC1,
+  0x0F,0x7E,0xF0,0x03,0xD7,0x88,0xAB,0x5B,0xDD,0xEA,0x0C,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xA0,0x2E,0x2D,0x56,0x35,0xCA,0x0E,0x5A,0x10,0x63,0x22,0xA3,0x94,0xAA,0x20,0xE5,
+  0x2A,0x07,0xC9,0x88,0x41,0x36,0x52,0x8C,0x6E,0x10,0xA4,0x23,0xC3,0xF8,0xC6,0x30,
+  0xBE,0x01,0x3F,0xD0,0xC7,0x37,0x86,0xF1,0x8D,0x81,0x74,0x84,0x18,0xDD,0x28,0xC8,
+  0x46,0x0C,0x92,0x91,0xA3,0x5C,0x05,0x29,0x55,0x51,0x4C,0x64,0x18,0xB4,0x20,0x27,
+  0x47,0xB5,0x8A,0xDA,0x02,0x3F,0xF8,0xC1,0x20,0x48,0x52,0x8E,0x92,0x10,0xC3,0x1B,
+  0x03,0xF1,0x86,0x60,0x3C,0x11,0x94,0x8C,0x1C,0x62,0x33,0x45,0xE0,0x4C,0x11,0x38,
+  0x72,0x08,0x51,0x04,0xE5,0x1B,0x82,0xE9,0xC6,0x40,0x3A,0x42,0x8C,0x6E,0x90,0xC4,
+  0x14,0x3F,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x07,0x57,
+  0xA7,0x3A,0x55,0x6E,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x00,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x20,0x86,0x10,0x9C,0x19,0x06,0xB7,0xBA,
+  0xD5,0x29,0x0F,0x01,0x3F,0xF8,0x01,0x3D,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,
+  0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x07,0x3F,0xF8,0xC1,
+  0x0F,0x7E,0xF0,0x83,0x1F,0x20,0x46,0x34,0xA2,0x11,0x8D,0x68,0x44,0x03,0x3F,0x70,
+  0x42,0x39,0xC6,0x12,0x1A,0xD0,0x80,0x06,0x34,0xA0,0x01,0x0D,0x68,0xC2,0x12,0x96,
+  0xD0,0x80,0x06,0x34,0xA0,0x01,0x0D,0x68,0x40,0x13,0x96,0x71,0x94,0x01,0x3F,0xF0,
+  0x94,0x26,0x29,0x1B,0xE1,0xE7,0x30,0xA7,0x29,0x52,0x61,0x08,0x45,0x16,0x62,0x11,
+  0x65,0x60,0x43,0x19,0xD8,0x50,0x06,0x36,0x94,0x81,0x0D,0x85,0x58,0x64,0x21,0x14,
+  0x61,0x8A,0x54,0x9A,0xC3,0x9C,0x07,0x47,0x96,0x92,0x9A,0x02,0x3F,0xF8,0x07,0x35,
+  0x9C,0x41,0x0D,0x47,0x54,0xC3,0x11,0xD5,0x68,0x46,0x35,0x9A,0x51,0x8D,0x66,0x54,
+  0x83,0x19,0xD6,0x60,0x38,0xC3,0x97,0xBE,0xF4,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,
+  0x39,0xCA,0x51,0x0E,0x3F,0xF8,0x81,0x45,0x18,0x22,0x19,0x66,0x48,0x87,0x19,0x11,
+  0x5A,0x06,0xA4,0x96,0xF1,0x94,0x61,0x2C,0xC3,0x29,0xC4,0x58,0x46,0x43,0x8C,0xB1,
+  0x0C,0x86,0x1C,0x63,0x19,0x0B,0x41,0xC6,0x42,0x12,0x92,0x0C,0x86,0x18,0x45,0x19,
+  0x8C,0x5B,0x46,0xC3,0x98,0xE1,0xA8,0x66,0x40,0xE6,0x19,0x3F,0xF8,0xC1,0x0F,0x9E,
+  0x61,0x0D,0x66,0x58,0x63,0x21,0x16,0x51,0x46,0x32,0x98,0xA1,0x8C,0x64,0x30,0x43,
+  0x19,0xC9,0x60,0x86,0x32,0x92,0xC1,0x0C,0x65,0x24,0x83,0x19,0xCA,0x40,0xCA,0x32,
+  0x14,0x72,0x14,0x85,0x2C,0x84,0x40,0x08,0x61,0x96,0x40,0x8C,0xC2,0x2C,0xC1,0x39,
+  0x89,0x60,0x51,0x39,0x14,0x68,0x00,0x3F,0x28,0xC9,0x58,0xC2,0x03,0x22,0xAF,0x08,
+  0xA3,0x2B,0xC3,0xD8,0x4A,0x31,0xB4,0x62,0x0C,0xAC,0x20,0xE3,0x2A,0xC9,0xA8,0xCA,
+  0x32,0xA8,0xC2,0x8C,0xA9,0x2F,0x7D,0xE9,0x4B,0xEF,0x46,0x39,0xCA,0x51,0x0E,0x3F,
+  0xF8,0xC1,0x0F,0xD0,0xB1,0xB4,0x66,0x2C,0xCD,0x19,0x4A,0x73,0x86,0x32,0x8E,0xE1,
+  0x0C,0x65,0x1C,0xC3,0x19,0xCA,0x38,0x86,0x33,0x94,0x71,0x90,0x66,0x28,0x03,0x19,
+  0x0C,0x51,0x06,0x42,0x14,0xB2,0x8C,0xA4,0x18,0x66,0x19,0x09,0x64,0x86,0xE2,0x9A,
+  0xB1,0xB0,0xEF,0x00,0x3F,0xF8,0xC1,0xB1,0xB4,0x58,0x55,0xE9,0x42,0x87,0x28,0xC2,
+  0x71,0x8A,0x31,0x90,0xC2,0x90,0x63,0x2C,0x83,0x19,0x88,0x60,0x88,0x42,0x8E,0xD1,
+  0x0C,0x65,0x20,0xA3,0x19,0xCA,0x40,0x46,0x33,0x94,0x81,0x8C,0x66,0x28,0x03,0x21,
+  0x0B,0x51,0x06,0x52,0x12,0xB2,0x10,0xC4,0x18,0x85,0x19,0xC9,0x6B,0x46,0xE2,0xB8,
+  0xF5,0x19,0x3F,0xF8,0x41,0x49,0x48,0x42,0x12,0x6B,0x2C,0x64,0x32,0x0B,0x89,0xD0,
+  0x42,0x1E,0xB5,0x90,0x26,0x39,0x64,0x41,0x11,0x49,0x0E,0x45,0x8E,0x63,0x91,0xE2,
+  0x60,0x64,0x38,0x1A,0x11,0x0C,0xA7,0x3C,0x04,0x1A,0x91,0x00,0x3F,0xF8,0x01,0x64,
+  0x26,0x73,0x28,0x08,0x15,0xCC,0x51,0x43,0x6B,0x58,0x50,0x8A,0xC2,0x90,0x21,0x21,
+  0x64,0x21,0x86,0x51,0x88,0x32,0x10,0xC2,0x0C,0x65,0x20,0x65,0x19,0xCA,0x48,0xC8,
+  0x32,0x94,0x91,0x14,0x65,0x28,0x03,0x39,0xC9,0x50,0x88,0x81,0x10,0xA2,0x14,0x82,
+  0x04,0xE5,0x18,0xCC,0x1A,0x0C,0x41,0x18,0x45,0x34,0x07,0x19,0x2B,0x2A,0x48,0x0A,
+  0x0D,0x3F,0xF8,0x01,0x61,0xBE,0xC5,0x35,0x65,0x34,0x2F,0x19,0x4C,0x31,0x0C,0x42,
+  0x16,0x92,0x14,0x64,0x28,0x64,0x21,0xC8,0x50,0x46,0x33,0x90,0xA1,0x8C,0x66,0x20,
+  0x43,0x19,0xCD,0x40,0x86,0x32,0x9A,0x71,0x10,0x85,0x30,0x02,0x19,0xCC,0x58,0xC6,
+  0x41,0x98,0x82,0x0C,0xA3,0x38,0x47,0x28,0xC4,0x79,0xB0,0x54,0xAB,0xA8,0x2D,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xDC,0x24,0x66,0x32,0x89,0x99,0x4C,0x62,0x26,0x93,
+  0x98,0xC9,0x24,0x66,0x32,0x89,0x01,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xDC,0x24,
+  0x86,0x10,0x8D,0x49,0xCC,0x30,0x1A,0x93,0x2C,0xC7,0x24,0xCB,0x31,0x89,0x7A,0x4C,
+  0x82,0x00,0x3F,0x30,0xC3,0x19,0xCC,0x51,0x0E,0xB2,0x8C,0x45,0x1C,0xC1,0x08,0x47,
+  0x30,0xC0,0x31,0x8C,0x6F,0x0C,0xC3,0x1B,0xC5,0xE0,0x48,0x41,0xB6,0x71,0x0C,0x8D,
+  0x1C,0x24,0x1B,0xC9,0xC0,0xC6,0x32,0xAE,0xB1,0x0C,0x6B,0x34,0xA3,0x1A,0xCD,0xA0,
+  0xC6,0x33,0x00,0x3F,0x08,0x07,0x31,0xBC,0x41,0x0C,0x6F,0x10,0xC3,0x1B,0xC4,0xF0,
+  0x06,0x31,0xBC,0x41,0x0C,0x6F,0x10,0xC3,0x1B,0xC4,0xF0,0x06,0x31,0xBC,0x41,0x0C,
+  0x6F,0x10,0xC3,0x1B,0xC4,0xF0,0x06,0x31,0xBC,0x41,0x0C,0x6F,0x10,0xC3,0x1B,0xC4,
+  0xF0,0x06,0x31,0xBC,0x41,0x0C,0x6F,0x10,0xC3,0x1B,0xC4,0x00,0x3F,0xE0,0xC6,0x33,
+  0xA8,0xD1,0x8C,0x6A,0x34,0xC3,0x1A,0xCB,0xB8,0xC6,0x32,0xB0,0x91,0x8C,0x8C,0x1C,
+  0x44,0x1B,0xC7,0xD8,0x48,0x41,0xB8,0x51,0x0C,0x6F,0x0C,0xE3,0x1B,0xC3,0x00,0x47,
+  0x30,0xC2,0x11,0x0C,0xB1,0x8C,0x85,0x1C,0xE5,0x30,0xC3,0x19,0x00,0x3F,0xE8,0x8D,
+  0x68,0x44,0x13,0x8E,0x72,0x94,0xC3,0x21,0x04,0x59,0x06,0x63,0x08,0xB2,0x8C,0xE5,
+  0x10,0x64,0x19,0x0A,0x22,0xC8,0x32,0x92,0x72,0x8D,0x64,0x64,0xE4,0x18,0x1A,0x31,
+  0xC8,0x46,0x08,0xC2,0x2D,0x2F,0x7D,0x48,0x2C,0xB6,0xDA,0xDE,0x35,0xA7,0x93,0x98,
+  0xA8,0x3C,0xE4,0x21,0xD3,0x70,0x46,0x35,0x98,0x91,0x9C,0x43,0x30,0xE2,0x60,0xC5,
+  0x50,0x86,0xE1,0x0A,0xA1,0x08,0x83,0x20,0x84,0x10,0x8A,0x28,0xC6,0x32,0x08,0xA1,
+  0x08,0x62,0x30,0x83,0x10,0x8A,0x20,0x04,0x33,0x0A,0xA1,0x8C,0x41,0x28,0xC4,0x10,
+  0xCA,0x18,0x04,0x52,0x0C,0xC1,0x90,0x60,0x14,0x05,0x11,0x8D,0x9D,0x6A,0x35,0x4D,
+  0x61,0x0A,0x53,0x00,0x5F,0x20,0x89,0x68,0xBE,0xD4,0xA9,0x6D,0x6D,0x6A,0x6B,0x59,
+  0x1A,0x86,0x95,0x8C,0x51,0x9D,0x64,0x54,0x84,0x19,0x95,0x51,0x46,0x95,0x8E,0x61,
+  0xA9,0x62,0x64,0x4A,0x18,0x5B,0xF3,0x14,0xB8,0xC0,0xF5,0x25,0xD1,0x90,0xE4,0x0C,
+  0x3F,0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x27,0x3F,0xE3,0x18,0xC9,0x78,0xC6,0x31,0x92,
+  0xF1,0x8C,0x63,0x24,0xE3,0x19,0xC7,0x48,0xC6,0x33,0x8E,0x91,0x8C,0x67,0x1C,0x23,
+  0x19,0xCF,0x30,0x0A,0x32,0x1E,0x52,0x14,0x64,0x3C,0x84,0x18,0xC1,0x30,0x08,0xA4,
+  0x02,0x42,0x90,0x28,0x0D,0x4B,0x3A,0x84,0xA2,0x8A,0x91,0xC2,0x02,0x3F,0x08,0x8F,
+  0xD7,0xB4,0x87,0x45,0xCB,0x1C,0x86,0x2A,0x4B,0x99,0x48,0x43,0x24,0xF2,0x90,0x68,
+  0x44,0x03,0x22,0x11,0x79,0x86,0x44,0x9E,0x31,0x8D,0x67,0x4C,0xE3,0x19,0xD3,0x78,
+  0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,0x21,0xD2,0x80,0x46,0x34,0xA2,0x11,0x8D,
+  0x88,0x40,0x03,0x3F,0xF8,0x41,0x90,0x9F,0xFC,0xE4,0x27,0x3F,0x63,0x1A,0xCF,0x98,
+  0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0x24,0xF2,0x90,
+  0x88,0x40,0x23,0x1A,0x11,0x79,0x48,0x54,0x1A,0x32,0x99,0xC4,0x50,0xD3,0x8A,0x98,
+  0xEB,0x10,0x3F,0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x27,0x3F,0x03,0x19,0xC8,0x78,0x06,
+  0x32,0x90,0xF1,0x0C,0x64,0x20,0xE3,0x19,0xC8,0x40,0xC6,0x33,0x90,0x81,0x8C,0x67,
+  0x20,0x03,0x19,0xCF,0x40,0x06,0x32,0x9E,0x81,0x0C,0x64,0x3C,0x03,0x19,0xC8,0x78,
+  0x06,0x32,0x90,0xF1,0x0C,0x64,0x20,0xE3,0x19,0xD3,0x78,0xC6,0x34,0xCA,0x01,0x3F,
+  0xF8,0xC1,0x0F,0xA4,0xFC,0xE4,0x27,0x3F,0xF9,0x19,0xC8,0xD0,0x06,0x32,0xB4,0x81,
+  0x0C,0x6D,0x20,0x43,0x1B,0xC8,0xD0,0x06,0x32,0xB4,0x81,0x0C,0x6D,0x20,0x43,0x1B,
+  0xC8,0xD0,0x06,0x32,0xB4,0x81,0x0C,0x6D,0x20,0x43,0x1B,0xE5,0x00,0x3F,0x08,0x8F,
+  0xD7,0xB4,0x87,0x45,0xCB,0x1C,0x86,0x2A,0x4B,0x99,0x48,0x43,0x24,0xF2,0x90,0x68,
+  0x44,0x03,0x22,0x11,0x79,0x86,0x44,0x9E,0x31,0x8D,0x67,0x24,0xE3,0x18,0xCF,0x48,
+  0xC6,0x31,0x9E,0x91,0x8C,0x63,0x3C,0x23,0x19,0xC7,0x78,0x46,0x32,0x8E,0xF1,0x10,
+  0xA4,0x41,0x03,0x61,0xD1,0x40,0x58,0x44,0x0E,0x06,0x3F,0xF8,0x41,0x90,0x9F,0xFC,
+  0xE4,0x27,0x6B,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,
+  0x5A,0x7E,0xF2,0x93,0x9F,0x0C,0x3F,0xF8,0x41,0x30,0xA6,0xF1,0x8C,0x69,0x3C,0x63,
+  0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0x4F,0x7E,0xF2,0x93,
+  0x9F,0xFC,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,
+  0x63,0x1A,0xCF,0x98,0x06,0x3F,0xF8,0x81,0x35,0xCA,0x01,0x8D,0x69,0x3C,0x63,0x1A,
+  0xCF,0x98,0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0x24,
+  0xF2,0x0C,0xA8,0x40,0x18,0xBA,0x91,0x95,0x28,0x3F,0xF8,0x41,0x90,0x9F,0xFC,0xE4,
+  0x27,0x6F,0xA1,0x24,0xA3,0x01,0x93,0x57,0x02,0xB3,0x95,0xC1,0x60,0xA6,0x30,0x96,
+  0x41,0xCA,0x74,0x94,0x22,0x95,0xC6,0x40,0xE4,0x31,0xCF,0x88,0xCA,0x23,0x26,0xF2,
+  0x84,0x6A,0x98,0xE2,0x0C,0x3F,0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x27,0x97,0xA3,0x1C,
+  0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0x00,
+  0x3F,0xC0,0xF2,0x93,0x9F,0xFC,0x94,0x11,0x89,0x49,0x4C,0x62,0x12,0x93,0x68,0xC6,
+  0x02,0xA2,0x0E,0x75,0xA8,0x43,0x1D,0x02,0xCB,0x98,0x9F,0xFC,0x64,0x3F,0xF8,0x41,
+  0x90,0x9F,0xFC,0xE4,0xE7,0x8C,0x47,0x44,0xE2,0x11,0x91,0x78,0x44,0x24,0x22,0xF1,
+  0x88,0x48,0x3C,0x22,0x7A,0xF2,0x93,0x9F,0x0C,0x77,0xEA,0x5A,0x16,0xAD,0x49,0x99,
+  0xC4,0x48,0xA5,0x29,0x11,0x79,0x08,0x44,0x22,0xF2,0x8C,0x69,0x3C,0x63,0x1A,0xCF,
+  0x98,0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0x0F,0x89,0x08,0x44,0x1E,0x12,
+  0x95,0xA6,0x48,0x26,0x31,0xD4,0xB4,0x62,0xD6,0xBA,0x04,0x3F,0xF8,0x41,0x9A,0x9F,
+  0xFC,0xE4,0x27,0x3F,0x43,0x19,0xD8,0x50,0x06,0x36,0x94,0x81,0x0D,0x65,0x60,0x43,
+  0x19,0xD8,0x50,0x06,0x36,0x12,0x82,0x8D,0x64,0x64,0xE4,0x20,0x1A,0x29,0x8A,0xD6,
+  0xB8,0xD5,0x29,0xD0,0x00,0x77,0xEA,0x5A,0x16,0xAD,0x49,0x99,0xC4,0x48,0xA5,0x29,
+  0x11,0x79,0x08,0x44,0x22,0xF2,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0xA6,
+  0xF1,0x8C,0x69,0x3C,0x63,0x22,0x0E,0x89,0x8C,0x43,0x1E,0xD4,0x94,0x46,0x35,0x26,
+  0x31,0x02,0x71,0x26,0x41,0x9C,0x58,0x10,0xA8,0x21,0x24,0x4A,0xCA,0x28,0x03,0x3F,
+  0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x27,0x3F,0x23,0x19,0xD9,0x48,0x46,0x36,0x92,0x91,
+  0x8D,0x64,0x64,0x23,0x29,0xD7,0x40,0x8E,0x35,0x10,0x54,0x11,0x63,0x4D,0x85,0x20,
+  0xC2,0x99,0x18,0x61,0xA4,0x65,0x9C,0x28,0x21,0x66,0x2A,0x0C,0x29,0x87,0x29,0x00,
+  0x3F,0xF8,0x41,0x51,0x16,0x32,0xA1,0x84,0x48,0x49,0x19,0xD1,0x4A,0x46,0x34,0x08,
+  0x92,0x90,0x87,0x14,0x24,0x19,0xCF,0x30,0x48,0x32,0x9E,0x71,0x10,0x64,0x3C,0xE3,
+  0x20,0xC8,0x78,0xC6,0x41,0x90,0xF1,0x0C,0x84,0x1C,0xE3,0x19,0x08,0x39,0xC6,0x33,
+  0x10,0x62,0x90,0x87,0x20,0xA4,0x18,0xD1,0x40,0xCA,0x40,0xA2,0x81,0x2C,0x69,0x24,
+  0xEA,0x43,0x61,0x01,0xC7,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,
+  0x28,0x47,0x99,0x9F,0xFC,0xE4,0x27,0x3F,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,
+  0x8E,0x72,0x94,0xA3,0x1C,0x3F,0xF8,0x41,0x30,0xAB,0x3A,0xDD,0xE8,0x92,0xA5,0x1C,
+  0x25,0x29,0x47,0x39,0xCA,0x51,0x8E,0x72,0x90,0x64,0x24,0x63,0x81,0x6E,0x74,0xA3,
+  0x3A,0x4D,0x47,0x38,0x09,0x69,0xC4,0xF4,0x2D,0x70,0x7D,0x0B,0x5C,0xDF,0x02,0xD7,
+  0xA7,0xC2,0x33,0x16,0x10,0x75,0x6A,0x53,0x9C,0xDA,0xD4,0xB6,0x36,0xD5,0xA5,0xCF,
+  0x88,0x84,0x0C,0xC7,0x28,0x95,0x07,0x33,0x9B,0xC5,0x6E,0x91,0x04,0x44,0x1B,0xC3,
+  0x58,0xB6,0xBA,0x13,0x9E,0x90,0x79,0xCE,0x73,0x5F,0x1A,0x8B,0xA7,0x30,0x28,0xC9,
+  0xE9,0x65,0xE9,0x1B,0x5F,0x78,0x82,0x25,0x1E,0x41,0x8D,0x67,0x48,0xE4,0x29,0x4E,
+  0x81,0x0C,0x53,0xA4,0x93,0x14,0xEA,0x18,0x05,0x33,0x44,0xD1,0x4E,0x50,0x38,0x05,
+  0x1E,0xF1,0x80,0xC9,0x23,0xC1,0xD1,0xCA,0x70,0xB0,0x62,0x18,0x8B,0x24,0x47,0x2A,
+  0xCB,0x81,0x8A,0x63,0x9E,0x11,0x95,0x47,0x50,0xE3,0x09,0x96,0x38,0x03,0x6F,0x38,
+  0x85,0x49,0xC8,0x32,0x9E,0xD1,0x8C,0x67,0x34,0xE3,0x11,0xCF,0x08,0xB3,0xA7,0xB9,
+  0xEC,0x5D,0x06,0x34,0xA1,0x01,0x0D,0x68,0x42,0x23,0x12,0x52,0x98,0x01,0x3F,0x68,
+  0xC9,0x33,0xA2,0xF2,0x0C,0xC8,0x3C,0xE3,0x39,0xCF,0x70,0xD0,0x33,0x18,0x13,0x8C,
+  0x67,0x2C,0x65,0x18,0xCF,0x50,0x0A,0x31,0x9E,0x91,0x94,0x62,0x3C,0xE3,0x30,0xC6,
+  0x78,0x86,0x61,0x8E,0xF1,0x8C,0xA2,0x24,0xE3,0x19,0x44,0x51,0xC6,0x33,0x86,0xB2,
+  0x8C,0x67,0x04,0x86,0x19,0x0F,0x72,0xC6,0x73,0x9E,0xF1,0x18,0x68,0x3C,0x25,0x1A,
+  0x0F,0x91,0x06,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xF7,0x03,0x66,0xF8,0x80,0x19,
+  0x3E,0x60,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,
+  0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x0D,0x69,0x38,0x47,0x59,0x48,
+  0x43,0x1A,0xD2,0x90,0x86,0x34,0xA4,0x21,0x0D,0x59,0xCA,0x42,0x1A,0xD2,0x90,0x86,
+  0x34,0xA4,0x21,0x0D,0x69,0xC8,0x52,0x8E,0x33,0x00,0x3F,0xD0,0xC7,0x37,0x86,0xF1,
+  0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,
+  0xDF,0x18,0xC6,0x37,0x86,0x0F,0x98,0xE1,0x03,0x66,0xF8,0x80,0x01,0x3F,0x50,0x03,
+  0x49,0x44,0x03,0x1E,0xEF,0x7C,0xC7,0x3B,0xDF,0xF1,0x90,0x77,0xC6,0x33,0x1E,0xF2,
+  0x8C,0x67,0x3C,0xE3,0x19,0x0F,0x59,0xCA,0x71,0x06,0xE0,0x28,0x47,0x39,0xCA,0x51,
+  0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,
+  0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xF0,0x83,0x22,0x9C,0xC2,0x14,0xE6,0x30,0x87,0x29,0xCE,0x00,0x3F,0xF8,0x81,0x54,
+  0x42,0x64,0x91,0x42,0x55,0xC3,0x50,0xD5,0x28,0x08,0x41,0xA6,0x61,0x8C,0x82,0x4C,
+  0xA3,0x20,0xC6,0x98,0x46,0x31,0x8E,0x31,0x8D,0x62,0x1C,0x63,0x1A,0xC5,0x38,0xC6,
+  0x34,0x8A,0x61,0x0C,0x6A,0x14,0xC3,0x18,0x14,0x21,0x46,0x31,0x2A,0x79,0x4D,0x4B,
+  0x5E,0x92,0x24,0xE5,0x28,0x47,0x29,0x00,0x3F,0xD0,0x7F,0xF2,0x93,0x9F,0x78,0x4C,
+  0x28,0xE3,0x1A,0xCC,0xA8,0x46,0x33,0xAA,0xE1,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,
+  0xC6,0x33,0xA6,0xE1,0x90,0x89,0x30,0xA4,0x2A,0x88,0xA9,0xE4,0x05,0x33,0xD7,0x21,
+  0x3F,0xF8,0x01,0x73,0x3E,0xA6,0x3D,0x2C,0x5E,0xE5,0x28,0x56,0x49,0x4A,0x45,0x16,
+  0x42,0x91,0x86,0x4C,0xC3,0x21,0xD3,0x78,0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,
+  0x19,0xD3,0x78,0xC6,0x34,0x9E,0x31,0x91,0x86,0x50,0xA3,0x19,0xD5,0x68,0x06,0x3F,
+  0x18,0x91,0xC7,0x34,0x78,0xC9,0xCA,0x20,0xA5,0x22,0x0C,0x99,0x88,0x33,0xA6,0xF1,
+  0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xE1,0x8C,0x6A,0x34,0xA3,0x1A,
+  0xCC,0xB8,0x86,0x32,0x98,0x9F,0xFC,0xE4,0x27,0x1F,0x3F,0xF8,0x01,0x73,0x3E,0xA6,
+  0x3D,0x2C,0x5A,0x46,0x18,0x82,0xA9,0x08,0x31,0x08,0x52,0x8D,0x62,0x14,0x83,0x1A,
+  0xC6,0x28,0xC8,0x34,0x8C,0x61,0x8C,0x69,0x18,0xC3,0x18,0xD3,0x30,0x86,0x31,0xA6,
+  0x61,0x0C,0x63,0x4C,0xA4,0x18,0xC6,0xA0,0x08,0x31,0x8C,0x41,0x2D,0x63,0x54,0xAA,
+  0x18,0x57,0x2A,0x86,0x66,0x8A,0x01,0x3F,0xF8,0x41,0x31,0xCA,0x51,0x8E,0x72,0x94,
+  0xA3,0x1C,0xDF,0x5E,0xFA,0xD2,0x15,0xAF,0x90,0x62,0x6C,0xC4,0x18,0xDB,0x38,0xC6,
+  0x36,0x8E,0xB1,0x8D,0x63,0x6C,0xE3,0x18,0xDB,0x38,0xC6,0x36,0x8E,0xB1,0x8D,0x63,
+  0x6C,0xC4,0x18,0xDC,0x00,0x3F,0x18,0x91,0xC7,0x34,0x68,0x0C,0x47,0x16,0xA3,0x31,
+  0x48,0x29,0x46,0x43,0x96,0x52,0x8C,0x85,0x34,0xA4,0x18,0xCB,0x78,0x46,0x31,0x96,
+  0xF1,0x8C,0x62,0x2C,0xE3,0x19,0xC5,0x58,0xC6,0x33,0x8A,0xB1,0x0C,0x67,0x18,0x83,
+  0x19,0xCD,0x28,0x08,0x33,0x98,0x61,0x0C,0x67,0x28,0xC2,0x28,0xCC,0x6E,0xB4,0x93,
+  0x9F,0x0B,0x3F,0xF8,0xC1,0xF8,0x93,0x9F,0xFC,0xE4,0x5F,0x83,0x1C,0xE4,0x20,0x47,
+  0x29,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x2C,0x63,0xA5,0x68,0x35,0xAF,0x08,0x3F,0xF8,
+  0x41,0x31,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0xD8,0x4A,0x31,0xB6,0x52,0xD4,
+  0xA4,0x14,0x35,0x29,0x45,0x4D,0x4A,0x51,0x01,0x3F,0xF8,0x81,0x37,0x98,0x61,0x0D,
+  0x66,0x5C,0x63,0x19,0xD7,0x58,0xC6,0x35,0x96,0x71,0x8D,0x65,0x5C,0x63,0x19,0xD7,
+  0x58,0x86,0x45,0x82,0x52,0x8C,0x8A,0x08,0xA5,0xE0,0x42,0x29,0xF6,0x50,0x0A,0x4D,
+  0x94,0x02,0x03,0x3F,0xF8,0xC1,0xF8,0x93,0x9F,0xFC,0xE4,0x73,0xA2,0x24,0xA3,0x01,
+  0x93,0xB7,0x38,0x23,0x14,0xCD,0x10,0xE5,0x3A,0x86,0xA9,0x0C,0x62,0x28,0xB2,0x98,
+  0x69,0x34,0x65,0x12,0x0F,0x99,0x42,0x34,0x4C,0x71,0x06,0x3F,0xF8,0xC1,0x38,0xCA,
+  0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0xF9,0x93,0x9F,0xFC,0xE4,0x03,0x3F,
+  0xE0,0xEA,0x54,0xA7,0x6A,0x91,0x71,0x90,0x83,0x1C,0xE5,0x28,0x47,0x59,0x29,0x6A,
+  0x49,0x8B,0x8C,0x83,0x1C,0xE4,0x28,0x47,0x59,0x29,0x5A,0x4D,0x3F,0xF8,0x41,0x5B,
+  0xA7,0x3A,0xD5,0xA9,0x5E,0x83,0x1C,0xE4,0x20,0x47,0x29,0xCA,0x51,0x8E,0x72,0x94,
+  0xA3,0x2C,0x63,0xA5,0x68,0x35,0xAF,0x08,0x3F,0x18,0x8F,0xD7,0xB4,0x87,0x45,0xCB,
+  0x1C,0xA6,0x22,0x0B,0xA1,0x48,0x43,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,
+  0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x22,0x0D,0xA1,0xC8,0x42,0x2A,0x73,0x18,
+  0x2B,0x62,0x4F,0x6B,0xDE,0x01,0x3F,0xF8,0x41,0xDB,0x97,0xBE,0xF4,0xA5,0x3B,0x43,
+  0x19,0xD7,0x60,0x46,0x35,0x9A,0x51,0x0D,0x67,0x4C,0xE3,0x19,0xD3,0x78,0xC6,0x34,
+  0x9E,0x31,0x0D,0x87,0x4C,0x84,0x21,0x55,0x41,0x4C,0x25,0x2F,0x98,0xB9,0x0E,0x01,
+  0x3F,0x18,0x91,0xC7,0x34,0x78,0xC9,0xCA,0x20,0xA5,0x22,0x0C,0x99,0x88,0x33,0xA6,
+  0xF1,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xE1,0x8C,0x6A,0x34,0xC2,
+  0x1A,0x8C,0xC0,0x86,0x22,0x30,0xBE,0xF4,0xA5,0x2F,0x1D,0x3F,0xF8,0xC1,0x0F,0xFC,
+  0x3A,0xD5,0xA9,0x4E,0xF5,0x1A,0xE4,0x20,0x07,0x39,0xCA,0x41,0x8E,0x72,0x94,0xA3,
+  0x1C,0xE5,0x09,0x4F,0x78,0x00,0x3F,0xF8,0x41,0x45,0xAE,0x92,0x0C,0xEB,0x20,0xA3,
+  0x4A,0x07,0xA1,0x12,0x32,0xA8,0x31,0x90,0x63,0x4C,0x64,0x20,0xC7,0x98,0x46,0x31,
+  0x8E,0x31,0x8D,0x82,0x18,0x63,0x1A,0x05,0x31,0xC6,0x34,0x8C,0x61,0x8C,0x69,0x18,
+  0xA4,0x18,0xD3,0x30,0x08,0x41,0xA6,0x71,0x10,0x81,0x50,0xC4,0x50,0xD5,0x38,0x90,
+  0x35,0x8E,0x33,0x12,0x3F,0xF8,0x41,0x31,0xCA,0x51,0x8E,0x72,0x94,0x23,0xAC,0xD3,
+  0x8D,0x30,0x84,0xA9,0xD1,0x94,0x69,0x38,0x64,0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xF1,
+  0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,0x03,0x3F,
+  0xF8,0x41,0x21,0xAD,0x59,0x51,0xAA,0x92,0xA4,0x1C,0xE5,0x28,0x47,0x39,0xC8,0x41,
+  0x0E,0x92,0x8C,0xE3,0xAA,0x53,0x9D,0xEA,0x54,0x01,0x73,0x38,0x09,0x69,0x44,0x14,
+  0x2A,0x50,0x81,0x2A,0x54,0xA0,0x0A,0x91,0x68,0xC6,0x12,0x1E,0x2F,0x71,0x8A,0x4B,
+  0x9C,0xDA,0x56,0x87,0x40,0x23,0x12,0x32,0x00,0xCB,0x28,0x11,0xD8,0xB6,0xA9,0x41,
+  0x4F,0x8D,0x05,0x44,0x5C,0xDA,0xD4,0x96,0xBE,0x32,0x96,0x31,0x81,0x2C,0x64,0x60,
+  0x1A,0x0B,0x88,0xB6,0x66,0xB9,0x8B,0x71,0x27,0x14,0x3F,0xE0,0xC2,0x14,0x26,0x11,
+  0x89,0x69,0x3C,0x63,0x2A,0x4B,0x99,0x4C,0x52,0xAA,0x53,0x98,0xEB,0x0C,0x65,0x33,
+  0x41,0xE9,0x12,0x78,0xC6,0xF3,0xA9,0xAE,0x04,0x46,0x2B,0xC4,0xB9,0x8A,0x71,0xA8,
+  0xA2,0x98,0x89,0x30,0x65,0x12,0xD0,0x98,0x82,0x24,0xCE,0x00,0x73,0x38,0xC7,0x35,
+  0x16,0x43,0x8D,0x05,0x49,0x63,0x51,0xD0,0x68,0x94,0x33,0xA0,0xB4,0x10,0x49,0x1D,
+  0xA4,0x52,0x43,0xC1,0x1E,0xB7,0x3C,0xD4,0xA5,0x2E,0x75,0xC8,0x43,0x1E,0xF2,0x90,
+  0x87,0xC0,0x32,0x8E,0x32,0x00,0x3F,0xF8,0x41,0x31,0x1C,0x32,0x8D,0xA6,0x4C,0x83,
+  0x31,0xD3,0x58,0xCE,0x34,0x14,0x34,0x8D,0xA4,0x04,0x63,0x1A,0x48,0x11,0xC6,0x34,
+  0x8E,0x32,0x8C,0x69,0x18,0x85,0x18,0xD3,0x28,0x4A,0x31,0xA6,0x41,0x14,0x63,0x4C,
+  0x63,0x28,0xC7,0x98,0x86,0x50,0x90,0x31,0x8D,0xA0,0x24,0x63,0x42,0xCA,0x98,0xCE,
+  0x32,0x26,0xC3,0x8C,0xA9,0x34,0x63,0x22,0xCE,0x00,0x3F,0xF8,0xC1,0x0F,0xBA,0x51,
+  0x8E,0x72,0x94,0x83,0x2C,0xD6,0x29,0x4E,0x71,0x10,0x18,0x40,0x23,0x06,0xB1,0x80,
+  0x03,0x24,0x48,0x71,0x0C,0x53,0x90,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,
+  0xF1,0x8D,0x61,0x7C,0x03,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0x1F,0x30,
+  0xC3,0x07,0xCC,0xF0,0x01,0x03,0x3F,0xF8,0xC1,0x38,0xBE,0x31,0x8C,0x6F,0x0C,0xE3,
+  0x1B,0xC3,0xF8,0xC6,0x30,0xBE,0x31,0x90,0xE2,0x14,0xA7,0x20,0x04,0x1C,0x60,0x11,
+  0x83,0x68,0xC0,0x00,0x22,0xA7,0x38,0xC5,0xB1,0x0A,0x39,0xCA,0x51,0x8E,0x72,0x00,
+  0xFE,0x18,0x8B,0x68,0x42,0x42,0x8E,0x72,0x94,0xA3,0x24,0xE5,0x28,0x49,0x39,0xCC,
+  0x51,0x92,0x72,0x94,0xA4,0x1C,0xE5,0x28,0x07,0x49,0x42,0x23,0x96,0x71,0x00,0x3F,
+  0xF8,0xC1,0x0F,0xA4,0xFC,0x84,0x2B,0x3C,0xE1,0x0A,0x4F,0xB8,0xC2,0x13,0xAE,0xF0,
+  0x84,0x2B,0x3C,0xE1,0x0A,0x4F,0xB8,0xC2,0x13,0xAE,0xF0,0x84,0x2B,0x3C,0xE1,0x0A,
+  0x4F,0xB8,0xC2,0x13,0xAE,0xF0,0x64,0x3F,0x08,0x8F,0xD7,0xB4,0x87,0x45,0xCB,0x1C,
+  0x86,0x2A,0x4B,0x99,0x48,0x43,0x24,0xF2,0x90,0x68,0x44,0x03,0x22,0x11,0x31,0xC4,
+  0x31,0x24,0x12,0x88,0x41,0x1C,0x63,0x32,0x83,0x38,0xC6,0x44,0x02,0x21,0x88,0x63,
+  0x4C,0x43,0x30,0xC7,0x98,0xC6,0x40,0x90,0x31,0x0D,0x42,0x24,0x63,0x1A,0x0F,0x91,
+  0x06,0x34,0xA2,0x11,0x8D,0x68,0x44,0x04,0x1A,0x3F,0xF8,0x41,0x21,0xAD,0x59,0x51,
+  0xAA,0x32,0xA3,0x22,0xCC,0xB0,0x06,0x33,0xAC,0x51,0x8E,0x72,0x90,0x83,0x1C,0x24,
+  0x71,0x86,0x34,0xA0,0x41,0x54,0x66,0x10,0x75,0xAA,0x53,0x05,0x3F,0xF8,0x01,0x73,
+  0x3E,0xA6,0x3D,0x2C,0x5A,0x46,0x18,0x82,0xA9,0x08,0x31,0x08,0xF2,0x84,0x62,0x14,
+  0xA3,0x18,0x8E,0x20,0x86,0x31,0x0A,0xC2,0x0C,0x62,0x18,0xC3,0x18,0x0A,0x29,0x86,
+  0x31,0x8C,0x91,0x10,0x63,0x18,0xC3,0x18,0xC9,0x38,0x86,0x31,0x8C,0x91,0x08,0x84,
+  0x14,0xC3,0x18,0x49,0x50,0x08,0x31,0x8C,0x41,0x2D,0x63,0x54,0xAA,0x18,0x57,0x2A,
+  0x86,0x66,0x8A,0x01,0x3F,0xF8,0x81,0x54,0x42,0x04,0x85,0x82,0x14,0xCA,0x11,0xC5,
+  0x30,0x54,0x33,0x8A,0x51,0x10,0x82,0x2C,0xA3,0x18,0xC6,0x28,0x48,0x52,0x8A,0x51,
+  0x10,0x63,0x24,0xC4,0x18,0xC5,0x38,0x46,0x32,0x8E,0x51,0x8C,0x63,0x24,0xE3,0x18,
+  0xC5,0x38,0x46,0x42,0x8C,0x51,0x0C,0x63,0x28,0xA5,0x18,0xC5,0x30,0x06,0x33,0x0A,
+  0x42,0x8C,0x62,0x38,0x83,0x90,0x90,0x28,0xE6,0x13,0x0C,0x79,0x49,0x92,0x94,0xA3,
+  0x1C,0xA5,0x00,0x3F,0xF8,0x81,0x54,0x42,0x64,0x91,0x42,0x55,0xC3,0x50,0xD5,0x28,
+  0x08,0x41,0x98,0x41,0x0C,0x63,0x14,0x84,0x19,0xC4,0x28,0x88,0x31,0x98,0x41,0x8C,
+  0x62,0x1C,0x63,0x1A,0xC5,0x38,0xC6,0x34,0x8A,0x71,0x8C,0x69,0x14,0xC3,0x18,0xD4,
+  0x28,0x86,0x31,0x28,0x42,0x8C,0x62,0x38,0x83,0x90,0xCF,0x28,0x66,0x33,0x0C,0x79,
+  0x49,0x92,0x94,0xA3,0x1C,0xA5,0x00,0x3F,0xF8,0x81,0x54,0x42,0x64,0x91,0x42,0x55,
+  0xC3,0x50,0x4A,0x50,0x46,0x41,0x08,0x92,0x08,0x64,0x18,0xA3,0x20,0xC9,0x38,0x46,
+  0x41,0x8C,0x91,0x10,0x63,0x14,0xE3,0x18,0x0A,0x29,0x46,0x31,0x8E,0xC1,0x0C,0x62,
+  0x14,0xE3,0x18,0x8D,0x20,0x46,0x31,0x8C,0xF1,0x04,0x62,0x14,0xC3,0x18,0x14,0x21,
+  0x46,0x31,0x2A,0x79,0x4D,0x4B,0x5E,0x92,0x24,0xE5,0x28,0x47,0x29,0x00,0x3F,0xF8,
+  0x81,0x54,0x42,0x64,0x91,0x42,0x55,0xC3,0x50,0xD5,0x28,0x08,0x41,0x94,0x61,0x0C,
+  0x63,0x14,0x24,0x09,0x43,0x28,0x46,0x41,0x8C,0x81,0x84,0x22,0x10,0xA3,0x18,0xC7,
+  0x40,0x42,0x11,0x88,0x51,0x8C,0x63,0x20,0xA1,0x08,0xC4,0x28,0xC6,0x31,0x92,0x30,
+  0x84,0x62,0x14,0xC3,0x18,0xCB,0x30,0x46,0x31,0x8C,0x41,0x11,0x62,0x14,0xA3,0x92,
+  0xD7,0xB4,0xE4,0x25,0x49,0x52,0x8E,0x72,0x94,0x02,0x3F,0xF8,0x01,0x73,0x3E,0xA6,
+  0x3D,0x2C,0x5E,0xE5,0x28,0x56,0x49,0x4A,0x45,0x16,0x72,0x88,0x85,0x34,0x24,0x10,
+  0x83,0x58,0x86,0x73,0x06,0xB1,0x8C,0x87,0x04,0x42,0x10,0xCB,0x78,0x86,0x60,0x96,
+  0xF1,0x8C,0x81,0x30,0xE3,0x19,0x84,0x68,0xC6,0x33,0xA6,0xF1,0x8C,0x89,0x34,0x84,
+  0x1A,0xCD,0xA8,0x46,0x33,0x00,0x3F,0xF8,0x01,0x73,0x3E,0xA6,0xBD,0x28,0x18,0xF1,
+  0x11,0x85,0x11,0x86,0x60,0x9A,0x51,0x10,0x62,0x10,0x84,0x19,0xC6,0x28,0x46,0x31,
+  0x94,0x52,0x0C,0x63,0x14,0x24,0x21,0xC6,0x30,0x86,0x31,0x92,0x71,0x0C,0x63,0x18,
+  0x23,0x19,0xC7,0x30,0x86,0x31,0x12,0x62,0x0C,0x63,0x18,0x23,0x29,0x05,0x29,0x86,
+  0x31,0x96,0x61,0x10,0x62,0x18,0x83,0x19,0xC5,0x32,0x46,0x23,0x0C,0x55,0x8C,0x27,
+  0x1C,0xA9,0x18,0x9A,0x29,0x06,0x3F,0xF8,0x01,0x73,0x3E,0xA6,0x3D,0x2C,0x5A,0x46,
+  0x18,0x82,0xA9,0x08,0x31,0x08,0xD2,0x8C,0x62,0x14,0xA3,0x18,0xCD,0x20,0x86,0x31,
+  0x0A,0xC2,0x0C,0x62,0x18,0xC3,0x18,0xD3,0x30,0x86,0x31,0xA6,0x61,0x0C,0x63,0x4C,
+  0xC3,0x18,0xC6,0x98,0x48,0x31,0x8C,0x41,0x11,0x62,0x18,0x83,0x19,0xC5,0x32,0x06,
+  0x33,0x0C,0x55,0x8C,0x66,0x1C,0xA9,0x18,0x9A,0x29,0x06,0x3F,0xF8,0x01,0x73,0x3E,
+  0xA6,0x3D,0x2C,0x2E,0x41,0x31,0xC2,0x10,0x8C,0x22,0x12,0x42,0x0C,0x82,0x28,0x03,
+  0x19,0xC5,0x28,0x86,0x42,0x8C,0x61,0x8C,0x82,0x28,0xA4,0x18,0xC6,0x30,0x06,0x33,
+  0x88,0x61,0x0C,0x63,0x34,0x82,0x18,0xC6,0x30,0x86,0x13,0x88,0x61,0x0C,0x63,0x4C,
+  0xA4,0x18,0xC6,0xA0,0x08,0x31,0x8C,0x41,0x2D,0x63,0x54,0xAA,0x18,0x57,0x2A,0x86,
+  0x66,0x8A,0x01,0x3F,0xF8,0x41,0x31,0xCA,0x51,0x8E,0x72,0x94,0xC3,0x1B,0xC4,0xF0,
+  0x06,0x31,0xBC,0x41,0x8C,0xB2,0x4E,0x75,0xAA,0x53,0xA5,0x47,0x39,0xCA,0x01,0x3F,
+  0xF8,0x41,0x31,0xCA,0x51,0x0E,0x30,0x10,0xE3,0x13,0xC4,0xF0,0x06,0x31,0xBA,0x51,
+  0x8C,0xAD,0x14,0x63,0x23,0x46,0x4D,0xC6,0x51,0x93,0x71,0xD4,0x84,0x18,0x35,0x29,
+  0xE5,0x30,0x87,0x29,0xCE,0x00,0x3F,0xF8,0x41,0x31,0xCA,0x51,0x8E,0x72,0x6C,0x21,
+  0x19,0x9B,0x40,0xC6,0x36,0x8E,0xB1,0x11,0x63,0x70,0xA4,0xA8,0xCC,0x20,0x6A,0x23,
+  0x88,0xEA,0x04,0xA2,0x02,0x5F,0x20,0x89,0x68,0xBE,0xD4,0xA9,0x6D,0x2D,0xA3,0x51,
+  0xCE,0x50,0x9A,0x33,0x90,0x34,0x0C,0x2B,0x19,0xA3,0x3A,0xC9,0xA8,0x08,0x33,0x2A,
+  0xA3,0x8C,0x2A,0x1D,0xC3,0x52,0xC5,0xC8,0x94,0x30,0x9C,0xA1,0x34,0x67,0x34,0xCA,
+  0x19,0xCF,0x02,0xD7,0x97,0x44,0x43,0x92,0x33,0x00,0x5F,0x20,0x89,0x68,0xBE,0xD4,
+  0xA9,0x6D,0x6D,0x6A,0x6B,0x10,0x29,0xD2,0x30,0x9E,0x30,0x88,0x20,0x19,0xC3,0x09,
+  0x05,0x4A,0x86,0x13,0x8A,0xC2,0x0C,0x27,0x14,0x47,0x19,0x4E,0x28,0xD4,0x31,0x9E,
+  0x30,0x88,0x40,0x15,0x03,0x22,0x85,0x12,0xC6,0xD6,0x3C,0x05,0x2E,0x50,0x81,0x49,
+  0x34,0x24,0x39,0x03,0x3F,0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x27,0x3F,0x03,0x19,0xC8,
+  0x78,0x06,0x32,0x90,0xF1,0x0C,0x64,0x20,0x63,0x09,0xC3,0x40,0x06,0x32,0x14,0x31,
+  0x0C,0x64,0x20,0x23,0x19,0xC3,0x40,0x06,0x32,0x90,0x41,0x0C,0x64,0x20,0x03,0x11,
+  0xC5,0x40,0x06,0x32,0x10,0x51,0x0C,0x64,0x20,0x03,0x09,0xC6,0x40,0x06,0x32,0x9E,
+  0x81,0x0C,0x64,0x3C,0x63,0x1A,0xCF,0x98,0x46,0x39,0x00,0xBF,0x09,0x91,0x35,0x0C,
+  0x55,0x09,0x83,0x4D,0xC3,0x20,0x04,0x99,0x46,0x41,0x8C,0x31,0x8D,0x62,0x1C,0x63,
+  0x1A,0xC5,0x38,0xC6,0x44,0x88,0x61,0x0C,0x6A,0x5A,0x11,0x8B,0x97,0xAC,0xC8,0x30,
+  0x08,0x33,0x11,0x62,0x18,0x64,0x1A,0xC5,0x38,0xC6,0x34,0x8A,0x71,0x8C,0x69,0x14,
+  0xE3,0x18,0x13,0x21,0xC6,0x31,0x28,0x75,0x0C,0x4A,0x1D,0xE2,0x42,0xC6,0xC8,0x8C,
+  0x31,0x00,0x5F,0x28,0x87,0x68,0x40,0xE4,0x1D,0x0F,0x79,0x8A,0x3B,0xC2,0xC8,0x10,
+  0x31,0x2E,0x64,0x8C,0xEA,0x24,0x83,0x32,0xCB,0xA0,0xF2,0x93,0x9F,0xFC,0xE4,0x67,
+  0x20,0x03,0x19,0xCF,0x40,0x06,0x32,0x9E,0x81,0x0C,0x64,0x3C,0x03,0x19,0xC8,0x78,
+  0x06,0x32,0x90,0xF1,0x8C,0x69,0x94,0x03,0x3F,0x18,0x8F,0xD7,0xB4,0x17,0x05,0x23,
+  0x3E,0xA2,0x30,0x87,0x69,0x46,0x41,0x16,0xC2,0x8C,0x82,0x34,0x24,0x29,0xC5,0x78,
+  0x46,0x42,0x8C,0xF1,0x8C,0x64,0x1C,0xE3,0x19,0xC9,0x38,0xC6,0x33,0x12,0x62,0x8C,
+  0x67,0x24,0xA5,0x18,0xCF,0x58,0x46,0x41,0x1A,0xC2,0x8C,0x82,0x2C,0xC4,0x11,0x85,
+  0x39,0xCC,0x13,0x8C,0x88,0x3D,0xAD,0x79,0x07,0x3F,0x18,0x8F,0xD7,0xB4,0x87,0x45,
+  0xCB,0x1C,0xA6,0x19,0x05,0x59,0x48,0x33,0x08,0xD2,0x10,0x66,0x10,0xE3,0x19,0xD3,
+  0x78,0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,0x19,0xD3,0x78,0x06,0x33,0x08,0xD2,
+  0x10,0x66,0x14,0x64,0x21,0xCD,0x28,0xCC,0x61,0xAC,0x88,0x3D,0xAD,0x79,0x07,0x3F,
+  0x18,0x8F,0xD7,0xB4,0x87,0xC5,0x25,0x28,0xE6,0x30,0x8A,0x48,0xC8,0x42,0x94,0x71,
+  0x90,0x86,0x24,0xC4,0x18,0xCF,0x50,0x48,0x31,0x9E,0xC1,0x0C,0x62,0x3C,0xA3,0x11,
+  0xC4,0x78,0x86,0x13,0x88,0xF1,0x8C,0x69,0x3C,0x63,0x22,0x0D,0xA1,0xC8,0x42,0x2A,
+  0x73,0x18,0x2B,0x62,0x4F,0x6B,0xDE,0x01,0x3F,0xF8,0x41,0x21,0xAD,0x09,0x05,0x82,
+  0x3A,0x82,0xA8,0xCC,0xA8,0xC8,0x32,0xAE,0x91,0x94,0x6B,0x24,0x04,0x1B,0xC9,0xC8,
+  0x46,0x32,0xB0,0xA1,0x10,0x6B,0x2C,0x85,0x22,0xCD,0x98,0x06,0x34,0x88,0xDA,0x08,
+  0xA2,0x3A,0x81,0xA8,0x53,0x05,0x3F,0xF8,0x41,0x21,0xAD,0x59,0x51,0x25,0x24,0x35,
+  0x11,0x19,0x49,0x46,0x36,0x12,0x82,0x0D,0x85,0x5C,0x83,0x19,0xD6,0x68,0x44,0x35,
+  0x9E,0x40,0x0D,0x92,0x8C,0xE3,0xAA,0x53,0x9D,0xEA,0x54,0x01,0x73,0x38,0xC7,0x35,
+  0x16,0x43,0x8D,0x05,0x49,0x63,0x51,0xD0,0x68,0x94,0x33,0xA0,0xB4,0x10,0x62,0x2C,
+  0xEA,0x20,0xC5,0x68,0xD4,0x50,0x8C,0xF1,0x3C,0x6E,0x79,0xA8,0x4B,0x5D,0xEA,0x50,
+  0x34,0x14,0x34,0x0D,0x04,0x55,0xC3,0x40,0x1E,0x02,0xCB,0x38,0xCA,0x00,0x77,0xEA,
+  0x5A,0x16,0xAD,0x49,0x99,0xC4,0x28,0xA3,0x28,0x4D,0x49,0x46,0x41,0x1E,0x92,0x0C,
+  0x82,0x44,0xE4,0x19,0xD3,0x78,0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,0x19,0xD3,
+  0x78,0xC6,0x34,0x1E,0x12,0x11,0x64,0x14,0xE4,0x21,0xC9,0x28,0x4A,0x53,0x92,0x61,
+  0x98,0xC4,0x50,0xD3,0x8A,0x59,0xEB,0x12,0x3F,0xF8,0x41,0x30,0xAB,0x3A,0xDD,0xE8,
+  0x2A,0xE3,0x2A,0xC9,0xC8,0x46,0x32,0x32,0x52,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x20,
+  0xC9,0x48,0x92,0x71,0x95,0x64,0x10,0x57,0x19,0xC4,0x8D,0xEA,0x34,0x01,0x3F,0x18,
+  0x8F,0x11,0xAE,0x26,0x08,0x4B,0x56,0xB2,0x32,0x87,0xA9,0x48,0x62,0x28,0x92,0x8C,
+  0x80,0x4C,0x23,0x19,0x02,0x99,0xC6,0x41,0x88,0x31,0x0D,0x83,0x14,0x63,0x1A,0x05,
+  0x31,0xC6,0x34,0x08,0x72,0x8C,0x89,0x08,0x23,0x19,0xD4,0x08,0x46,0x42,0x28,0x93,
+  0x90,0xCA,0x1C,0xA6,0x92,0x95,0xB4,0x84,0xD0,0xAE,0x60,0x1C,0x3F,0xF8,0xC1,0x0F,
+  0xD0,0x71,0x0D,0x85,0x5C,0x23,0x29,0xD7,0x40,0x0C,0x84,0x1D,0x1B,0x8C,0xC6,0x0A,
+  0x83,0xA9,0xC4,0x58,0xCA,0x31,0x96,0xB1,0x8C,0x64,0x2C,0x63,0x19,0xC9,0x58,0xC6,
+  0x32,0x92,0xB1,0x8C,0x65,0x5C,0x63,0x19,0xD7,0x58,0xC6,0x35,0x16,0x62,0x0D,0x77,
+  0x3A,0x42,0xD5,0x08,0x31,0xC5,0x60,0x48,0x55,0x32,0x89,0x91,0xCA,0x72,0x22,0xB2,
+  0x20,0x88,0x2C,0x44,0x20,0xCF,0x58,0x08,0x31,0x9E,0x91,0x10,0x63,0x3C,0x03,0x21,
+  0xC7,0x78,0xC6,0x41,0x90,0xF1,0x0C,0x83,0x24,0xE3,0x19,0x04,0x59,0xC6,0x43,0x04,
+  0xB2,0x10,0x08,0x2D,0x24,0x3A,0x4B,0x91,0x4C,0x62,0xA4,0x2A,0x8D,0x20,0x4E,0x82,
+  0x68,0x55,0x38,0x12,0x75,0x78,0x82,0x35,0x9A,0x41,0x95,0xA5,0x50,0x25,0x29,0x56,
+  0x39,0x0A,0x56,0x8A,0xA2,0x95,0xA1,0x70,0x25,0x28,0x5E,0x02,0x8F,0x58,0xC4,0x03,
+  0x26,0xAF,0x04,0x85,0x2B,0x43,0xD1,0x4A,0x51,0xB0,0x72,0x14,0xAB,0x24,0x85,0x2A,
+  0x4B,0xA1,0x46,0x33,0xAC,0xF0,0x04,0x3F,0x68,0x86,0x39,0xCA,0x51,0x8E,0x65,0x5C,
+  0x63,0x19,0xD7,0x58,0xC6,0x35,0x96,0x61,0x91,0xE2,0x03,0x83,0xF8,0x40,0x19,0x3E,
+  0x50,0x88,0x0F,0x8C,0x82,0x18,0x63,0x1B,0xC7,0xD8,0xC6,0x31,0xB6,0x71,0x8C,0x6D,
+  0x1C,0x63,0x1B,0xC7,0xD8,0x86,0x39,0x00,0x3F,0xF8,0x81,0x54,0x42,0x64,0x91,0x42,
+  0x55,0xC3,0x50,0xD5,0x28,0x08,0x41,0xA6,0x61,0x8C,0x82,0x38,0x81,0x18,0x05,0x31,
+  0x46,0x23,0x88,0x51,0x8C,0x63,0x30,0x83,0x18,0xC5,0x38,0x86,0x42,0x8A,0x51,0x8C,
+  0x63,0x24,0xC4,0x18,0xC5,0x30,0x86,0x32,0x8E,0x51,0x0C,0x63,0x28,0x02,0x21,0xC4,
+  0x28,0xC6,0x12,0x12,0x79,0x4D,0x4B,0x5E,0x92,0x24,0xE5,0x28,0x47,0x29,0x00,0x3F,
+  0xF8,0x41,0x31,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0x60,0x20,0xC6,0x27,0x88,0xE1,
+  0x0D,0xA2,0x2A,0xA4,0xA8,0x09,0x31,0x6A,0x32,0x8E,0x9A,0x08,0x33,0x00,0x3F,0x18,
+  0x8F,0xD7,0xB4,0x87,0x45,0xCB,0x1C,0xA6,0x22,0x0B,0xA1,0x48,0x43,0x9C,0x40,0x8C,
+  0x67,0x34,0x82,0x18,0xCF,0x60,0x06,0x31,0x9E,0xA1,0x90,0x62,0x3C,0x23,0x21,0xC6,
+  0x78,0x46,0x32,0x8E,0xF1,0x8C,0x44,0x20,0xA4,0x21,0x49,0x50,0xC8,0x42,0x2A,0x73,
+  0x18,0x2B,0x62,0x4F,0x6B,0xDE,0x01,0x3F,0xF8,0x41,0x21,0xAD,0x59,0x51,0xAA,0x92,
+  0xA4,0x1C,0x4E,0xB0,0x46,0x23,0xAC,0xC1,0x0C,0x6B,0x28,0xC4,0x1A,0x0A,0xB1,0xC6,
+  0x32,0x2C,0xB2,0x08,0x6B,0x34,0x21,0xA9,0x53,0x9D,0xEA,0x54,0x01,0x3F,0xF8,0x41,
+  0x5B,0xA7,0xCA,0x0C,0xA2,0x2E,0x84,0xA8,0xCA,0x50,0x06,0x36,0x92,0x91,0x0D,0x64,
+  0x68,0xC4,0x18,0xDC,0x30,0x44,0x47,0x88,0xE1,0x0D,0x62,0x78,0x83,0x18,0xDE,0x20,
+  0x06,0x47,0x8A,0xA2,0x0D,0xA3,0x52,0xB4,0x9A,0x57,0x04,0x3F,0xF8,0x41,0x90,0x9F,
+  0xFC,0x64,0x45,0x0C,0x67,0x1B,0xC5,0xC1,0xC6,0x81,0x2C,0xA1,0x9C,0x4A,0x2C,0x68,
+  0x1A,0xCC,0x99,0x44,0x83,0xA2,0xE1,0x20,0x48,0x40,0xE7,0x11,0x11,0x62,0xC6,0x74,
+  0x94,0x51,0x21,0x44,0x14,0xF9,0xC9,0x4F,0x06,0x3F,0xF8,0xC1,0x0F,0x2E,0xC2,0x89,
+  0xC2,0x6C,0x82,0x40,0xD9,0x20,0xC4,0x30,0x32,0x41,0x0C,0x42,0x64,0x82,0x10,0x85,
+  0xC8,0x04,0x21,0x0A,0x91,0x09,0x42,0x14,0x41,0x13,0x84,0x20,0x84,0x36,0x06,0x41,
+  0x04,0x8E,0x71,0x6E,0x6B,0xA6,0x30,0x05,0x3F,0xF8,0x41,0x7A,0xBE,0xC5,0xB5,0x6D,
+  0x1C,0x43,0x1B,0xC9,0xC8,0xC4,0x22,0x32,0xB1,0x88,0x4C,0x2C,0x22,0x13,0x8B,0xC8,
+  0xC4,0x22,0xB2,0x91,0x0C,0x6D,0x1C,0x63,0x6B,0xDC,0xFA,0x0E,0x3F,0xF8,0x41,0x56,
+  0x44,0xF4,0x25,0x6F,0x71,0x84,0x20,0x1B,0x31,0x48,0x46,0x0E,0x82,0x91,0x64,0x5C,
+  0x44,0x19,0x0B,0x21,0x90,0x32,0x16,0x42,0x9C,0x65,0x2C,0x84,0x28,0xCD,0x58,0x08,
+  0x31,0x9E,0x51,0x8E,0x72,0x84,0x46,0x34,0xA2,0x01,0x3F,0xF8,0xC1,0x50,0xC2,0xD4,
+  0x91,0x82,0x6C,0x22,0x11,0x9A,0x58,0x44,0xC6,0x02,0x81,0x89,0x40,0x09,0xE2,0x12,
+  0x41,0x20,0x82,0x21,0x2E,0x11,0x04,0x22,0x18,0xE2,0x12,0x41,0x18,0xCA,0x20,0x2E,
+  0x11,0x14,0x61,0x08,0x02,0x13,0xC1,0x28,0x42,0x20,0x32,0xB1,0x08,0x4D,0x24,0x62,
+  0x23,0x05,0xE9,0x52,0x58,0x00,0x3F,0x08,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,
+  0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,
+  0x4A,0xE5,0x29,0x4F,0x01,0x84,0xD0,0xC2,0x22,0xB0,0xA1,0x0C,0xAB,0x28,0x0F,0x31,
+  0xCB,0x3B,0x4A,0xF3,0x8A,0x12,0x96,0xD0,0x80,0x06,0x34,0xA0,0x01,0x4D,0x58,0xC2,
+  0x12,0x96,0x43,0x20,0x84,0x31,0x87,0x40,0xCA,0x52,0x12,0x71,0x98,0x65,0x2C,0xC2,
+  0x18,0xC1,0x58,0x42,0x23,0x8A,0x21,0x8C,0x4C,0x14,0x62,0x18,0xD9,0x18,0xC6,0x30,
+  0xB4,0x43,0x0C,0xCD,0x14,0x63,0x23,0xC6,0x00,0x84,0x30,0x85,0x16,0x94,0x81,0x0D,
+  0xE5,0x29,0x45,0x79,0x88,0x59,0xDE,0x51,0xC2,0x12,0x96,0xD0,0x80,0x06,0x34,0xA0,
+  0x31,0xC6,0x65,0x8C,0x62,0x95,0x63,0x04,0x82,0x2A,0xC8,0x10,0x84,0x54,0x92,0x31,
+  0x08,0xC8,0x20,0xA3,0x10,0x4F,0x49,0x86,0x21,0x9E,0xB1,0xBC,0x25,0x34,0x2F,0x7B,
+  0xA2,0x30,0x05,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x84,0x84,0xA8,0x0B,0x21,
+  0xEA,0x42,0x88,0xBA,0x10,0xA2,0x02,0x3F,0x30,0x83,0x39,0xC8,0x22,0x8E,0x60,0x80,
+  0x63,0x18,0xDE,0x28,0x06,0x37,0x8E,0xA1,0x8D,0x64,0x60,0xA3,0x08,0xC5,0xC0,0x42,
+  0x31,0x8A,0xE0,0x15,0x71,0x04,0x03,0x1C,0xC3,0xF0,0x46,0x31,0xB8,0x71,0x0C,0x6D,
+  0x24,0x03,0x1B,0xCB,0xC0,0x42,0x13,0x00,0x3F,0xF8,0x42,0x13,0xB0,0xB1,0x0C,0x6C,
+  0x24,0x43,0x1B,0x07,0xD1,0x48,0x41,0x38,0x32,0x10,0x6F,0x08,0x04,0x3C,0x62,0xF1,
+  0x42,0x31,0x8A,0x80,0x8D,0x22,0x14,0x03,0x1B,0xC9,0xD0,0xC6,0x31,0xB8,0x51,0x0C,
+  0x6F,0x0C,0x03,0x1C,0xC1,0x10,0x0B,0x39,0xCC,0x00,0x00,0x21,0x08,0x41,0x08,0x42,
+  0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,
+  0x04,0x21,0x08,0x41,0x08,0xF2,0x83,0x1F,0x98,0x84,0x20,0x04,0x21,0x08,0x41,0x08,
+  0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,
+  0x20,0x04,0x21,0xC8,0x0F,0x7E,0x60,0x12,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,
+  0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,
+  0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,
+  0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x44,0x10,0x82,
+  0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,
+  0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x04,0x21,0x04,0x21,0x08,0x41,0x08,0x42,0x10,
+  0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,
+  0x21,0x08,0x81,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,
+  0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x20,0x84,0x20,
+  0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,
+  0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x10,0x41,0x08,0x42,0x10,0x82,0x10,0x84,
+  0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,
+  0x08,0x42,0x10,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0x20,0x11,0x84,0x20,0x04,0x21,
+  0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,0x10,
+  0x82,0x10,0x84,0x20,0x04,0x21,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x89,0x20,0x04,
+  0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,0x42,
+  0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0xF1,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0x48,
+  0x04,0x21,0x08,0x41,0x08,0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x08,
+  0x42,0x10,0x82,0x10,0x84,0x20,0x04,0x21,0x08,0x41,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xF0,0x83,0x1F,0xF8,0x1F,0xF8,0xC0,0x07,0x36,0xD3,0x28,0x47,0x39,0xCA,0x51,0x8E,
+  0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xA4,0x0F,0x7C,0xE0,0x03,0x1B,0x5F,0x20,
+  0x89,0x68,0xBE,0xD4,0xA9,0x6D,0x6D,0x6A,0x6B,0x59,0x1A,0x46,0x14,0x88,0x64,0x0C,
+  0x48,0x0C,0x27,0x19,0xCF,0x18,0x08,0x33,0x9C,0x41,0x18,0x65,0x38,0xA2,0x48,0xC7,
+  0x70,0x84,0xA1,0x8A,0xE1,0x04,0x45,0x09,0x63,0x6B,0x9E,0x02,0x17,0xB8,0xBE,0x24,
+  0x1A,0x92,0x9C,0x01,0x5F,0x20,0x89,0x68,0xBE,0xD4,0xA9,0x6D,0x39,0x81,0x51,0x90,
+  0x48,0xDA,0x33,0x8E,0x34,0x0C,0x67,0x14,0xC9,0x18,0xCE,0x20,0x4E,0x32,0x1C,0x51,
+  0x10,0x66,0x38,0xA2,0x30,0xCA,0x70,0x06,0x91,0x8E,0xE1,0x8C,0x42,0x15,0xE3,0x19,
+  0x87,0x12,0x06,0x24,0x92,0x16,0x05,0x46,0x81,0x0B,0x5C,0x5F,0x12,0x0D,0x49,0xCE,
+  0x00,0x5F,0x20,0x89,0x68,0xBE,0xD4,0xA9,0x6D,0x2D,0xE1,0x51,0x8E,0x58,0x9A,0x23,
+  0x92,0x34,0x0C,0x67,0x14,0xC9,0x18,0xCF,0x18,0x4E,0x32,0x20,0x31,0x10,0x66,0x44,
+  0x61,0x30,0xCA,0xA8,0xD2,0x31,0x2C,0x55,0x8C,0x4C,0x09,0x63,0x6B,0x9E,0x02,0x17,
+  0xB8,0xBE,0x24,0x1A,0x92,0x9C,0x01,0x34,0xCB,0x24,0x55,0x98,0x12,0x0D,0x69,0x3C,
+  0xE3,0x30,0xC7,0x68,0x86,0xA1,0x8C,0xC1,0x08,0x83,0x19,0x62,0x11,0x06,0x29,0x8A,
+  0x21,0x14,0x61,0x0C,0x84,0x14,0x42,0x11,0xC5,0x48,0x48,0x21,0x14,0x51,0x0C,0x65,
+  0x14,0x42,0x11,0xC5,0x50,0x46,0x21,0x14,0x51,0x0C,0x65,0x14,0x42,0x11,0xC5,0x50,
+  0x46,0x21,0x16,0x41,0x90,0x44,0x14,0x82,0x19,0xC4,0x40,0x06,0x31,0x9A,0x41,0x8D,
+  0x67,0x48,0x23,0x2A,0x4C,0xA1,0x64,0xC6,0x00,0xD0,0x18,0xC6,0x37,0x86,0xF1,0x8D,
+  0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xCF,
+  0x1C,0x3E,0x60,0x86,0x0F,0x98,0x41,0xFE,0x20,0xFF,0xC0,0x07,0x3E,0xB0,0x01,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0xE2,0x03,0x1F,0xF8,0xC0,0xFE,0x41,0xFE,0x81,0x0F,
+  0x7C,0x60,0x03,0xD0,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,
+  0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0x24,0x34,0x06,0x09,0x8D,
+  0x41,0x42,0xA3,0x1C,0xE5,0x28,0x31,0x84,0x21,0x0C,0xD0,0x18,0xC6,0x37,0x86,0xF1,
+  0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,
+  0xCF,0x1C,0xC6,0x33,0x87,0xF1,0xCC,0x61,0x94,0xA3,0x1C,0xE5,0x78,0xF2,0x93,0x9F,
+  0x0C,0x3F,0xF8,0xC1,0x91,0xBA,0xA6,0xC1,0x4B,0x56,0xE6,0x30,0x14,0x61,0xCA,0x34,
+  0x1C,0x22,0x91,0x87,0x44,0x03,0x22,0x4E,0x5F,0xBA,0x33,0xA2,0x11,0x8D,0x68,0x44,
+  0x04,0x1A,0xD2,0x78,0xC6,0x34,0x9E,0x01,0x6B,0x38,0x85,0x49,0xC8,0x92,0x0C,0x62,
+  0x40,0xE7,0x18,0xC4,0x88,0x50,0x31,0x88,0x31,0x1D,0x62,0x10,0xA3,0x3A,0xC2,0x20,
+  0x86,0x75,0x82,0x41,0x0C,0xAC,0x52,0xD4,0x92,0xD5,0xA4,0x10,0x31,0xAE,0x22,0x0C,
+  0x62,0x58,0x65,0x18,0xC4,0xA0,0x4A,0x31,0x88,0x31,0x15,0x63,0x10,0x43,0x22,0xC8,
+  0x20,0x06,0x54,0x46,0x42,0x0A,0x33,0x00,0xD3,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,
+  0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x3A,0xD5,0xA9,0x02,0x3F,0xF8,0xC1,0x0F,
+  0x7E,0xF0,0x83,0x1F,0xF8,0x56,0xB2,0x92,0x2D,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,
+  0xA3,0x1C,0xE5,0x28,0x47,0x39,0x00,0xD3,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,
+  0xA3,0x1C,0xE5,0x28,0x47,0x39,0x24,0x2B,0x59,0xC9,0x96,0xA3,0x1C,0xE5,0x28,0x47,
+  0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xD3,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,
+  0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x3A,0xD5,0xA9,0x4E,0xA3,0x1C,0xE5,0x28,
+  0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x1F,0xF8,0x1F,0xF8,0xC0,0x07,0xF6,0x34,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,
+  0x28,0x47,0x39,0xCA,0x01,0xD3,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,
+  0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,
+  0x51,0x8E,0x72,0x94,0xA3,0x1C,0xD3,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,
+  0x1C,0xE5,0x28,0x47,0x39,0xA4,0x0F,0x7C,0xE0,0x03,0x7B,0x1A,0xE5,0x28,0x47,0x39,
+  0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x00,0x3F,0xF8,0x81,0x54,0x42,0x64,0x91,
+  0x42,0x35,0xA3,0x18,0x86,0x62,0x48,0x31,0x0A,0x42,0x10,0x65,0x18,0xC3,0x18,0x05,
+  0x51,0x86,0x31,0x0A,0x62,0x0C,0x65,0x18,0xA3,0x18,0xC7,0x50,0x48,0x31,0x8A,0x71,
+  0x8C,0x65,0x14,0xA3,0x18,0xC7,0x58,0x08,0x31,0x8A,0x61,0x8C,0x66,0x10,0xA3,0x18,
+  0xC6,0x68,0x06,0x41,0x88,0x51,0x0C,0x67,0x10,0xB2,0x21,0xC6,0x5C,0x06,0x22,0x2F,
+  0x49,0x92,0x72,0x94,0xA3,0x14,0x5F,0x20,0x89,0x68,0xBE,0xD4,0xA9,0x6D,0x35,0x82,
+  0x51,0xCF,0x48,0x9A,0x33,0x90,0x34,0x0C,0x47,0x18,0xC9,0x18,0x8E,0x28,0x4E,0x32,
+  0x9C,0x41,0x10,0x66,0x3C,0x82,0x30,0xCA,0x78,0xC6,0x90,0x8E,0x01,0x09,0x42,0x15,
+  0x03,0x12,0x87,0x12,0xC6,0x33,0x92,0xE6,0x8C,0x46,0x39,0x02,0x5A,0xE0,0xFA,0x92,
+  0x68,0x48,0x72,0x06,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x22,0x3F,0xF9,0xC9,0xE5,
+  0x28,0x47,0x39,0x9E,0x39,0x8C,0x67,0x0E,0xE3,0x99,0xC3,0xF8,0xC6,0x30,0xBE,0x31,
+  0x8C,0x6F,0x0C,0xE3,0x1B,0xC3,0xF8,0xC6,0x30,0xBE,0x31,0x8C,0x6F,0x0C,0x03,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x0A,0x43,0x18,0xC2,0xD0,0x28,0x47,0x39,0xCA,0x31,
+  0x48,0x68,0x0C,0x12,0x1A,0x83,0x84,0xC6,0x30,0xBE,0x31,0x8C,0x6F,0x0C,0xE3,0x1B,
+  0xC3,0xF8,0xC6,0x30,0xBE,0x31,0x8C,0x6F,0x0C,0x03,0xD0,0x18,0xC6,0x37,0x86,0xF1,
+  0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,
+  0xCF,0x1C,0xC6,0x33,0x87,0xF1,0xCC,0x61,0x94,0xA3,0x1C,0xE5,0x78,0xE6,0x30,0x9E,
+  0x39,0x8C,0x67,0x0E,0xE3,0x1B,0xC3,0xF8,0xC6,0x30,0xBE,0x31,0x8C,0x6F,0x0C,0xE3,
+  0x1B,0xC3,0xF8,0xC6,0x30,0xBE,0x31,0x0C,0xD0,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,
+  0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,
+  0x24,0x34,0x06,0x09,0x8D,0x41,0x42,0xA3,0x1C,0xE5,0x28,0xC7,0x20,0xA1,0x31,0x48,
+  0x68,0x0C,0x12,0x1A,0xC3,0xF8,0xC6,0x30,0xBE,0x31,0x8C,0x6F,0x0C,0xE3,0x1B,0xC3,
+  0xF8,0xC6,0x30,0xBE,0x31,0x0C,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0xE2,0x03,0x1F,
+  0xF8,0xC0,0xFE,0x41,0x3E,0x87,0x0F,0x98,0xE1,0x03,0x66,0x90,0xD0,0x18,0xC6,0x37,
+  0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x00,
+  0xD0,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,
+  0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,
+  0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,
+  0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,
+  0x63,0x18,0xD0,0x18,0xC6,0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xDF,0x18,0xC6,
+  0x37,0x86,0xF1,0x8D,0x61,0x7C,0x63,0x18,0xCF,0x1C,0x3E,0x60,0x86,0x0F,0x98,0x41,
+  0xFE,0x20,0x9F,0xC3,0x07,0xCC,0xF0,0x01,0x33,0x48,0x68,0x0C,0xE3,0x1B,0xC3,0xF8,
+  0xC6,0x30,0xBE,0x31,0x8C,0x6F,0x0C,0xE3,0x1B,0xC3,0xF8,0xC6,0x30,0x00,0x3F,0xF8,
+  0xC1,0x10,0x9E,0x60,0x8D,0x66,0x58,0x63,0x28,0xC3,0xC0,0x9E,0xD6,0x36,0x52,0x90,
+  0x6D,0x1C,0x43,0x1B,0xC9,0xC8,0x46,0x32,0xB2,0x91,0x8C,0x6C,0x24,0x23,0x1B,0xC9,
+  0xD0,0xC6,0x31,0x36,0x52,0x90,0xAD,0x69,0x0F,0x1B,0x43,0x19,0x86,0x35,0x9A,0x61,
+  0x85,0x27,0x00,0x3F,0x90,0x86,0x73,0xA0,0xC1,0x2C,0x67,0x28,0x8F,0x21,0xC2,0x18,
+  0xE2,0x42,0x84,0x21,0x98,0xC3,0x2C,0x23,0x18,0x03,0x59,0xC8,0x62,0x06,0xD2,0x8C,
+  0xC5,0x0C,0xA4,0x21,0x0B,0x21,0xC6,0x33,0x96,0x32,0x8C,0x67,0x28,0x47,0x18,0xCF,
+  0x50,0x50,0x30,0x9E,0x91,0x0C,0x01,0x39,0x44,0x09,0x04,0x6A,0x06,0x94,0x16,0x22,
+  0xA5,0xA3,0x50,0xB4,0x92,0x98,0xEB,0x12,0xD1,0x28,0x47,0x39,0xB6,0xFC,0xE4,0x27,
+  0x3F,0xF9,0x19,0xC7,0x48,0xC6,0x33,0x8E,0x91,0x8C,0x67,0x1C,0x23,0x19,0xCF,0x38,
+  0x46,0x32,0x9E,0x71,0x8C,0x64,0x3C,0x63,0x1A,0xCF,0x90,0xC8,0x43,0x22,0x02,0x8D,
+  0x68,0x44,0xE4,0x21,0x51,0x69,0xC8,0x64,0x12,0x43,0x4D,0x2B,0x62,0xAE,0x43,0x3F,
+  0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x25,0x0C,0x59,0x11,0xC3,0x40,0x06,0x32,0x92,0x31,
+  0x0C,0x64,0x20,0x03,0x19,0xC4,0x40,0x06,0x32,0x90,0x41,0x0C,0x64,0x20,0x03,0x11,
+  0xC5,0x40,0x06,0x32,0x10,0x51,0x0C,0x64,0x20,0x03,0x19,0xC4,0x40,0x06,0x32,0x90,
+  0x41,0x0C,0x64,0x20,0x23,0x19,0xC3,0x40,0x06,0x32,0x14,0x31,0x0C,0x64,0x20,0x63,
+  0x09,0xC3,0x40,0x06,0x32,0x9E,0x31,0x8D,0x67,0x4C,0xA3,0x1C,0x3F,0xF8,0x41,0x9A,
+  0x9F,0xFC,0x64,0x64,0x10,0x19,0x19,0xC4,0x40,0x06,0x32,0x90,0x41,0x0C,0x64,0x20,
+  0xE3,0x19,0xC8,0x40,0xC6,0x33,0x90,0x81,0x8C,0x67,0x20,0x03,0x19,0xCF,0x40,0x06,
+  0x32,0x9E,0x81,0x0C,0x64,0x3C,0x03,0x19,0xC8,0x78,0x06,0x32,0x90,0x81,0x0C,0x62,
+  0x20,0x03,0x19,0xC8,0x20,0x06,0x32,0x90,0x81,0x0C,0x62,0x4C,0xE3,0x19,0xD3,0x28,
+  0x07,0x3F,0xF8,0x41,0x9A,0x9F,0xFC,0x64,0x24,0x18,0x19,0x11,0xC5,0x40,0x06,0x32,
+  0x10,0x51,0x0C,0x64,0x20,0x03,0x19,0xC4,0x40,0x06,0x32,0x92,0x31,0x0C,0x64,0x20,
+  0x43,0x11,0xC3,0x40,0x06,0x32,0x96,0x30,0x0C,0x64,0x20,0xE3,0x19,0xC8,0x40,0xC6,
+  0x33,0x90,0x81,0x8C,0x67,0x20,0x03,0x19,0xCF,0x40,0x06,0x32,0x9E,0x81,0x0C,0x64,
+  0x3C,0x63,0x1A,0xCF,0x98,0x46,0x39,0x00,0x3F,0xF8,0x41,0x31,0xCA,0x51,0x8E,0x72,
+  0x94,0xA3,0x1C,0xE5,0x28,0x47,0x59,0xA7,0x3A,0xD5,0xA9,0x02,0x3F,0xF8,0x41,0x30,
+  0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0xCF,0x98,0xC6,0x33,0xA6,0xF1,0x8C,0x69,0x3C,
+  0x63,0x1A,0x4B,0x18,0xB2,0x22,0x86,0x9C,0x8C,0x21,0x23,0x83,0xC8,0x88,0x28,0xC6,
+  0x34,0x10,0x51,0x8C,0x69,0x20,0xC1,0x18,0xD3,0x78,0xC6,0x34,0x9E,0x31,0x8D,0x67,
+  0x4C,0xE3,0x19,0xD3,0x00,0x3F,0xF8,0x41,0x30,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,
+  0x4B,0x18,0xC6,0x34,0x14,0x31,0x8C,0x69,0x24,0x63,0x18,0xD3,0x40,0x06,0x31,0xA6,
+  0x81,0x0C,0x22,0x23,0xA2,0xC8,0x88,0x28,0x32,0x32,0x88,0x8C,0x0C,0x62,0x4C,0x23,
+  0x19,0xC3,0x98,0x86,0x22,0x86,0x31,0x8D,0x25,0x0C,0x63,0x1A,0xCF,0x98,0xC6,0x33,
+  0xA6,0xF1,0x8C,0x69,0x00,0x3F,0xF8,0x41,0x30,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,
+  0xC8,0x20,0xC6,0x34,0x90,0x41,0x8C,0x69,0x20,0x83,0x18,0xD3,0x78,0xC6,0x34,0x9E,
+  0xFC,0xE4,0x27,0x3F,0xF9,0x19,0xD3,0x78,0xC6,0x34,0x90,0x41,0x8C,0x69,0x20,0x83,
+  0x18,0xD3,0x40,0x06,0x31,0xA6,0xF1,0x8C,0x69,0x3C,0x63,0x1A,0xD3,0x28,0x47,0x39,
+  0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0x24,0x2B,0x59,0xC9,0x02,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0x40,0xAA,0x53,0x9D,0xEA,0x34,0xCA,
+  0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x01,0xC0,0x07,0x3E,0xF0,
+  0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,
+  0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,0x3E,
+  0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1E,0x14,0xA5,0x28,0x45,0x29,0x4A,0x51,0x8A,0x52,
+  0x94,0xA2,0x14,0xA5,0x28,0x45,0x29,0x4A,0x51,0x8A,0x52,0x94,0xA2,0x14,0xA5,0x28,
+  0x45,0x29,0x4A,0x51,0x8A,0x52,0x94,0xA2,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,
+  0xFC,0x0E,0x79,0x83,0x43,0xDE,0xE0,0x90,0x07,0x3F,0xF8,0x41,0x30,0xA6,0xF1,0x8C,
+  0x69,0x3C,0x63,0x1A,0x48,0x30,0xC6,0x34,0x10,0x51,0x8C,0x69,0x20,0xA2,0x18,0xD3,
+  0x40,0x06,0x31,0xA6,0x91,0x8C,0x21,0x2B,0x62,0xC8,0x4B,0x18,0xF2,0x93,0x9F,0x31,
+  0x8D,0x67,0x4C,0xE3,0x19,0xD3,0x78,0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,0x19,
+  0xD3,0x00,0x00,0xA5,0x28,0x45,0x29,0x4A,0x51,0x8A,0x52,0x94,0xA2,0x14,0xA5,0x28,
+  0x45,0x29,0x4A,0x51,0x8A,0x52,0x94,0xA2,0x14,0xA5,0x28,0x45,0x29,0x4A,0x51,0x8A,
+  0x52,0x94,0xA2,0x77,0xEA,0x5A,0x16,0xAD,0x49,0x99,0xC4,0x48,0xA5,0x29,0x11,0x79,
+  0x08,0x44,0x22,0xF2,0x8C,0x69,0x2C,0x61,0x18,0xD3,0x50,0xC4,0x30,0xA6,0x91,0x8C,
+  0x61,0x4C,0x03,0x19,0xC4,0x98,0x06,0x22,0x8A,0x31,0x0D,0x44,0x14,0x24,0x22,0x48,
+  0x38,0xC8,0x43,0xA2,0xD2,0x14,0xC9,0x24,0x86,0x9A,0x56,0xCC,0x5A,0x97,0x00,0x3F,
+  0xF0,0xF7,0xD2,0x15,0xAF,0xF8,0xA4,0x8C,0x84,0x1C,0xD8,0x50,0x46,0x42,0x96,0xA1,
+  0x0C,0xE4,0x24,0x24,0x19,0x86,0x4A,0x46,0x42,0x08,0x86,0x0C,0x65,0x0D,0x05,0x19,
+  0x8A,0x2A,0xCA,0x31,0x96,0x83,0x14,0x63,0x30,0x64,0x29,0x04,0xD9,0x58,0xB7,0x3E,
+  0x14,0x16,0x77,0xEA,0x5A,0x16,0xAD,0x49,0x99,0xC4,0x34,0x81,0x28,0x4D,0x59,0x04,
+  0x41,0x1E,0xA2,0x8C,0x81,0x44,0x04,0x19,0xC4,0x98,0x06,0x32,0x88,0x31,0x0D,0x44,
+  0x14,0x63,0x1A,0x88,0x28,0xC6,0x34,0x90,0x41,0x8C,0x69,0x20,0x83,0x18,0xD3,0x48,
+  0xC6,0x40,0x22,0xA2,0x08,0x82,0x3C,0x84,0x09,0x44,0x69,0x8A,0x64,0x12,0x43,0x4D,
+  0x2B,0x66,0xAD,0x4B,0x77,0xEA,0x5A,0x16,0xAD,0x49,0x99,0xC4,0x28,0xE1,0x28,0x4D,
+  0x49,0x84,0x41,0x1E,0x92,0x88,0x82,0x44,0x04,0x19,0xC4,0x98,0x46,0x32,0x86,0x31,
+  0x0D,0x45,0x0C,0x63,0x1A,0x4B,0x18,0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,0x21,
+  0x11,0x81,0xC8,0x43,0xA2,0xD2,0x14,0xC9,0x24,0x86,0x9A,0x56,0xCC,0x5A,0x97,0x00,
+  0x3F,0x18,0x8F,0xD7,0xB4,0x87,0x45,0x67,0x14,0xE6,0x30,0x0C,0x29,0xC8,0x42,0x96,
+  0x61,0x90,0x86,0x28,0xC3,0x18,0xCF,0x50,0x86,0x31,0x9E,0xA1,0x90,0x62,0x3C,0x63,
+  0x19,0xC5,0x78,0xC6,0x42,0x88,0xF1,0x0C,0x66,0x10,0xE3,0x19,0xCC,0x20,0x48,0x43,
+  0x98,0x51,0x90,0x85,0x2C,0xC4,0x30,0x87,0x59,0x06,0x12,0xB1,0xA7,0x35,0xEF,0x00,
+  0x77,0xEA,0x5A,0x16,0xAD,0x49,0x99,0xC4,0x30,0x82,0x28,0x4D,0x51,0x06,0x41,0x1E,
+  0x92,0x0C,0x82,0x44,0x04,0x11,0xC5,0x98,0x06,0x22,0x8A,0x31,0x0D,0x64,0x10,0x63,
+  0x1A,0x89,0x20,0xC6,0x34,0x92,0x31,0x8C,0x69,0x28,0x62,0x18,0xD3,0x50,0xC4,0x40,
+  0x22,0x92,0x0C,0x82,0x3C,0x24,0x19,0x45,0x69,0x4A,0x22,0x0E,0x93,0x18,0x6A,0x5A,
+  0x31,0x6B,0x5D,0x02,0x3F,0xF8,0x41,0xDB,0x97,0xBE,0xF4,0xA5,0x6B,0xC4,0x1C,0x25,
+  0x29,0x47,0x39,0xCA,0x41,0x0E,0x72,0x8C,0xC4,0xA2,0x54,0x9D,0xEA,0x54,0x4D,0x01,
+  0x3F,0xF8,0xC1,0xF8,0x01,0x14,0x7C,0x00,0x05,0x1F,0x40,0xC1,0x07,0xD0,0x23,0x94,
+  0x71,0x0D,0x66,0x54,0xA3,0x19,0xD5,0x70,0xC6,0x34,0x9E,0x31,0x8D,0x67,0x4C,0xE3,
+  0x19,0xD3,0x70,0xC8,0x44,0x18,0x52,0x15,0xC4,0x54,0xF2,0x82,0x99,0xEB,0x10,0x3F,
+  0xF8,0x41,0x9A,0x9F,0xFC,0xE4,0x27,0x53,0x23,0x19,0xD9,0x48,0x46,0x36,0x92,0x91,
+  0x8D,0x64,0x64,0x23,0x19,0xD9,0x48,0x46,0x36,0x10,0x92,0x0D,0x64,0x68,0xC4,0x20,
+  0x5A,0x21,0xCA,0xC6,0xB8,0xE5,0xA5,0xD0,0x00,0x3F,0xF8,0x41,0x30,0xAB,0x3A,0xDD,
+  0xE8,0x92,0xA5,0x1C,0x25,0x59,0x42,0x36,0x14,0x91,0x8D,0x64,0x64,0x03,0x19,0xDA,
+  0x40,0xC4,0x36,0x10,0xA1,0x11,0x24,0x68,0x64,0x2C,0xD0,0x8D,0x6E,0x54,0xA7,0x09,
+  0x3F,0xF8,0x41,0x30,0xAB,0x3A,0xDD,0x26,0x0C,0x97,0x11,0x56,0x51,0x06,0x36,0x92,
+  0x91,0x11,0x64,0x68,0x03,0x11,0xDB,0x40,0xC4,0x36,0x90,0xA1,0x0D,0x64,0x68,0x23,
+  0x19,0x18,0x51,0xC4,0x45,0x98,0x60,0x15,0xE8,0x46,0x37,0xAA,0xD3,0x04,0x3F,0xF8,
+  0x41,0x30,0xAB,0x3A,0xDD,0xE8,0x2A,0x21,0x2B,0x89,0xD0,0x46,0x22,0x34,0x82,0x0C,
+  0x6D,0x24,0x23,0x1B,0x8A,0xC8,0xC6,0x12,0xB2,0x51,0x0E,0x92,0x8C,0x64,0x2C,0xD0,
+  0x8D,0x6E,0x54,0xA7,0x09,0x73,0x38,0xC7,0x35,0x16,0x43,0x8D,0x05,0x49,0x63,0x51,
+  0xD0,0x68,0x94,0x33,0xA0,0xB4,0x10,0x49,0x1D,0xE4,0x08,0x8D,0x1A,0xCA,0x21,0x9E,
+  0x77,0x0C,0x69,0x19,0x84,0x42,0x07,0x91,0x52,0x32,0xA2,0xB4,0x08,0x08,0x39,0xE1,
+  0x41,0x1E,0xF2,0x90,0x87,0xC0,0x32,0x8E,0x32,0x00,0x6F,0x38,0x85,0x49,0xC8,0x32,
+  0x9E,0xD1,0x8C,0x67,0x34,0xE3,0xB9,0x82,0x72,0x2A,0xC1,0xC0,0x64,0x34,0x0F,0x19,
+  0x8F,0x43,0xC4,0xF3,0x10,0xD1,0x98,0x29,0x30,0x26,0x34,0xA0,0x01,0x4D,0x68,0x44,
+  0x42,0x0A,0x33,0x00,0xC0,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,
+  0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,
+  0x8E,0x72,0x94,0xA3,0x1C,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0x24,0x98,0xA2,0x1C,
+  0xE4,0x28,0x85,0x29,0xCC,0x00,0x3F,0xF8,0x01,0x3D,0xCA,0x51,0x8E,0x72,0x94,0xA3,
+  0x1C,0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0x28,0x07,0x3F,
+  0x10,0x47,0x32,0xB2,0x91,0x8C,0x6C,0x24,0x23,0x1B,0xC9,0xC8,0x46,0x32,0xB2,0x91,
+  0x8C,0x6C,0x24,0x23,0x1B,0xC9,0xC8,0x46,0x32,0xA6,0x37,0x8C,0xE9,0x0D,0x63,0x7A,
+  0xC3,0xC8,0x46,0x32,0xB2,0x91,0x8C,0x6C,0x24,0x23,0x1B,0xC9,0xC8,0x46,0x32,0xB2,
+  0x91,0x8C,0x6C,0x24,0x23,0x1B,0xC9,0xC8,0x46,0x32,0x00,0xE0,0x18,0x04,0x38,0x06,
+  0x01,0x8E,0x41,0x80,0x63,0x10,0xE0,0x18,0x04,0x38,0x06,0x01,0x8E,0x41,0x80,0x63,
+  0x10,0xE0,0x18,0x04,0x38,0x06,0x01,0x8E,0x41,0x80,0x63,0x10,0xE0,0x18,0x04,0x38,
+  0x06,0x01,0x8E,0x41,0x80,0x63,0x10,0xE0,0x18,0x04,0x38,0x06,0x01,0x8E,0x41,0x80,
+  0x63,0x10,0xE0,0x18,0x04,0x38,0x06,0x01,0x8E,0x41,0x80,0x63,0x10,0xEB,0x48,0x86,
+  0x13,0x14,0xB1,0x88,0x46,0x28,0x82,0x10,0x85,0x58,0x88,0x22,0x08,0x51,0x08,0x85,
+  0x2C,0x82,0x18,0x84,0x40,0x0A,0x23,0x88,0x41,0x88,0x83,0x38,0x43,0x28,0xC2,0x28,
+  0xCA,0x73,0x02,0x53,0x10,0xA9,0x08,0x66,0x28,0xD4,0x20,0xC8,0x40,0xC4,0x22,0x92,
+  0x62,0x68,0x85,0x28,0x19,0x29,0x46,0x20,0xAE,0x52,0x0C,0x41,0x58,0xC4,0x18,0x83,
+  0xA0,0x4A,0x31,0x0A,0x31,0x11,0x63,0x18,0x22,0x2A,0xC7,0x63,0x48,0xF2,0x16,0xA2,
+  0xBC,0x45,0x54,0xE2,0x09,0x96,0x00,0x3F,0xF8,0x0F,0xA8,0x3A,0xC6,0x35,0xCD,0x69,
+  0x2F,0x7B,0xD9,0x07,0x48,0xF1,0x01,0x52,0x08,0x53,0x98,0xC2,0x14,0xA6,0x30,0x3F,
+  0x40,0x8A,0x0F,0x10,0x3F,0xF8,0xC1,0x0F,0xA4,0x62,0x90,0x85,0x24,0x67,0x40,0xCA,
+  0x40,0x68,0x32,0x0E,0x32,0x18,0x82,0x24,0xC4,0x18,0x44,0x31,0x48,0x32,0x8A,0x61,
+  0x10,0x83,0x24,0xA3,0x18,0xC7,0x38,0x08,0x32,0x8A,0x71,0x90,0x63,0x20,0xA3,0x18,
+  0x07,0x39,0xC8,0x31,0x8A,0x81,0x10,0x83,0x1C,0xA3,0x18,0x48,0x31,0x48,0x31,0x8C,
+  0x91,0x94,0xE1,0x0C,0xC4,0x20,0x09,0x45,0x86,0x82,0x04,0x74,0x15,0xA3,0x00,0x3F,
+  0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x94,0xA3,0x1C,0xE5,0xE0,0x48,0x31,0x0A,0x32,
+  0x91,0x62,0x14,0x64,0x22,0xC5,0x28,0xC8,0x44,0x8A,0x51,0x10,0x6E,0x94,0xA3,0x1C,
+  0xE5,0x28,0x47,0x39,0xCA,0x51,0x8E,0x72,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x1F,0x50,0x22,0x14,0x83,0x00,0xC7,0x20,0xC0,0x10,0x08,0x41,0x88,0x66,0x24,0xA5,
+  0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0x10,0x16,0xF1,0x80,0x63,0x18,0x9F,0x28,0xC4,0x27,
+  0x0A,0xF1,0x89,0x42,0x7C,0x63,0x18,0xE0,0x11,0x0B,0x3F,0xF8,0xC1,0x0F,0xE6,0x51,
+  0x8E,0x72,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0x84,0x51,0x8E,0x72,0x00,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xA4,0x65,0x2C,0x63,0x19,0xCB,0x58,0x00,0x3F,0xF8,
+  0xC1,0x0F,0x6E,0x61,0x8A,0x72,0x94,0xA3,0x7C,0xD9,0xCB,0x1E,0x3F,0xF8,0xC1,0x0F,
+  0x6E,0x91,0x88,0x4D,0x24,0x23,0x1B,0x83,0x20,0x46,0x26,0x08,0x51,0x88,0x4C,0x10,
+  0xA2,0x10,0x99,0x20,0x44,0x21,0x32,0x41,0x88,0x42,0x64,0x62,0x20,0x84,0xC8,0x86,
+  0x40,0x86,0x91,0x9D,0xC0,0x6C,0x45,0x30,0xDC,0x20,0x08,0x3F,0xF8,0xC1,0x0F,0x6E,
+  0x81,0x10,0x4D,0x1C,0x25,0x13,0x48,0xC9,0xC4,0x61,0x32,0x61,0x8C,0x60,0x64,0xC2,
+  0x10,0xC2,0xC8,0x44,0x31,0x84,0x91,0x89,0x42,0x0C,0x23,0x1B,0xC3,0x18,0x86,0x76,
+  0x88,0xA1,0x99,0x62,0x6C,0xC4,0x18,0x73,0x9D,0xEA,0x54,0xA7,0x3A,0xD5,0xA9,0x4E,
+  0x75,0xAA,0x53,0x9D,0xEA,0x54,0xA7,0x3A,0xD5,0xA9,0x4E,0x75,0xAA,0x53,0x9D,0xEA,
+  0x54,0xA7,0x3A,0xD5,0xA9,0x02,
+};
+
+__UG_CONST UG_U16 font_24x40r_offset[257]={
+  0,0,83,141,174,207,249,288,288,288,288,288,352,412,412,454,
+  509,540,571,607,638,667,742,773,824,849,874,909,944,973,1013,1045,
+  1076,1076,1096,1118,1180,1235,1318,1389,1403,1442,1477,1521,1552,1572,1597,1614,
+  1646,1692,1732,1787,1847,1887,1940,2002,2044,2113,2175,2199,2226,2275,2332,2381,
+  2425,2500,2544,2605,2659,2706,2767,2813,2874,2902,2949,2985,3029,3056,3085,3113,
+  3163,3205,3263,3312,3380,3413,3442,3475,3508,3566,3598,3667,3707,3738,3773,3802,
+  3835,3852,3912,3952,3999,4042,4103,4149,4210,4238,4265,4307,4347,4367,4396,4424,
+  4470,4512,4555,4582,4644,4687,4714,4745,4778,4828,4870,4938,4981,4998,5040,5071,
+  5111,5177,5212,5284,5363,5431,5502,5578,5638,5718,5787,5859,5887,5926,5957,6010,
+  6068,6139,6210,6264,6329,6383,6440,6486,6524,6574,6632,6670,6732,6783,6852,6903,
+  6952,7023,7054,7111,7149,7195,7241,7288,7324,7370,7430,7461,7529,7587,7607,7656,
+  7706,7794,7955,8059,8073,8094,8148,8209,8263,8345,8383,8403,8442,8481,8520,8584,
+  8604,8631,8664,8697,8725,8758,8793,8870,8932,8975,9018,9080,9142,9184,9250,9310,
+  9363,9432,9487,9564,9633,9704,9724,9781,9845,9900,9920,9948,9991,10024,10041,10098,
+  10131,10191,10242,10308,10368,10432,10500,10528,10575,10617,10656,10702,10741,10794,10836,10869,
+  10886,10911,10971,11037,11127,11156,11231,11273,11297,11322,11342,11358,11372,11419,11463,11494,
+  11494,
+};
+
+__UG_CONST UG_FONT_RLE font_24x40r_rle={font_24x40r_data,font_24x40r_offset,6,5};
+#endif
+
+#ifdef USE_FONT_32X53R
+/* Run length coded FONT_32X53R, generated by Tools/fontconv.py from font_32x53 */
+__UG_CONST UG_U8 font_32x53r_data[16064]={
+  0x3F,0xF8,0x01,0x81,0x56,0x76,0x42,0xD2,0x18,0x46,0x24,0x0C,0x01,0x89,0x43,0x3C,
+  0xA2,0x8C,0x81,0x74,0x83,0x18,0x04,0x19,0x06,0x37,0x88,0x52,0x8C,0x61,0x6C,0x83,
+  0x28,0xC6,0x10,0x86,0x46,0x88,0x62,0x0C,0x81,0x64,0xC3,0x18,0xC8,0x10,0x46,0x36,
+  0xA2,0x21,0x8C,0x6C,0x44,0x43,0x18,0xD9,0x88,0x86,0x30,0xB2,0x11,0x0D,0x61,0x64,
+  0xC3,0x18,0xC8,0x10,0x46,0x46,0x88,0x62,0x0C,0x81,0x68,0x83,0x28,0xC6,0x10,0xC6,
+  0x36,0x88,0x52,0x8C,0x61,0x70,0x83,0x18,0x04,0x19,0x46,0x47,0x94,0x31,0x10,0x8F,
+  0x38,0x04,0x24,0x0C,0x11,0x8D,0x61,0x48,0x78,0xB2,0x15,0x01,0x3F,0xF8,0x01,0x81,
+  0x56,0x76,0x42,0x52,0x8A,0x14,0xB4,0x9E,0x1B,0x4E,0x77,0x06,0x42,0x18,0xEE,0x14,
+  0x65,0x30,0xDB,0x29,0xCC,0x50,0x34,0x54,0x98,0xC1,0x64,0x69,0x40,0x43,0xC9,0xE8,
+  0x50,0x32,0x3A,0x94,0x8C,0x0E,0x25,0xA3,0x43,0xC9,0xD2,0x80,0x86,0x92,0xA1,0xC2,
+  0x0C,0x46,0x3B,0x85,0x19,0xCA,0x76,0x8A,0x32,0x18,0xEE,0x0C,0x84,0x30,0x9D,0x1B,
+  0x8E,0x67,0x41,0x2A,0x4A,0x12,0x9E,0x6C,0x45,0x3F,0x08,0x52,0xFA,0xCA,0x09,0x5E,
+  0x0F,0x73,0x5B,0xEB,0x98,0xBF,0xBE,0xF5,0x01,0x51,0x7D,0x40,0x50,0x1F,0x18,0xD4,
+  0x07,0x06,0xF5,0x81,0x51,0x7D,0x40,0x50,0x1F,0x10,0xD2,0x07,0x86,0xF4,0x81,0x21,
+  0x7D,0x60,0x4C,0x1F,0x10,0xD3,0x07,0x04,0xF5,0x2D,0x7F,0x75,0x6C,0x6F,0xB8,0xBB,
+  0xE0,0x1C,0x5F,0x9A,0x00,0x3F,0x60,0xC2,0x3C,0xE2,0xF2,0x9E,0x36,0xAD,0x0C,0x75,
+  0x65,0x1C,0x67,0x68,0xBB,0xBC,0xF1,0xEB,0x03,0x81,0xFA,0xC0,0x88,0x3E,0x70,0xA2,
+  0x0F,0x0C,0xEA,0x03,0xE1,0xE2,0x9A,0xE6,0x2E,0x48,0x45,0x49,0xBE,0xB3,0xA5,0x6B,
+  0x4D,0xED,0x79,0x4B,0x3C,0xE6,0x00,0x3F,0x58,0x8C,0x9B,0x54,0x96,0xB6,0xF3,0x99,
+  0xCF,0x7C,0xE6,0xEB,0xCC,0xF0,0xB8,0x24,0x34,0x2E,0x6F,0x39,0x19,0x4F,0x26,0xD2,
+  0x73,0x03,0xF7,0x7C,0xE0,0x3C,0x1F,0x38,0xCF,0x07,0xCE,0x93,0x89,0x04,0xE5,0x64,
+  0x44,0xB9,0x4B,0x42,0xF3,0xCC,0xF0,0xCC,0x67,0x3E,0xF3,0x99,0xEF,0x6C,0x28,0x5B,
+  0x53,0x6B,0x00,0x3F,0x68,0x4C,0x9B,0xD6,0x85,0x3A,0x13,0x92,0x71,0x94,0xE2,0x0C,
+  0xE9,0x57,0x3F,0xEB,0x59,0x64,0x48,0x97,0x40,0xD1,0x07,0xCA,0xF3,0x81,0x03,0x7D,
+  0xC0,0x48,0x1F,0x20,0x93,0x25,0x50,0x55,0x91,0x61,0xD5,0x90,0x8A,0x54,0x9C,0x64,
+  0x2C,0xA1,0xF9,0xCE,0x96,0xAE,0x35,0xB9,0x06,0x19,0x5A,0xD9,0x09,0x49,0x29,0x1E,
+  0xE3,0x80,0x46,0x31,0x5F,0x61,0x8A,0x57,0x9C,0xD2,0x11,0x88,0x70,0x05,0x2A,0x1B,
+  0x91,0xC8,0x46,0x24,0xB2,0x11,0x89,0x6C,0x44,0x22,0x1B,0x91,0x48,0x34,0x0E,0x22,
+  0x91,0x88,0x18,0x05,0x2A,0x11,0x39,0x08,0x44,0xA4,0x71,0x18,0xA7,0x44,0xA4,0x48,
+  0x4C,0x91,0xC8,0xC0,0x14,0x23,0x11,0xE1,0x04,0xC7,0x38,0xD3,0x08,0x0E,0x21,0xA7,
+  0x65,0x40,0x2A,0x29,0xCC,0x3A,0x0E,0xBA,0x50,0xBB,0xD6,0xB6,0xAA,0xB7,0xCC,0x02,
+  0x3F,0xF8,0x81,0x7B,0x58,0x76,0xBE,0x32,0x8E,0xA7,0x38,0xA1,0x49,0x8C,0x41,0xAC,
+  0xB2,0x98,0x82,0x54,0xA5,0x29,0x05,0xA9,0xC8,0x43,0x0A,0x42,0x95,0xA7,0x10,0x84,
+  0x22,0x11,0x21,0x08,0x45,0xA2,0xF8,0x90,0x28,0x3E,0x24,0x8A,0x0F,0x89,0xE2,0x43,
+  0x22,0x42,0x10,0xAA,0x3C,0x85,0x20,0x15,0x79,0x48,0x41,0xAA,0xD2,0x94,0x82,0x58,
+  0x65,0x31,0x05,0xB1,0x4C,0x62,0x0C,0x72,0x9D,0xE2,0x8C,0xB1,0x7C,0x28,0x5B,0x0F,
+  0x3F,0x10,0x09,0x6C,0x5C,0xD4,0x22,0x36,0xB1,0x89,0x4D,0x2C,0x6A,0x51,0x7B,0xA2,
+  0x0F,0x90,0xE8,0x03,0x44,0xFA,0x40,0xA0,0xCC,0x6B,0x5C,0xF3,0x9A,0x6A,0x58,0x86,
+  0x32,0x95,0x99,0xD0,0x64,0x28,0x34,0x99,0x29,0x4D,0x85,0x4A,0x92,0xA1,0x92,0x54,
+  0x2A,0x24,0x99,0x0A,0x49,0xC5,0x3A,0xD2,0x07,0xC6,0xF4,0x01,0x31,0x7D,0x20,0x00,
+  0x3F,0xF8,0x81,0x40,0x62,0x12,0x93,0x54,0x18,0xC4,0x10,0x20,0x19,0xD0,0x40,0x3E,
+  0x0B,0x52,0x51,0x8E,0x87,0x38,0x63,0x41,0x8A,0x58,0x94,0x12,0x16,0xA5,0x74,0x88,
+  0x41,0x19,0x62,0x50,0x86,0x18,0x94,0x21,0x06,0x75,0x45,0x29,0x61,0x51,0x8A,0x58,
+  0x90,0x32,0x1E,0xE2,0x8C,0x52,0xA4,0xA0,0xFD,0xC8,0x80,0x06,0x02,0x0A,0x83,0x18,
+  0x22,0x25,0x31,0x89,0x09,0x3F,0x08,0xFE,0xD5,0xB1,0x9E,0x6D,0x6D,0x6F,0x99,0xCB,
+  0xDD,0xF5,0xEE,0x57,0xC1,0x1A,0x4E,0x71,0x8E,0x91,0x8C,0xE5,0x3B,0x1B,0xDA,0xD2,
+  0xA5,0xAE,0x35,0xB1,0xA9,0x3D,0xEE,0x79,0x0B,0x5C,0xE2,0x21,0x8F,0x39,0xD0,0x01,
+  0x3F,0x80,0x02,0x1D,0xE6,0x21,0x8F,0xB8,0xC0,0xE5,0x3D,0xEE,0x69,0x13,0x9B,0xD6,
+  0xA5,0xAE,0xB4,0xA1,0xED,0x7C,0x65,0x24,0xE3,0x38,0xC5,0x19,0x56,0xB0,0x7E,0xD7,
+  0xBB,0x5D,0xE6,0xF2,0xB6,0xB5,0x9D,0x75,0xAC,0x5F,0x1F,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xF0,0x83,0x1F,0xE8,0x42,0x13,0xD6,0xD0,0x06,0x45,0x34,0x32,0x0D,0x6E,0x48,0xC3,
+  0x1B,0x0F,0x01,0x09,0xF3,0x81,0x95,0x7C,0xE0,0x1D,0x1F,0x78,0xC9,0x07,0x16,0x43,
+  0x40,0xF2,0x0C,0x6F,0x48,0x83,0x1B,0x13,0xD1,0x08,0x35,0xB4,0x61,0x09,0x4D,0x00,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x74,0xE6,0xC1,0x88,0x79,0x76,0x61,0x9E,
+  0x5D,0x98,0x67,0x17,0xE6,0xB9,0x89,0x79,0xCD,0x0F,0x7E,0xF0,0x83,0x1F,0x1C,0xE6,
+  0xC1,0x88,0x79,0x76,0x61,0x9E,0x5D,0x98,0x67,0x17,0xE6,0xC1,0x88,0x79,0x0D,0x3F,
+  0xF8,0x81,0x7A,0xD8,0x95,0xB6,0xF3,0x99,0xB0,0x84,0xA4,0x1C,0xE5,0x38,0xC5,0x29,
+  0x7E,0xE0,0x1D,0x1F,0x78,0xC7,0x07,0xDE,0x31,0xE4,0x21,0x0F,0x79,0xC8,0x43,0x1E,
+  0xF2,0x90,0x3F,0xF0,0x8E,0x0F,0xBC,0xE3,0x03,0x0F,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,
+  0x03,0xA6,0x24,0xE5,0x29,0x4C,0x2A,0x92,0x43,0x96,0x35,0xAC,0xA6,0x24,0x2D,0x68,
+  0x0D,0x49,0x38,0x43,0x90,0x42,0xA4,0xC2,0x30,0xE5,0x20,0x86,0x41,0x0C,0x43,0x0E,
+  0x72,0x94,0xC4,0x2C,0xC4,0x20,0x88,0x41,0xCC,0x42,0x0C,0x92,0x94,0xA4,0x2C,0xC4,
+  0x20,0x89,0x49,0x8A,0x42,0x0C,0xA2,0x94,0xC4,0x24,0xC4,0x20,0x8A,0x49,0x4A,0x42,
+  0x0C,0xB2,0x94,0xC4,0x1C,0xC5,0x20,0x8B,0x41,0x8E,0x41,0x0E,0xC2,0x1C,0x42,0x11,
+  0xE5,0x28,0x4B,0x4F,0x08,0xD3,0x84,0x96,0x90,0x66,0x11,0x4B,0x21,0x4E,0x32,0xD2,
+  0x57,0x94,0x02,0x3F,0xE0,0x13,0x9B,0xD8,0xC4,0x26,0x36,0xB1,0x89,0x4D,0x6C,0x62,
+  0x13,0x9B,0xD8,0xC4,0x26,0x36,0xB1,0x89,0x4D,0x6C,0x62,0x13,0x9B,0xD8,0xC4,0x26,
+  0x36,0xB1,0x89,0x4D,0x6C,0x62,0x13,0x9B,0xD8,0xC4,0x26,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xF0,0x83,0x1F,0xD8,0x03,0x1B,0x0B,0x39,0x86,0x36,0x14,0x62,0x10,0x8D,0x24,0xC4,
+  0x18,0xDC,0x48,0x48,0x31,0xBC,0x81,0x90,0x81,0x80,0xC4,0x20,0xC2,0x07,0x56,0xF1,
+  0x81,0x39,0x7C,0x60,0x0E,0x44,0xF8,0xC0,0x2A,0xC8,0x40,0x40,0x62,0x90,0x62,0x78,
+  0x03,0x21,0xC6,0xE0,0x46,0x42,0x0C,0xA2,0x91,0x84,0x1C,0x43,0x1B,0x0A,0x41,0x06,
+  0x36,0x16,0x02,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xE8,0x42,0x1E,0x31,0x89,
+  0x47,0x3C,0xE0,0xF2,0x7E,0xA0,0x1D,0x1F,0x78,0xC7,0x07,0x5E,0xF2,0x81,0xA6,0x14,
+  0x79,0xCC,0x43,0x26,0xF2,0x98,0x05,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,
+  0xE0,0x12,0xF3,0x90,0x89,0x3C,0xE6,0x31,0x13,0xE5,0x03,0x2D,0xF9,0xC0,0x3B,0x3E,
+  0xF0,0x8E,0x0F,0x34,0x98,0xC0,0x23,0x1E,0x31,0x89,0x87,0x2C,0x00,0x3F,0xF8,0x41,
+  0x41,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,
+  0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0xD6,0x50,0x90,0x22,0x94,0x63,0x20,0xC3,0x28,
+  0x4B,0x40,0x82,0x62,0x3A,0x94,0xA9,0x8A,0x45,0xAE,0x81,0x89,0x2C,0x66,0x01,0x3F,
+  0xF8,0x81,0x21,0x66,0x21,0x13,0xD8,0xB8,0x88,0x55,0x2A,0x43,0x9D,0x59,0x02,0x12,
+  0x94,0x72,0x0C,0x64,0x18,0x65,0x28,0x48,0x11,0x56,0x12,0x93,0x98,0xC4,0x24,0x26,
+  0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,
+  0x02,0x3F,0xD0,0xB7,0xB6,0xB5,0xAD,0xED,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,
+  0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,
+  0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x13,0x3F,0xF8,0x81,0x21,0x66,0x21,0x13,
+  0xD8,0xB8,0x88,0x55,0x2A,0x43,0x9D,0x59,0x02,0x12,0x94,0x72,0x0C,0x64,0x18,0x65,
+  0x28,0x48,0x11,0x56,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x59,0x43,0x41,0x8A,0x50,
+  0x8E,0x81,0x0C,0xA3,0x2C,0x01,0x09,0x8A,0xE9,0x50,0xA6,0x2A,0x16,0xB9,0x06,0x26,
+  0xB2,0x98,0x05,0x3F,0xF8,0x82,0x3C,0xE0,0xE2,0x9E,0x55,0xA5,0xEC,0x74,0x25,0x1C,
+  0x65,0x48,0x3F,0xCB,0x65,0x6D,0x63,0xDD,0xFA,0x58,0xD7,0x36,0x97,0xBD,0x0B,0x56,
+  0x71,0x92,0xD1,0x7C,0x68,0x53,0x17,0x9B,0xDC,0x03,0x17,0x79,0xD0,0x01,0x3F,0x08,
+  0x02,0x3D,0xE4,0x02,0x1F,0x57,0xAD,0x2C,0x75,0x27,0x2C,0xE5,0x48,0x43,0xFB,0x65,
+  0x6E,0x6B,0x1D,0xFB,0x56,0xC7,0xB6,0x96,0xB9,0xEB,0x55,0x70,0x8A,0x91,0x7C,0x66,
+  0x43,0x97,0x9A,0xD8,0xE3,0x16,0x78,0xC8,0x01,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0x81,0x6A,0x1E,0x8C,0x98,0x67,0x17,0xE6,0xD9,0x85,
+  0x79,0x76,0x61,0x9E,0x9B,0x98,0xD7,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xA2,
+  0xC0,0xEE,0x74,0xA7,0x3B,0xDD,0x59,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0x48,
+  0x0B,0xEC,0x4E,0x77,0xBA,0xD3,0x9D,0x05,0x3F,0x88,0x46,0x4C,0x62,0x72,0x8E,0x83,
+  0x28,0x42,0x23,0x07,0x31,0x8C,0x46,0x0E,0x22,0x28,0x8D,0x1C,0x50,0x23,0x05,0xE4,
+  0x88,0xF0,0xC0,0x28,0xC6,0xD0,0x09,0xA4,0x7B,0x05,0xD9,0xDE,0x41,0x14,0xF1,0x24,
+  0x81,0x1C,0xC4,0x30,0x8F,0x29,0xC8,0x41,0x04,0xF5,0x88,0x84,0x1C,0x50,0x23,0x05,
+  0xE4,0x88,0xF0,0xC0,0x28,0xC6,0xD0,0x09,0xA4,0x7B,0x05,0xD9,0xDE,0x41,0xB6,0x24,
+  0x90,0x83,0x6C,0xA6,0x20,0x07,0xD9,0x44,0x42,0x0E,0x62,0x92,0x43,0xA0,0x24,0x1E,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0x10,0x93,0xCB,0x50,0xA4,0x52,0x52,0x99,0x98,0x44,0x24,
+  0x17,0x91,0x08,0x42,0x05,0x32,0xC4,0x81,0xC8,0x53,0x10,0xF3,0x90,0x87,0x28,0xC6,
+  0x21,0x0F,0x59,0x8A,0x43,0x98,0x0F,0xB4,0xE4,0x03,0x2D,0xF9,0x40,0x63,0x48,0x63,
+  0x16,0xF2,0x10,0xC7,0x24,0xE5,0x21,0x8F,0x41,0x08,0x44,0x9E,0x53,0x98,0x88,0x3C,
+  0x50,0x22,0xD0,0x93,0x48,0xD4,0x28,0x12,0xA9,0xD6,0x00,0x8A,0xD1,0x42,0xB4,0x2E,
+  0x01,0xB9,0x89,0x3C,0x30,0x2A,0x4F,0x31,0x0A,0x54,0x1E,0xA2,0x90,0xC6,0x40,0x83,
+  0x19,0x4C,0x91,0x06,0x33,0x14,0x33,0x0D,0x66,0x24,0x86,0x1A,0xCC,0x38,0x8C,0x45,
+  0x14,0x62,0x18,0xAC,0x18,0xC5,0x28,0x1A,0x24,0x0C,0xE7,0x88,0xF2,0x2D,0xC2,0x8C,
+  0xA6,0x30,0xAD,0x29,0xCC,0x68,0x08,0x05,0x16,0xC2,0x71,0x86,0x80,0x5A,0x31,0x8A,
+  0x51,0x30,0x63,0x10,0x85,0x58,0xE6,0x18,0xCC,0xA0,0x4C,0x32,0x98,0x31,0x19,0x65,
+  0x30,0x43,0x2A,0xCC,0x60,0x06,0x64,0x1A,0xA2,0x90,0xA7,0x40,0xC5,0x28,0x4F,0x89,
+  0xE0,0x43,0x26,0x07,0x89,0x4B,0x49,0x41,0x33,0x3F,0x88,0xD0,0xCA,0x50,0x67,0xC6,
+  0x51,0x8A,0xC6,0x40,0x61,0x49,0xCE,0x74,0x8A,0xB2,0x98,0x88,0x09,0xA4,0x29,0x90,
+  0x7C,0x8A,0x33,0x21,0xE2,0xD0,0x87,0x34,0xA6,0x60,0x0D,0x69,0x4A,0xB2,0x16,0xD2,
+  0x10,0x85,0x29,0xA4,0x21,0xC9,0x43,0x48,0x43,0x12,0x32,0x24,0x83,0x38,0xE5,0x20,
+  0x46,0x22,0x88,0x63,0x08,0x73,0xA4,0x81,0x3C,0x4E,0x41,0x01,0x81,0x1A,0xC3,0xA2,
+  0xE5,0xA8,0x29,0x45,0xA8,0x2A,0x14,0x62,0x15,0xDA,0x42,0x17,0x94,0x90,0x11,0x24,
+  0x5C,0xC6,0x08,0x91,0x22,0x42,0xF2,0x04,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,
+  0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x61,0x5E,0x58,0xC2,0x12,0x96,0xB0,0x84,0x25,0x2C,
+  0x0D,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0x00,0x5F,0xE6,0xFC,0xF2,0xB6,
+  0xB1,0x5F,0xAD,0x65,0x49,0x69,0x4A,0x0F,0xBA,0x50,0x73,0xB6,0xC3,0x98,0xCE,0x2C,
+  0x25,0x2C,0x49,0x19,0x0B,0x52,0xC6,0x72,0x94,0xB2,0x18,0xA5,0x2C,0x06,0x39,0x49,
+  0x51,0xCE,0x42,0x90,0x94,0x10,0x24,0x25,0x3F,0xF8,0xC1,0x0F,0x30,0x92,0x12,0x82,
+  0xA4,0x84,0x28,0x67,0x29,0xC8,0x49,0x8C,0x52,0x16,0xA3,0x94,0xE5,0x28,0x63,0x41,
+  0xCA,0x58,0x92,0x12,0x96,0xC5,0x74,0x86,0x39,0xDB,0x69,0xD0,0x85,0x9E,0x34,0x25,
+  0x69,0x2D,0xAB,0xFA,0x17,0xDF,0xF2,0x37,0xCD,0x05,0x3F,0xF8,0xC1,0x0F,0xC8,0x00,
+  0x1B,0xB8,0xC0,0xE5,0x10,0x28,0x31,0xC8,0x49,0x8A,0x82,0x92,0xE1,0x9C,0x44,0x30,
+  0x6A,0x18,0x8C,0x58,0x92,0x41,0x22,0x23,0x98,0xA8,0x45,0x46,0x30,0x4B,0x32,0xDA,
+  0x30,0x18,0x95,0x08,0x26,0x25,0xC3,0x31,0x49,0x51,0x4E,0x62,0x10,0xB3,0x1C,0xE2,
+  0x2C,0xAF,0x99,0x03,0x3F,0xF8,0x81,0x41,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,
+  0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0x98,0x5B,0xDB,0xDA,0xD6,0x76,0x49,0x62,0x12,
+  0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0x00,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0x01,0x8A,0x8A,0x51,0xA2,
+  0x62,0x94,0x88,0x18,0xE6,0x33,0xDD,0xD9,0x50,0x05,0x3F,0xF8,0xC1,0x0F,0x7E,0x50,
+  0x92,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,
+  0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x09,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0x01,0x8A,0x5A,0xD4,0xA2,
+  0x16,0xB5,0xA8,0x45,0x2D,0x6A,0x11,0x3F,0xF8,0x41,0x17,0xE4,0x01,0x17,0xF7,0xB0,
+  0x68,0x45,0x2B,0x5A,0xD1,0x8A,0x56,0xB4,0xA2,0x15,0xA9,0x49,0x4D,0x6A,0x52,0x93,
+  0x8A,0x56,0xB4,0xA2,0x15,0xAD,0x68,0x45,0x2B,0x5A,0x11,0x7B,0xDC,0x02,0x0F,0x39,
+  0x00,0x3F,0xF8,0x81,0xCC,0x4A,0xEA,0xE9,0xCC,0x5B,0x1F,0x08,0x94,0x72,0x94,0x74,
+  0xAC,0x03,0x19,0xCD,0x3C,0x85,0x2B,0x0F,0xF1,0x88,0x43,0x40,0xD2,0x10,0x90,0x34,
+  0x04,0x24,0x0D,0x01,0x49,0x43,0x40,0xD2,0x10,0x90,0x38,0xC4,0x23,0x4F,0xE1,0xCA,
+  0x63,0x34,0x03,0x1D,0xEB,0x48,0xCA,0x51,0xD4,0x07,0x82,0xE5,0x33,0xED,0xD1,0x92,
+  0x01,0x3F,0xF8,0xC1,0x0F,0x7E,0x50,0x8D,0x8D,0x48,0x64,0x23,0xD2,0xE0,0x88,0x34,
+  0x38,0x12,0x11,0x8E,0x44,0x84,0x23,0xD1,0xE8,0x08,0x44,0x3A,0x02,0x91,0x8E,0x40,
+  0xA4,0x23,0xCF,0x07,0xCE,0xF3,0x81,0xF3,0x7C,0xE0,0x38,0x1F,0x40,0xCE,0x07,0x50,
+  0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x02,0x3F,0xF8,
+  0xC1,0x0F,0xF8,0x02,0x11,0xED,0x3C,0x25,0x43,0x0F,0xC1,0xD4,0x43,0xAE,0xF5,0x10,
+  0x8B,0x39,0xA4,0x42,0x02,0x71,0x08,0x75,0x08,0xE2,0x90,0xC9,0x18,0xC4,0x21,0x92,
+  0x39,0x88,0x43,0x22,0x83,0x10,0x87,0x40,0x45,0x21,0x4E,0x71,0xCA,0x42,0x9C,0xD2,
+  0x14,0x86,0x3C,0x45,0x31,0x0D,0x79,0x8E,0x71,0x1C,0x02,0xC9,0x87,0x40,0x11,0x22,
+  0xD1,0x8B,0xC8,0xB4,0x26,0x52,0x9D,0x8A,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,
+  0xB4,0x3C,0xA5,0x23,0x0F,0xF1,0xC8,0x43,0xBC,0xE2,0x90,0x85,0x40,0xA4,0x21,0x0C,
+  0x81,0x48,0x43,0x18,0x02,0x91,0x86,0x30,0x04,0x22,0x0D,0x61,0x08,0x44,0x1A,0xC2,
+  0x10,0x88,0x34,0x84,0x29,0x0F,0x69,0xC8,0x62,0x9C,0xD2,0x94,0xE4,0x38,0xC4,0x29,
+  0x09,0x62,0xCA,0x63,0x8A,0x12,0x14,0xC5,0x3C,0x6F,0x30,0xC6,0x89,0xDC,0x30,0xA3,
+  0x56,0x44,0x4A,0x1D,0xCF,0x3A,0x0A,0x63,0x0F,0x3F,0xF8,0x01,0x5F,0xDC,0xD3,0x22,
+  0x36,0xA9,0x2B,0x35,0x02,0x39,0xCF,0x40,0x4C,0x53,0x10,0xF2,0x18,0x64,0x34,0x08,
+  0x09,0x4F,0x42,0x40,0xB3,0x10,0xEF,0x30,0xA4,0x3B,0x0D,0xD9,0xCE,0x43,0xB4,0x03,
+  0x91,0xEC,0x03,0xE7,0xF9,0xC0,0x79,0x3E,0x70,0x9E,0x0F,0x9C,0xE7,0x03,0xE7,0x24,
+  0x31,0x89,0x49,0x4C,0x62,0x02,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x78,0xE5,
+  0x99,0x0F,0x79,0xE6,0x43,0x9E,0xF9,0x14,0x67,0x42,0xC4,0x29,0x0A,0x81,0x88,0x53,
+  0x14,0x02,0x11,0xA7,0x28,0x04,0x22,0x4E,0x51,0xCA,0x43,0x9C,0xA2,0x94,0x87,0x38,
+  0x65,0x21,0x4E,0x71,0xCA,0x52,0x1A,0xF2,0x94,0xA5,0x30,0xE5,0x29,0x4C,0x51,0xCC,
+  0x53,0x98,0x63,0x1C,0xA8,0x34,0x32,0x2A,0x4E,0x8C,0xCA,0xE3,0xA6,0x02,0x31,0xF6,
+  0x00,0x3F,0xF8,0xC1,0x0F,0x52,0x56,0x52,0x4F,0x6B,0xFC,0xFA,0x40,0xA0,0x94,0x21,
+  0x25,0x74,0x94,0xC4,0x44,0x07,0x21,0x8C,0x81,0x8A,0x32,0x9C,0xF2,0x14,0x85,0x3C,
+  0xC5,0x21,0xCB,0x88,0x48,0x53,0x14,0x12,0x91,0x86,0x2C,0x24,0x22,0x0D,0x59,0x48,
+  0x44,0x1A,0xB2,0x90,0x88,0x34,0x64,0x29,0x10,0x69,0xC8,0x52,0x9E,0xD2,0x10,0xA6,
+  0x34,0xC5,0x21,0x8C,0x59,0xCC,0x43,0x98,0x73,0x1C,0x88,0x30,0x34,0x22,0x8D,0x94,
+  0x4A,0x03,0xCF,0xA6,0x22,0x3F,0xF8,0xC1,0x0F,0x7E,0x10,0x15,0xB8,0xC0,0xC5,0x1B,
+  0x4F,0xD9,0xCC,0x53,0xB0,0xF4,0x14,0x6B,0x3D,0x85,0x6A,0x4F,0x99,0xDC,0x53,0xA2,
+  0x26,0x95,0x67,0x59,0xA5,0x59,0x58,0x61,0xD2,0x56,0x94,0xD4,0x15,0x24,0x7D,0xC5,
+  0x48,0x61,0x29,0xD0,0x58,0x06,0x54,0x96,0x00,0x9D,0x2C,0x55,0x6B,0x62,0x8F,0x5B,
+  0x00,0x3F,0xF8,0xC1,0x0F,0xE8,0xC3,0x2E,0xEC,0x24,0xAE,0x5A,0x06,0x9C,0x1A,0x21,
+  0xA3,0x27,0x1C,0xE3,0x3C,0x31,0x28,0x89,0x79,0x4A,0xC1,0x96,0xF2,0x10,0x24,0x35,
+  0xA5,0x29,0xC9,0x79,0x48,0x43,0x16,0xF3,0x90,0x86,0x2C,0xE6,0x21,0x0D,0x61,0x8C,
+  0x43,0x1A,0xC2,0x9C,0x86,0x34,0x45,0x41,0x0D,0x69,0x4A,0xA2,0x96,0xE2,0x98,0xA2,
+  0x29,0xE4,0x81,0xC2,0x41,0xCA,0xF3,0x08,0x44,0x98,0xA8,0x15,0x52,0x5A,0x07,0xAC,
+  0xCC,0xE2,0xD2,0xC5,0x1A,0x3F,0xF8,0xC1,0x0F,0x46,0xA4,0xB6,0x13,0x36,0x45,0x92,
+  0x0D,0x89,0x28,0x43,0xA0,0x73,0x1C,0x86,0x3C,0x66,0x31,0x0C,0x71,0x4A,0x53,0x18,
+  0xD2,0x94,0xA7,0x2C,0xA4,0x21,0x50,0x59,0x48,0x43,0x22,0xB2,0x90,0x86,0x44,0x64,
+  0x21,0x0D,0x89,0xC8,0x42,0x1A,0x12,0x11,0xA5,0x34,0x24,0x1A,0x0B,0x71,0xCA,0x43,
+  0x94,0xF2,0x14,0x67,0x28,0x05,0x32,0x0C,0x41,0x4E,0x64,0x92,0x72,0x20,0x49,0x1A,
+  0x8A,0xFA,0x40,0xB8,0xB8,0xA6,0x3D,0x5A,0x32,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0x01,0x85,0x18,0x94,0x21,0x06,0x65,0x88,0x41,0x19,
+  0x62,0x50,0x86,0x18,0x94,0x21,0x06,0x65,0x88,0x41,0x19,0x62,0x10,0x3F,0xF8,0xC1,
+  0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0x01,0x85,0x18,0x54,0x8C,0x08,
+  0x31,0xA8,0x18,0x11,0x62,0xD0,0x50,0x22,0xC4,0x3C,0x09,0x31,0x4F,0x42,0x8C,0x9B,
+  0x10,0xC3,0x2A,0xC4,0x24,0x3F,0xF8,0x01,0x12,0xE8,0x30,0x0F,0x79,0xC4,0x05,0x2E,
+  0xEF,0x71,0x4F,0x9B,0x58,0x12,0x90,0xB5,0x04,0x45,0x25,0x03,0x49,0xCB,0x50,0x50,
+  0x52,0x10,0x94,0x14,0xE4,0x24,0x07,0x31,0xC9,0x41,0x4A,0x92,0x10,0x92,0x24,0x64,
+  0x24,0x0B,0x11,0xC9,0x42,0x42,0xD2,0x10,0x90,0x34,0xE4,0x23,0x0F,0xF1,0xC8,0x43,
+  0x3A,0x12,0x11,0x8E,0x44,0x64,0x23,0x13,0x01,0x3F,0xF8,0x41,0x40,0x0C,0x72,0x12,
+  0x83,0x9C,0xC4,0x20,0x27,0x31,0xC8,0x49,0x0C,0x72,0x12,0x83,0x9C,0xC4,0x20,0x27,
+  0x31,0xC8,0x49,0x0C,0x72,0x12,0x83,0x9C,0xC4,0x20,0x27,0x31,0xC8,0x49,0x0C,0x72,
+  0x12,0x83,0x9C,0xC4,0x20,0x27,0x31,0xC8,0x49,0x0C,0x72,0x12,0x83,0x9C,0xC4,0x20,
+  0x27,0x31,0xC8,0x49,0x0C,0x72,0x12,0x83,0x9C,0xC4,0x20,0x27,0x31,0xC8,0x49,0x0C,
+  0x72,0x12,0x83,0x9C,0xC4,0x20,0x27,0x31,0x08,0x3F,0xD0,0xC9,0x44,0x36,0x12,0x11,
+  0x8E,0x44,0xA4,0x23,0x0F,0xF1,0xC8,0x43,0x3E,0xD2,0x10,0x90,0x34,0x24,0x24,0x0B,
+  0x11,0xC9,0x42,0x46,0x92,0x10,0x92,0x24,0xA4,0x24,0x07,0x31,0xC9,0x41,0x4E,0x52,
+  0x10,0x94,0x14,0x04,0x2D,0x43,0x49,0xC9,0x40,0xD4,0x12,0x94,0x95,0x04,0x84,0x4D,
+  0xED,0x71,0xCF,0x5B,0xE0,0x12,0x0F,0x79,0xCC,0x81,0x0E,0x3F,0xF8,0xC1,0x0F,0x36,
+  0xD4,0xA2,0x16,0xB5,0x88,0x2D,0x30,0x89,0x49,0x67,0x1C,0x42,0x91,0xC2,0x38,0x24,
+  0x3A,0x85,0x71,0x08,0x84,0x0A,0xE3,0x90,0x27,0x15,0xC6,0x21,0x8E,0x2A,0x8C,0x43,
+  0x1A,0xA3,0x18,0x87,0x30,0x05,0x24,0x0C,0x09,0x8B,0x42,0x46,0x92,0x10,0xB2,0x1C,
+  0x85,0x34,0x84,0x31,0xDD,0xD9,0xD2,0xB5,0x26,0xB7,0x00,0x3F,0xE8,0x99,0x29,0xC1,
+  0xDB,0xE9,0x4C,0x29,0xE9,0x3A,0x92,0xA9,0x8C,0x55,0xA6,0x92,0x95,0xA8,0x6C,0x24,
+  0x22,0x1D,0x79,0x48,0x93,0x92,0xF1,0x0C,0xE5,0x1D,0xC4,0x19,0x89,0x34,0x46,0x33,
+  0x10,0x6A,0x8C,0x66,0x1C,0x27,0x31,0xC5,0x68,0x86,0x51,0x1C,0x52,0x8C,0x66,0x18,
+  0xE4,0x21,0xC5,0x68,0x46,0x41,0x9E,0x52,0x8C,0x66,0x14,0xE3,0x29,0xC6,0x68,0x08,
+  0x31,0x9C,0x62,0x8C,0x67,0x10,0x83,0x31,0xC7,0x78,0xC8,0x30,0x14,0x93,0x8C,0xC7,
+  0x08,0xC3,0x38,0x0A,0x81,0x3C,0xD6,0x33,0xCE,0x65,0x79,0xC8,0x43,0x1E,0x69,0x88,
+  0xC9,0x6B,0xD8,0xA4,0x2E,0xB4,0x95,0xCD,0x64,0x66,0x33,0xDF,0xC8,0x04,0x12,0xAE,
+  0x82,0x78,0x0B,0x21,0xDC,0x52,0x08,0x87,0x1A,0xC2,0x15,0x88,0x70,0xA8,0x21,0x9C,
+  0x5A,0x08,0xD7,0x10,0xE2,0x35,0x83,0x84,0x6D,0x20,0x63,0x0B,0x88,0xF9,0xD0,0xB6,
+  0x36,0xB5,0xAD,0x4D,0x5D,0x6C,0x7A,0x4D,0x4C,0xE8,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0x60,0x7D,0x40,0x50,0x1F,0x10,0xD4,0x07,0x04,0xF5,0x01,0x41,0x7D,0x40,0x50,0x24,
+  0x21,0x0C,0xA1,0x48,0x42,0x18,0x42,0x91,0x84,0x30,0x84,0x22,0x09,0x61,0x08,0x45,
+  0x12,0xC2,0x10,0x8A,0x24,0x84,0x21,0x14,0x49,0x08,0x43,0x28,0x92,0x94,0x85,0x50,
+  0x04,0x31,0x0B,0xA1,0x08,0x62,0x16,0x42,0x95,0xE3,0x24,0xA5,0x22,0x06,0x4A,0x4A,
+  0x55,0x08,0x12,0x14,0x84,0x58,0x4D,0x30,0x84,0xB9,0xD6,0x00,0x2F,0x55,0xB8,0x0C,
+  0x1D,0x8C,0x2B,0x89,0x6A,0x0D,0x3F,0xF8,0x81,0x9D,0xD2,0x47,0x4E,0xF0,0x76,0x79,
+  0x4B,0x49,0xCA,0x50,0x83,0x30,0x13,0x99,0xCB,0x4C,0xC6,0x2A,0x55,0xA9,0xCA,0x55,
+  0x28,0x82,0x15,0x8A,0x64,0x64,0x2A,0x59,0x91,0xC8,0x46,0x24,0xB2,0x11,0x89,0x6C,
+  0x44,0x22,0x1B,0x91,0xC8,0x46,0x24,0xB2,0x11,0x89,0x6C,0x44,0x22,0x1B,0x91,0x8A,
+  0x36,0x28,0x92,0x11,0x8A,0x64,0x84,0x2A,0x18,0xA1,0xCA,0x45,0x00,0x3F,0xF8,0x81,
+  0xFA,0x01,0x41,0x7D,0x40,0x50,0x1F,0x10,0xD4,0x07,0x04,0xF5,0x01,0x41,0x91,0x8C,
+  0x50,0x24,0x23,0x14,0xC9,0x08,0x45,0x32,0x42,0x91,0x8C,0x50,0x24,0x23,0x14,0xC9,
+  0x08,0x45,0x32,0x42,0x11,0xAC,0x50,0xE5,0x22,0x16,0xB9,0x88,0x55,0xAA,0x62,0x95,
+  0xAA,0x5C,0x65,0x2A,0xD8,0x79,0x4E,0x96,0x92,0xB4,0xE5,0xEE,0x7E,0x74,0x84,0xA8,
+  0x02,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,
+  0xA8,0x0F,0x08,0xEA,0x03,0x82,0x22,0x0A,0x59,0x08,0x45,0x14,0xB2,0x10,0x8A,0x28,
+  0x64,0x21,0x14,0x51,0xC8,0x42,0x28,0xA2,0x90,0x85,0x50,0x44,0x21,0x0B,0xA1,0x88,
+  0x42,0x16,0x42,0x11,0x85,0x2C,0x84,0x22,0x0A,0x59,0x08,0x45,0x14,0xB2,0x10,0x8A,
+  0x28,0x64,0x21,0x14,0x51,0xC8,0x42,0x28,0xA2,0x90,0x85,0x50,0x44,0x21,0x0B,0xA1,
+  0x88,0x42,0x16,0x42,0x91,0x8C,0x50,0x24,0x23,0x14,0xC9,0x48,0x4C,0x00,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,
+  0xEA,0x03,0x82,0x22,0x0B,0x11,0xC9,0x42,0x44,0xB2,0x10,0x91,0x2C,0x44,0x24,0x0B,
+  0x11,0xC9,0x42,0x44,0xB2,0x10,0x91,0x2C,0x44,0x24,0x0B,0x11,0xC9,0x42,0x44,0xB2,
+  0x10,0x91,0x2C,0x44,0x24,0x0B,0x11,0xC9,0x42,0x44,0xB2,0x10,0x91,0x2C,0x44,0x24,
+  0x31,0x89,0x09,0x3F,0xF8,0x41,0x90,0xD2,0x47,0x4E,0xF0,0x76,0x79,0x4B,0x49,0xCA,
+  0x50,0x83,0x30,0x13,0x99,0xCB,0x4C,0xC6,0x2A,0x55,0xA9,0xCA,0x55,0x28,0x82,0x15,
+  0x8A,0x64,0x64,0x2A,0x59,0x91,0x88,0x56,0x24,0xB2,0x11,0x89,0x38,0x24,0x21,0x12,
+  0x71,0x48,0x42,0x24,0xE2,0x90,0x84,0x48,0xC4,0x21,0x09,0x91,0x88,0x43,0x12,0x22,
+  0x11,0x87,0x24,0x44,0x2A,0x0D,0xA4,0x48,0x03,0x29,0xD2,0x40,0xAA,0x30,0x90,0x2A,
+  0x0C,0x04,0x3F,0xF8,0xC1,0x0F,0xC0,0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,
+  0x20,0xA8,0x0F,0x08,0x91,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,
+  0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0xC6,0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,
+  0x3E,0x20,0xA8,0x0F,0x08,0x3F,0xF8,0xC1,0x0F,0x40,0x92,0x11,0x8A,0x64,0x84,0x22,
+  0x19,0xA1,0x48,0x46,0x28,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0xA1,0x48,0x46,0x28,
+  0x92,0x11,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0xEA,0x03,0x82,
+  0x22,0x19,0xA1,0x48,0x46,0x28,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0xA1,0x48,0x46,
+  0x28,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0x01,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x94,0xC4,0x84,0x22,0x19,0xA1,0x48,0x56,0x26,0xA2,0x91,0x89,0x68,0x64,0x22,0x1A,
+  0x99,0x88,0x46,0x26,0xA2,0x91,0x89,0x68,0x64,0x22,0x59,0x99,0x08,0x56,0x28,0x62,
+  0x1D,0xEA,0x03,0xA1,0xFA,0x40,0xA8,0xFC,0xD5,0x31,0x0D,0x3F,0xF8,0xC1,0x0F,0xC0,
+  0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0x32,0xC8,0x04,
+  0x36,0x2E,0x62,0x95,0xCA,0x50,0x13,0x9C,0xF2,0x0C,0x67,0x34,0xC7,0x01,0x4D,0x72,
+  0x3C,0xB3,0x1C,0xCE,0x34,0x27,0x3B,0xCF,0xB9,0x8C,0x74,0xAC,0x42,0x9D,0x8A,0x58,
+  0x87,0x1A,0x98,0xA1,0x84,0x56,0xA8,0xC0,0x11,0x79,0xCC,0x82,0x0E,0x3F,0xF8,0xC1,
+  0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0xEA,
+  0x03,0x22,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,
+  0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x01,0x3F,0xA0,0x3F,0x20,0xA8,
+  0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x8E,0x9B,0x58,0xC6,0x32,0x96,0xAD,0x6D,
+  0x6D,0x2B,0x63,0xD3,0x6B,0x5A,0xA4,0xAE,0x73,0xA1,0x0A,0x5D,0xE7,0x3A,0x57,0x9A,
+  0x58,0xF3,0x7E,0x40,0x50,0x1F,0x10,0xD4,0x07,0x04,0xF5,0x01,0x01,0x3F,0xF8,0xC1,
+  0x0F,0xC0,0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0xD4,0xAA,0x36,
+  0xB9,0xA9,0x4D,0x6E,0x6A,0x55,0x9B,0x5A,0xD5,0x26,0x37,0xB5,0xAA,0x4D,0xAD,0x6A,
+  0x93,0x9B,0xA8,0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0x00,0x3F,0xF8,
+  0xD7,0x19,0xC5,0xEA,0xE5,0x6D,0x67,0x69,0x49,0xD7,0x89,0x8E,0x55,0xAA,0x52,0x95,
+  0xAB,0x50,0x24,0x23,0x53,0xC9,0x8A,0x44,0x36,0x22,0x91,0x8D,0x48,0x64,0x23,0x12,
+  0xD9,0x88,0x44,0x36,0x22,0x91,0x8D,0x48,0x25,0x2B,0x13,0xC9,0x08,0x55,0xAE,0x52,
+  0x95,0xAA,0x58,0x27,0x3A,0x57,0x5A,0x52,0xB6,0xB7,0xEC,0x55,0x31,0x9E,0x0B,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,
+  0x08,0xEA,0x03,0x82,0x22,0x0C,0x09,0x09,0x43,0x42,0xC2,0x90,0x90,0x30,0x24,0x24,
+  0x0C,0x09,0x09,0x43,0x42,0xC2,0x90,0x90,0x30,0x24,0x24,0x4B,0x09,0xC9,0x42,0xC4,
+  0xA2,0x10,0xB1,0x24,0x65,0x2C,0x47,0x21,0x4D,0x61,0x48,0x68,0xBE,0xB3,0xA5,0x8B,
+  0x35,0x3F,0xF8,0xD7,0x19,0xC5,0xEA,0xE5,0x6D,0x67,0x69,0x49,0xD7,0x89,0x8E,0x55,
+  0xAA,0x52,0x95,0xAB,0x50,0x24,0x23,0x53,0xC9,0x8A,0x44,0x36,0x22,0x91,0x8D,0x48,
+  0x64,0x23,0x12,0xD9,0x88,0x44,0x36,0x22,0x91,0xAD,0x44,0x25,0x3B,0x11,0xC9,0x10,
+  0x54,0xAE,0x14,0x95,0xAA,0x04,0x05,0x3A,0xD1,0x11,0x0A,0x94,0x96,0x34,0x94,0x68,
+  0x17,0x25,0xCA,0x86,0x91,0x6A,0x52,0xA8,0xB8,0x18,0x6B,0x3D,0x05,0x1E,0x72,0x00,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0x60,0x7D,0x40,0x50,0x1F,0x10,0xD4,0x07,0x04,0xF5,0x01,
+  0x41,0x7D,0x40,0x50,0x64,0x21,0x22,0x59,0x88,0x48,0x16,0x22,0x92,0x85,0x88,0x64,
+  0x21,0x22,0x59,0x4A,0x48,0x96,0xF3,0x11,0x25,0x79,0x44,0x51,0x5D,0x41,0xDA,0x56,
+  0x8E,0x22,0xA0,0xAD,0x14,0x66,0x40,0xDA,0x2B,0x52,0xD6,0x10,0x84,0x31,0x05,0x61,
+  0x8A,0x41,0x99,0x81,0x0C,0x5C,0x62,0x32,0x0B,0x3A,0x00,0x3F,0xF8,0xC1,0x0F,0x4A,
+  0x03,0x15,0x4C,0x3D,0xE4,0x62,0x4E,0xA9,0x5C,0x53,0xAA,0xD7,0x10,0xAA,0x14,0xA6,
+  0x21,0x14,0x39,0x0C,0x53,0xA4,0x72,0x98,0x86,0x48,0x24,0x31,0x0C,0x91,0x48,0x62,
+  0x18,0x22,0x11,0xA5,0x30,0x44,0x22,0x8A,0x59,0x88,0x44,0x96,0xB2,0x10,0x89,0x2C,
+  0x65,0x21,0x12,0x59,0x8C,0x42,0x24,0xC2,0x94,0x84,0x4C,0x65,0x31,0x08,0xA1,0xC8,
+  0x62,0x8E,0x42,0x11,0xE6,0x10,0xA5,0x22,0x0C,0xAC,0x0A,0xE3,0x2E,0xD2,0x30,0x55,
+  0xB5,0x06,0x3E,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,
+  0x4C,0x62,0x12,0x93,0xF8,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0xEA,
+  0x03,0x82,0x22,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,
+  0x49,0x4C,0x00,0x3F,0xF8,0xC1,0x0F,0xC0,0xCC,0xF1,0xCC,0x5F,0xDF,0xFA,0x40,0x70,
+  0x0F,0x6C,0xE0,0x12,0x97,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x02,0x97,
+  0xB7,0xBC,0xA6,0x3D,0xD5,0x07,0x42,0xF5,0x2D,0x7F,0xF1,0x2C,0x03,0x49,0xA0,0x49,
+  0x6C,0xDE,0xC4,0x2E,0xD5,0xA9,0x2E,0x75,0xAA,0x4B,0x9D,0xEA,0x52,0xA7,0xBA,0xB4,
+  0xA9,0xAB,0x45,0x2D,0x5A,0x55,0xBA,0xCE,0x85,0x2E,0x74,0xA1,0x0A,0x5D,0xE8,0x42,
+  0x15,0xBA,0xD0,0xA5,0xA2,0xD6,0xBC,0x24,0x0E,0xC9,0x90,0xD5,0x0A,0xCB,0xEB,0xF5,
+  0x4F,0x87,0x14,0x6D,0xAF,0x59,0xD5,0xE9,0x48,0x18,0xC2,0xF0,0x95,0x2C,0x45,0x6D,
+  0x62,0x1B,0x1A,0x4F,0x79,0x4A,0xD4,0xAD,0xEA,0x35,0x29,0x1B,0x65,0x77,0xB1,0xBB,
+  0x55,0xF0,0x99,0x89,0x1D,0x69,0xA0,0x82,0x27,0x28,0xC1,0x0D,0x6A,0x68,0x84,0x2A,
+  0x96,0xA1,0x0C,0x65,0xAA,0x23,0x19,0x2B,0x3D,0x26,0x43,0xCC,0xD9,0x90,0x62,0xBC,
+  0x74,0x98,0x10,0x11,0x67,0x44,0xC2,0x29,0x5D,0xBA,0xD6,0xD4,0xA6,0x75,0xA5,0xCD,
+  0x3C,0x41,0x1A,0x0F,0x81,0x42,0x73,0xA0,0xCF,0x24,0x69,0x3B,0x0C,0xCA,0xCC,0x83,
+  0x2E,0x13,0x25,0xCA,0x50,0x87,0x2A,0x96,0xA1,0x46,0x56,0x28,0xC1,0x0D,0x2A,0x78,
+  0x82,0x0E,0x7E,0xA0,0xC5,0x4C,0xE2,0x02,0x1F,0x17,0xB9,0xA9,0x4D,0x6E,0x72,0x91,
+  0x9B,0x5C,0xE4,0x26,0xB7,0x86,0x74,0x94,0xE2,0x0C,0xE9,0x87,0xD8,0xC3,0x22,0xF6,
+  0xB0,0x88,0x3D,0x2C,0x62,0x4F,0x7B,0xDC,0x02,0x93,0x58,0xCC,0x01,0x3F,0xF8,0xC1,
+  0x0F,0x8E,0x42,0x91,0xCB,0x50,0xC4,0x3A,0x14,0xA9,0x10,0x45,0xA8,0x44,0x11,0x69,
+  0x51,0x24,0x3A,0x01,0xA1,0x08,0x74,0x04,0x42,0x91,0xE7,0x0C,0x84,0x22,0xCE,0x21,
+  0x08,0x45,0x1A,0x63,0x10,0x8A,0x2C,0xE7,0x20,0x14,0x51,0x0E,0x42,0x28,0x92,0x9C,
+  0x84,0x50,0x04,0x39,0x0A,0xA1,0xC8,0x71,0x16,0x42,0x91,0xE2,0x34,0x84,0x22,0xC4,
+  0x71,0x08,0x45,0x86,0xF3,0x10,0x8A,0x08,0x07,0x22,0x14,0x09,0x4E,0x44,0x28,0x35,
+  0x11,0x2A,0x51,0x84,0x42,0x15,0xA1,0x8E,0x45,0x28,0x73,0x11,0xAA,0x60,0x04,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0x88,0x3E,0x20,0x89,0x0F,
+  0x48,0xE2,0x03,0x92,0xF8,0x80,0x24,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,
+  0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,
+  0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x01,0x3F,0x60,0x03,0x3D,0xE4,0x02,0x9F,0x17,
+  0xBD,0xE8,0x45,0x2F,0x7A,0xD1,0x8B,0x5E,0xF4,0xA2,0x37,0xB9,0xC9,0x4D,0x6E,0x7A,
+  0xD1,0x8B,0x5E,0xF4,0xA2,0x17,0xBD,0xE8,0x45,0x2F,0x7A,0x0F,0x5C,0xE4,0x41,0x07,
+  0x3F,0xF8,0xC1,0x0F,0x30,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,
+  0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,
+  0x20,0x29,0x21,0x48,0x4A,0x88,0x0F,0x48,0xE2,0x03,0x92,0xF8,0x80,0x24,0x3E,0x20,
+  0x01,0x3F,0xF8,0x41,0x13,0xE4,0xF1,0x9A,0x16,0xAD,0x49,0x4D,0x6A,0x4A,0x93,0x9A,
+  0xD4,0xA4,0xA6,0x54,0xA5,0x2A,0x4D,0x6E,0x72,0x93,0x9B,0xDC,0xE4,0x26,0x37,0xB9,
+  0xE9,0x45,0x2F,0x7A,0xD1,0x7B,0xE0,0x22,0x0F,0x3A,0x00,0x2A,0x89,0x49,0x4C,0x62,
+  0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,
+  0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,
+  0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,
+  0xE0,0x07,0x3F,0x80,0x02,0x2D,0xE6,0x21,0x0F,0x99,0xC4,0x25,0x2E,0x31,0x91,0xC7,
+  0x2C,0xE8,0x00,0x3F,0xF8,0xC1,0x0F,0x86,0xE2,0xA6,0x8E,0x28,0x8B,0x23,0x49,0xD3,
+  0x48,0xE2,0x34,0x92,0x90,0xC2,0x64,0x04,0x21,0x47,0xC1,0x48,0x32,0x12,0x82,0x91,
+  0x64,0x24,0x04,0x23,0x08,0x49,0x08,0x46,0x90,0xA1,0x10,0x8C,0x20,0x43,0x21,0x18,
+  0x41,0x86,0x32,0x32,0x82,0x8C,0x84,0x64,0xE5,0x18,0xC9,0xD0,0xCA,0x31,0x10,0xA2,
+  0x9D,0x62,0x1C,0x84,0xC3,0x9D,0xE6,0x34,0x97,0x3D,0x0C,0x97,0x98,0xC4,0x24,0x26,
+  0xF1,0x00,0x3F,0xF8,0xC1,0x0F,0xB0,0x0F,0x28,0xE6,0x03,0x8A,0xF9,0x80,0x62,0x3E,
+  0xA0,0x98,0x0F,0x20,0x90,0x34,0x03,0x1C,0xD0,0xF0,0x46,0x44,0x38,0x22,0x11,0x8D,
+  0x50,0x43,0x23,0x14,0xC1,0x48,0x45,0x30,0x52,0x11,0x8C,0x54,0x04,0x23,0x54,0xC1,
+  0xCA,0x54,0xB0,0x22,0x15,0xAD,0x3C,0x47,0x43,0x0A,0xE2,0xB0,0x67,0x41,0x3A,0x42,
+  0x54,0x01,0x3F,0xF8,0xC1,0x0F,0xDE,0x94,0x3E,0x72,0x86,0xF5,0xBB,0x5D,0x3A,0x50,
+  0x67,0x1A,0xB3,0x99,0xC7,0x68,0x25,0x2A,0x1A,0x99,0x48,0x56,0xA6,0x82,0x11,0xAA,
+  0x60,0xA4,0x22,0x18,0xA9,0x08,0x46,0x2A,0x82,0x91,0x8A,0x60,0xA4,0x22,0x18,0xA9,
+  0x08,0x46,0x2A,0x92,0x11,0x8A,0x64,0x64,0x22,0x1A,0x99,0x88,0x56,0x24,0x02,0x17,
+  0x3F,0xF8,0x41,0xAE,0x50,0x38,0x52,0xD0,0x7A,0x98,0x43,0x0A,0xD2,0xCE,0x53,0xB4,
+  0x22,0x15,0xAC,0x4C,0x05,0x2B,0x14,0xC1,0x48,0x45,0x30,0x52,0x11,0x8C,0x54,0x04,
+  0x23,0x14,0xC9,0x08,0x45,0x34,0x22,0x91,0xAD,0x40,0xA4,0x23,0x0F,0xF9,0x48,0x43,
+  0xA0,0x0F,0x28,0xE6,0x03,0x8A,0xF9,0x80,0x62,0x3E,0xA0,0x98,0x0F,0x28,0x3F,0xF8,
+  0xC1,0x0F,0xDE,0x94,0xBE,0x52,0x86,0xF5,0xBB,0x1D,0x12,0xC8,0x80,0xB8,0x52,0x90,
+  0xC2,0x6C,0xC5,0x20,0x86,0xD1,0xC8,0x41,0x8E,0x92,0x95,0x83,0x20,0x24,0x23,0x08,
+  0x41,0x0A,0x46,0x10,0x92,0x10,0x8C,0x20,0x24,0x21,0x18,0x41,0x48,0x42,0x30,0x82,
+  0x90,0x84,0x60,0xE5,0x20,0x09,0xC1,0xCA,0x41,0x12,0x92,0x15,0x83,0x24,0x24,0x3B,
+  0x04,0x49,0x88,0xE6,0x10,0xC2,0x35,0x84,0x74,0x0C,0x21,0x9F,0x42,0x88,0x78,0x0E,
+  0x02,0x3F,0xF8,0x01,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0xFA,
+  0x01,0xF2,0x7C,0xE0,0x38,0x1F,0x40,0xCD,0x07,0x52,0xF3,0x81,0xC4,0x9C,0x83,0x8C,
+  0x25,0x21,0x62,0x51,0x88,0x58,0x14,0x22,0x92,0x85,0x88,0x64,0x21,0x22,0x59,0x88,
+  0x48,0x16,0x22,0x92,0x85,0x88,0x64,0x21,0x22,0x59,0x88,0x48,0x16,0x32,0x12,0x85,
+  0x8C,0x44,0x21,0x23,0x01,0x3F,0xF8,0x41,0x9E,0xD2,0x47,0x4E,0x85,0x4C,0x15,0x29,
+  0xD2,0x45,0x48,0x84,0x12,0x74,0x10,0xE8,0x34,0xE6,0x28,0x4F,0x81,0xCC,0x41,0x9C,
+  0x22,0x95,0x83,0x38,0x65,0x22,0x07,0x71,0x08,0x45,0x0E,0xE2,0x10,0x8A,0x1C,0xC4,
+  0x21,0x14,0x39,0x88,0x43,0x28,0x72,0x10,0x87,0x4C,0x04,0x21,0x0F,0x91,0xC8,0x51,
+  0x1E,0x12,0x11,0x84,0x44,0x04,0x1A,0x48,0x89,0xC8,0x33,0x10,0x23,0x11,0x86,0x1C,
+  0x07,0xFA,0x40,0x89,0x3E,0x50,0xA2,0x0F,0x8C,0xE9,0x03,0x82,0xF2,0x3F,0xF8,0xC1,
+  0x0F,0x7E,0xE0,0x7C,0x40,0x31,0x1F,0x50,0xCC,0x07,0x14,0xF3,0x01,0xC5,0x7C,0x40,
+  0x79,0xE5,0x2D,0x6F,0x79,0xCB,0x5B,0xE0,0xF2,0x16,0xB8,0xC0,0x05,0x2E,0x70,0x81,
+  0xCD,0x7B,0xDE,0xAD,0xED,0x4D,0x73,0xD9,0xBB,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0x91,
+  0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0x94,0xC6,0xE0,0x8D,
+  0x31,0x78,0x63,0x0C,0xDE,0x18,0x83,0x37,0xC6,0xE0,0x8D,0x01,0x3F,0xF8,0xC1,0x0F,
+  0xA2,0x12,0x93,0x98,0x3C,0xC4,0x2B,0x0E,0xF9,0x88,0x43,0x3E,0xE2,0x90,0x8F,0x38,
+  0xE4,0x23,0x0E,0xF9,0x88,0x43,0x3E,0xE2,0x90,0x8F,0x38,0xC4,0x2B,0x0E,0xF1,0xC8,
+  0x43,0x38,0x33,0x18,0xE3,0x03,0x67,0x30,0xC6,0x07,0x0C,0x61,0x8C,0x0F,0x94,0xC2,
+  0x18,0x1F,0x18,0x87,0x31,0xBE,0x62,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE2,
+  0x03,0x8A,0xF9,0x80,0x62,0x3E,0xA0,0x98,0x0F,0x28,0xE6,0x03,0xCA,0x0C,0xF3,0x88,
+  0xCB,0x7B,0xDA,0xA4,0x32,0xD4,0x04,0xA8,0x34,0xC4,0x19,0x8D,0x71,0x42,0x83,0x9C,
+  0xCF,0x28,0xA7,0x33,0xCC,0xD9,0x8C,0x73,0xB4,0x02,0x9D,0x8C,0x48,0x26,0x1B,0x54,
+  0xC9,0x84,0x45,0xB2,0x80,0x8D,0x59,0xD0,0x01,0x3F,0xF8,0xC1,0x0F,0x30,0x12,0x93,
+  0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x1F,0x50,0xCC,
+  0x07,0x14,0xF3,0x01,0xC5,0x7C,0x40,0x31,0x1F,0x50,0x3F,0xC8,0x79,0xC6,0x33,0x9E,
+  0xF1,0xAE,0xBC,0x04,0x26,0x30,0x81,0x49,0x4C,0xE2,0x02,0x73,0x6D,0x6F,0xBA,0xC3,
+  0x1E,0x79,0xCB,0x4B,0x60,0x12,0x8F,0x98,0xC4,0x24,0x2E,0x30,0xD7,0xF6,0xA6,0x3B,
+  0x0C,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0xF1,0x8C,0x67,0x3C,0xE3,0x19,0xF7,0xCA,0x5B,
+  0xDE,0xF2,0x96,0xB7,0xC0,0xE5,0x2D,0x70,0x81,0x0B,0x5C,0xE0,0x02,0x9B,0xF7,0xBC,
+  0x5B,0xDB,0x9B,0xE6,0xB2,0x77,0x01,0x3F,0xF8,0x41,0x9E,0xD2,0x47,0xCE,0xB0,0x7E,
+  0xB7,0x43,0x09,0xDA,0x4E,0x73,0xB4,0x12,0x15,0x8D,0x4C,0x24,0x2B,0x53,0xC1,0x48,
+  0x45,0x30,0x52,0x11,0x8C,0x54,0x04,0x23,0x15,0xC1,0x48,0x45,0x30,0x52,0x11,0xAC,
+  0x4C,0x25,0x23,0x13,0xD1,0x4A,0x54,0xB4,0xD3,0x9C,0x0D,0x25,0xA8,0xBB,0x5F,0x0D,
+  0x27,0xF9,0xD2,0x04,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0x7D,0xE0,0x3C,0x1F,0x38,0xCF,
+  0x07,0xCE,0xF3,0x81,0xF3,0x7C,0xE0,0x50,0xA4,0x21,0x1E,0x81,0x08,0x47,0xA2,0xB2,
+  0x11,0x89,0x68,0x84,0x22,0x19,0xA1,0x08,0x46,0x2A,0x82,0x91,0x8A,0x60,0xA4,0x22,
+  0x18,0xA1,0x0A,0x56,0xA6,0x82,0x15,0xA9,0x68,0xE5,0x39,0x1A,0x52,0x10,0x87,0x3D,
+  0x0B,0xD2,0x11,0xA2,0x0A,0x3F,0xF8,0x41,0xAE,0x50,0x38,0x52,0xD0,0x7A,0x98,0x43,
+  0x0A,0xD2,0xCE,0x53,0xB4,0x22,0x15,0xAC,0x4C,0x05,0x2B,0x14,0xC1,0x48,0x45,0x30,
+  0x52,0x11,0x8C,0x54,0x04,0x23,0x14,0xC9,0x08,0x45,0x34,0x22,0x91,0xAD,0x44,0xA3,
+  0x23,0xD0,0xF8,0x48,0x43,0xBE,0x0F,0x94,0xE7,0x03,0xE7,0xF9,0xC0,0x79,0x3E,0x70,
+  0x9E,0x0F,0x1C,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xF0,0x3C,0xE3,0x19,0xCF,
+  0x78,0xC6,0xBD,0xF2,0x12,0x98,0xC0,0x24,0x26,0x30,0x89,0x09,0x4C,0x62,0x12,0x93,
+  0x98,0xC4,0x24,0x4E,0x6C,0x62,0x53,0x8B,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0x20,0x93,
+  0xCF,0x30,0x85,0x4B,0x4B,0xD9,0xD6,0x42,0x36,0xA6,0x10,0xAD,0x29,0x25,0x2B,0x83,
+  0x51,0x08,0x56,0x8A,0xA2,0x10,0xAC,0x14,0x45,0x21,0x18,0x39,0x4A,0x42,0x30,0x72,
+  0x94,0x84,0x60,0xE4,0x28,0x09,0xC1,0x08,0x52,0x10,0x82,0x11,0xA4,0x20,0x04,0x23,
+  0x48,0x39,0x0A,0x46,0x92,0x62,0x90,0x8C,0x24,0xA5,0x28,0x1A,0x41,0xCC,0x60,0x34,
+  0x92,0xB4,0x8D,0x24,0x6D,0x23,0xCA,0x5A,0x93,0x5B,0x00,0x3F,0xF8,0x01,0x4C,0x62,
+  0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x59,0x79,0xF6,0xAD,0x0F,0x84,0xEA,0x03,0x82,
+  0xFA,0x80,0xD0,0x88,0x54,0x34,0x32,0x95,0x8C,0x4C,0x25,0x23,0x14,0xC9,0x08,0x45,
+  0x32,0x42,0x91,0x8C,0x50,0x24,0x23,0x14,0xC9,0x08,0x45,0x32,0x42,0x91,0x8C,0x50,
+  0x24,0x23,0x14,0x81,0x09,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0xE1,0x4E,0x6F,0x5B,0xE3,
+  0x19,0x7F,0xCF,0x6B,0xE0,0x02,0x17,0xB8,0xC0,0x05,0x2E,0x6F,0x81,0xCB,0x5B,0xDE,
+  0xF2,0x96,0xB7,0x74,0x3C,0xE3,0x19,0xCF,0x78,0xC6,0x01,0x3F,0xC8,0x03,0x4D,0x62,
+  0xF3,0x26,0x76,0xA9,0x4E,0x75,0x6A,0x53,0x9D,0xDA,0xD6,0xA6,0x32,0x36,0xB9,0xC7,
+  0x3D,0xAB,0x4A,0xD7,0xC9,0x4C,0x76,0x32,0xB3,0x99,0xCC,0x6C,0xE8,0x52,0x51,0x6B,
+  0x5E,0x12,0x07,0xCE,0x90,0x51,0xDB,0xD0,0x29,0xE2,0x10,0x8F,0x32,0x65,0xEE,0x61,
+  0x13,0xDA,0x4A,0x56,0xB2,0xB2,0x9D,0x6A,0x35,0xAF,0x79,0xD5,0xEA,0xD4,0xA7,0x3E,
+  0xD5,0xAD,0xEA,0x35,0x6C,0x32,0x5F,0x38,0xBB,0xF9,0x45,0x92,0xA5,0xC7,0x15,0x3F,
+  0xC8,0x83,0x16,0x32,0x81,0x89,0x6C,0x58,0x23,0x2B,0x52,0xC9,0x0C,0x64,0xB2,0xE3,
+  0x9C,0x0C,0x2D,0xA7,0x43,0xC8,0xF9,0x90,0x71,0x42,0x34,0x1C,0x12,0x9E,0x2D,0x55,
+  0x2C,0x72,0xD3,0xBA,0x50,0x67,0x9E,0x20,0x8D,0x87,0x40,0x20,0x32,0x90,0x77,0x12,
+  0xB4,0x21,0x06,0x65,0xE6,0x39,0x59,0x89,0x4C,0x46,0xA6,0x92,0x89,0x6B,0x64,0x21,
+  0x13,0x74,0x00,0x3F,0xC8,0x03,0x3D,0x3E,0xF2,0x18,0x8E,0x3C,0x48,0x23,0x8F,0xC2,
+  0xC8,0xC3,0x2C,0x12,0x31,0x8A,0x4C,0x0D,0x2A,0x16,0x73,0x48,0xC6,0x14,0xB3,0xB1,
+  0xC3,0x78,0x6C,0x40,0x20,0x25,0x1F,0xBA,0x52,0x95,0xAA,0x54,0xA5,0x0A,0x5D,0xA8,
+  0x4A,0x55,0xAA,0x52,0x95,0xAA,0x15,0xB5,0x05,0x1E,0x72,0x00,0x3F,0xF8,0xC1,0x0F,
+  0xF8,0x92,0x11,0xC9,0x64,0x24,0x3A,0x19,0x81,0x50,0x46,0x9E,0x94,0x11,0x47,0x65,
+  0xA4,0x31,0x01,0xC9,0x08,0x63,0x04,0x92,0x91,0xC5,0x0C,0x24,0x23,0x8A,0x21,0x48,
+  0x46,0x12,0x53,0x90,0x8C,0x20,0xC6,0x20,0x19,0x39,0xCC,0x41,0x32,0x62,0x18,0x84,
+  0x64,0xA4,0x30,0x09,0xC9,0x08,0x61,0x14,0x92,0x91,0xC1,0x2C,0x24,0x23,0x82,0x61,
+  0x48,0xB6,0x1A,0x92,0x29,0x87,0x64,0xE9,0x21,0x19,0x82,0x48,0x76,0x22,0x92,0x19,
+  0x89,0x64,0x65,0x22,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0x8D,0xC4,0x24,0x26,0x31,
+  0x89,0x09,0x6C,0x5E,0xF3,0xA1,0x03,0x21,0x88,0xF9,0x00,0x4B,0xAA,0x60,0x0F,0x3B,
+  0xD4,0xA3,0x16,0xD5,0x28,0x06,0x42,0xD0,0x51,0x8A,0x72,0x16,0xA2,0x9C,0x85,0x20,
+  0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x00,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0xE4,
+  0x0F,0x48,0xE2,0x03,0x92,0xF8,0x80,0x24,0x3E,0x20,0x01,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xE0,0x90,0x94,0x10,0x24,0x25,0x04,0x49,0x09,0x41,0x52,0x42,0x90,0x94,0x10,0x24,
+  0x25,0x44,0x39,0x0B,0x51,0xCE,0x52,0x14,0x03,0x21,0xE8,0x28,0x46,0x2D,0xAA,0x61,
+  0x07,0x7B,0x54,0xC1,0x26,0x1F,0x60,0x0C,0x3A,0x10,0x82,0x3C,0xF3,0x1A,0x98,0xC4,
+  0x24,0x26,0x31,0x89,0x09,0x3F,0xF8,0x01,0x42,0x5E,0xE3,0x9E,0x16,0xB5,0xE5,0x25,
+  0x31,0x89,0x49,0x4C,0xE2,0x12,0x93,0xB8,0xC4,0x24,0x2E,0x71,0x89,0x49,0x5C,0x62,
+  0x12,0x97,0x98,0xC4,0x24,0x26,0x31,0x79,0x4B,0x8B,0xDA,0xE3,0x9A,0x97,0x00,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x08,0x1F,0x10,0x94,0xE8,0x04,0x25,0x3A,0x41,
+  0x89,0x4E,0x50,0xA2,0x13,0x94,0xE8,0x04,0x25,0x3A,0x41,0x89,0x4E,0x50,0xA2,0x13,
+  0x94,0xE8,0x04,0x25,0x3A,0x41,0x89,0x4E,0x50,0xA2,0x13,0x94,0xE8,0x04,0x25,0x3A,
+  0x41,0x89,0x4E,0x50,0xA2,0x13,0xD4,0x07,0x04,0x3F,0xF8,0x81,0x9D,0xD2,0x47,0x4E,
+  0xF0,0x76,0x79,0x4B,0x49,0xCA,0x50,0x83,0x30,0x13,0x99,0xCB,0x4C,0xC6,0x2A,0x55,
+  0xA9,0xCA,0x55,0x28,0x82,0x15,0x8A,0x64,0x84,0x08,0x84,0x40,0x4A,0x56,0x82,0x41,
+  0x08,0x84,0x6C,0x88,0x10,0x08,0xD9,0x10,0x21,0x10,0xB2,0x11,0x61,0x08,0x03,0x21,
+  0x1B,0x11,0x10,0x42,0x36,0x22,0x9C,0x84,0x6C,0x64,0x30,0x09,0xD9,0x08,0x41,0x14,
+  0xB2,0x11,0xA9,0x68,0x83,0x22,0x19,0xA1,0x48,0x46,0xA8,0x82,0x11,0xAA,0x5C,0x04,
+  0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0xE1,0x4E,0x6F,0x5B,0xE3,0x19,0x7F,0x08,0x77,0x1C,
+  0xD2,0x19,0x87,0x78,0xC5,0x21,0x5E,0x81,0x0B,0x5C,0xE0,0xF2,0x16,0xB8,0xBC,0x05,
+  0x22,0x5B,0x89,0x88,0x56,0x24,0x92,0x95,0x89,0x18,0x3C,0xE3,0x19,0xCF,0x78,0xC6,
+  0x01,0x3F,0xF8,0xC1,0x0F,0xDE,0x94,0xBE,0x52,0x86,0xF5,0xBB,0x1D,0x12,0xC8,0x80,
+  0xB8,0x52,0x90,0xC2,0x6C,0xC5,0x20,0x86,0xD1,0xC8,0x41,0x8E,0x22,0x05,0xA3,0x1C,
+  0x04,0x21,0x91,0x30,0x08,0x42,0x90,0xF2,0x0C,0x83,0x20,0x24,0x21,0x4D,0x31,0x08,
+  0x42,0x12,0xC2,0x94,0x83,0x20,0x24,0x21,0x4B,0x41,0x08,0x42,0x12,0xA2,0x94,0xA4,
+  0x1C,0x24,0x21,0x0A,0x51,0xCA,0x41,0x12,0xA2,0x0C,0xA6,0x18,0x24,0x21,0x8A,0x68,
+  0x0E,0x41,0x12,0xA2,0x84,0xC7,0x21,0x84,0x6B,0x08,0xE9,0x18,0x42,0x3E,0x85,0x10,
+  0xF1,0x1C,0x04,0x3F,0xF8,0xC1,0x0F,0x86,0xE2,0xA6,0x8E,0x28,0x8B,0x23,0x49,0x93,
+  0xC2,0x41,0x12,0x17,0x89,0x83,0x24,0xA4,0x30,0xCF,0x38,0x08,0x42,0x8E,0xD2,0x14,
+  0x83,0x24,0x23,0x21,0x4C,0x39,0x48,0x32,0x12,0xB2,0x14,0x84,0x20,0x24,0x21,0x4A,
+  0x49,0x08,0x32,0x14,0xA2,0x10,0x85,0x20,0x43,0x21,0xCA,0x58,0x08,0x32,0x94,0xB1,
+  0x8C,0x85,0x20,0x23,0x21,0x0B,0x51,0xCA,0x31,0x92,0xC1,0x94,0xA4,0x1C,0x03,0x21,
+  0x4D,0x41,0x4E,0x31,0x0E,0xF2,0x14,0x04,0x47,0xE5,0xD0,0xD1,0x40,0x74,0x24,0x92,
+  0x2C,0x85,0x05,0xC3,0x25,0x26,0x31,0x89,0x49,0x3C,0x00,0x3F,0xF8,0xC1,0x0F,0x86,
+  0xE2,0xA6,0x8E,0x28,0x8B,0x23,0x49,0xD3,0x48,0xE2,0x34,0x92,0x90,0xC2,0x64,0x04,
+  0x21,0x47,0x71,0x88,0x41,0x92,0x91,0x10,0x87,0x18,0x24,0x19,0x09,0x71,0x88,0x41,
+  0x10,0x92,0x10,0x87,0x18,0x04,0x19,0x0A,0xC1,0x08,0x32,0x14,0x82,0x11,0x64,0x28,
+  0x23,0x23,0xC8,0x48,0x48,0x56,0x8E,0x91,0x0C,0xAD,0x1C,0x03,0x21,0xDA,0x29,0xC6,
+  0x41,0x22,0x72,0x60,0x89,0x1C,0x1A,0x22,0x88,0x7E,0x48,0x92,0x3D,0x0C,0x97,0x98,
+  0xC4,0x24,0x26,0xF1,0x00,0x3F,0xF8,0xC1,0x0F,0x86,0xE2,0xA6,0x8E,0x28,0x8B,0x23,
+  0x49,0xD3,0x48,0xE2,0x96,0xE0,0x90,0x84,0x14,0x46,0x11,0x0D,0x41,0xC8,0x51,0x94,
+  0xB1,0x90,0x64,0x24,0x44,0x21,0x0A,0x49,0x46,0x42,0x94,0x92,0x10,0x84,0x24,0x64,
+  0x29,0x08,0x41,0x86,0x42,0x98,0x72,0x10,0x64,0x28,0xA4,0x29,0x06,0x41,0x86,0x32,
+  0xA0,0x61,0x10,0x64,0x24,0x24,0x12,0x46,0x39,0x46,0x32,0xA6,0x60,0x94,0x63,0x20,
+  0x44,0x3B,0xC5,0x38,0x08,0x87,0x3B,0xCD,0x69,0x2E,0x7B,0x18,0x2E,0x31,0x89,0x49,
+  0x4C,0xE2,0x01,0x3F,0xF8,0xC1,0x0F,0x86,0xE2,0xA6,0x8E,0x28,0x8B,0x23,0x49,0xD3,
+  0x48,0xE2,0x34,0x92,0x90,0xC2,0x64,0x04,0x21,0x47,0xC1,0x48,0x32,0x12,0xD2,0x90,
+  0x83,0x24,0x23,0x21,0x0B,0x2A,0x08,0x42,0x12,0xB2,0x08,0x42,0x14,0x04,0x19,0x0A,
+  0x51,0x84,0x21,0x08,0x82,0x0C,0x85,0x28,0xC2,0x10,0x04,0x41,0x86,0x32,0x16,0x61,
+  0x08,0x82,0x20,0x23,0x21,0x8B,0x30,0x04,0x51,0x8E,0x91,0x8C,0x46,0x10,0xA2,0x28,
+  0xC7,0x40,0x48,0x83,0x8A,0x53,0x8C,0x83,0x40,0x04,0xC1,0x9D,0xE6,0x34,0x97,0x3D,
+  0x0C,0x97,0x98,0xC4,0x24,0x26,0xF1,0x00,0x3F,0xF8,0xC1,0x0F,0xDE,0x94,0x3E,0x72,
+  0x86,0xF5,0xBB,0x5D,0x3A,0x50,0x67,0x1A,0xB3,0x99,0xC7,0x68,0x25,0x2A,0x1A,0x99,
+  0x08,0x11,0x08,0xE1,0x94,0xA9,0x04,0x83,0x10,0x0E,0xA1,0x12,0x21,0x1C,0x52,0x21,
+  0x42,0x38,0xA4,0x22,0xC2,0x10,0x86,0x43,0x2A,0x22,0x20,0x87,0x54,0x44,0x38,0x0F,
+  0xA9,0xC8,0x60,0x1E,0x52,0x11,0x82,0x40,0xA4,0x22,0x19,0xA1,0x48,0x46,0x26,0xA2,
+  0x91,0x89,0x68,0x45,0x22,0x70,0x01,0x3F,0xF8,0xC1,0x0F,0xDE,0x94,0xBE,0x52,0x86,
+  0xB5,0x0A,0xC9,0x9D,0x04,0x82,0x04,0x32,0xA0,0x68,0x20,0xA5,0x20,0x85,0x79,0xCA,
+  0x51,0x0C,0x62,0x98,0xA6,0x20,0xE4,0x20,0x47,0x61,0x0A,0x52,0x0E,0x82,0x90,0xA5,
+  0x24,0x04,0x21,0x48,0x51,0x88,0x42,0x10,0x92,0x10,0x65,0x2C,0x04,0x21,0x09,0x51,
+  0xC6,0x42,0x10,0x92,0x10,0x85,0x28,0x04,0x21,0x09,0x51,0x4A,0x52,0x0E,0x92,0x90,
+  0xA5,0x20,0xE5,0x20,0x09,0x61,0x0A,0x52,0x0C,0x92,0x90,0xA6,0x1C,0x87,0x20,0x09,
+  0x79,0x06,0xE2,0x10,0x12,0x89,0xA4,0x21,0x44,0x0A,0x0A,0x43,0xC8,0xA7,0x10,0x22,
+  0x9E,0x83,0x00,0x3F,0xF8,0xC1,0x0F,0xDE,0x94,0xBE,0x52,0x86,0xF5,0xBB,0x1D,0x12,
+  0xC8,0x80,0xB8,0x52,0x90,0xC2,0x40,0xE4,0x28,0x06,0x31,0xCC,0x43,0x0E,0x72,0x90,
+  0xA3,0x3C,0xC4,0x28,0x07,0x41,0xC8,0x43,0x0C,0x82,0x10,0xA4,0x60,0x04,0x21,0x09,
+  0xC1,0x08,0x42,0x12,0x82,0x11,0x84,0x24,0x04,0x23,0x08,0x49,0x08,0x56,0x0E,0x92,
+  0x10,0xAC,0x1C,0x24,0x21,0x0E,0x39,0x8A,0x41,0x12,0xE2,0x90,0xE3,0x10,0x24,0x21,
+  0x0E,0x41,0x1C,0x42,0x1E,0x92,0x34,0x84,0x74,0x0C,0x21,0x9F,0x42,0x88,0x78,0x0E,
+  0x02,0x3F,0xF8,0xC1,0x0F,0xDE,0x94,0xBE,0x52,0x86,0xF5,0xBB,0x4D,0x78,0x90,0x40,
+  0x06,0xC4,0x08,0xA7,0x14,0xA4,0x30,0xCC,0x60,0x8A,0x41,0x0C,0xB3,0x90,0x85,0x1C,
+  0xE4,0x28,0x4B,0x49,0xCA,0x41,0x10,0xC2,0x14,0x84,0x20,0x04,0x29,0x4C,0x39,0x08,
+  0x42,0x12,0xD2,0x14,0x83,0x20,0x24,0x21,0xCF,0x30,0x08,0x42,0x12,0x02,0x09,0x83,
+  0x20,0x24,0x21,0x51,0x30,0xCA,0x41,0x12,0x82,0x95,0x83,0x24,0x24,0x2B,0x06,0x49,
+  0x48,0x76,0x08,0x92,0x10,0xCD,0x21,0x84,0x6B,0x08,0xE9,0x18,0x42,0x3E,0x85,0x10,
+  0xF1,0x1C,0x04,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0x91,0x98,0xC4,0x24,0x26,0x31,0x39,
+  0x89,0x41,0x4E,0x62,0x90,0x93,0x18,0xE4,0x24,0x06,0x89,0x49,0xCC,0x33,0x9E,0xF1,
+  0x8C,0x67,0xFC,0x21,0x31,0x89,0x49,0x4C,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0x91,
+  0x98,0xC4,0x44,0x0D,0x06,0x49,0x85,0x41,0xD0,0x61,0x10,0xB3,0x18,0xA4,0x2C,0x07,
+  0x21,0x0B,0x42,0xC6,0x92,0x90,0x91,0x28,0x7C,0x19,0x0B,0x5F,0xC6,0xC2,0x17,0xA2,
+  0xF0,0xA5,0x24,0x9C,0x29,0x71,0x89,0x8B,0x3C,0x66,0x41,0x07,0x3F,0xF8,0xC1,0x0F,
+  0x7E,0xB0,0x91,0x98,0xC4,0x24,0x26,0x63,0x68,0xC8,0x28,0x18,0x32,0x8E,0x85,0x8C,
+  0x44,0x21,0x63,0x49,0x08,0x59,0x10,0x52,0x96,0x83,0x3B,0xC5,0xE0,0xD0,0x30,0x78,
+  0x24,0x0C,0x2E,0x05,0x83,0x03,0x69,0x88,0xC9,0x6B,0xD8,0xA4,0x2E,0xB4,0x95,0xCD,
+  0x21,0x14,0x8B,0x48,0xD4,0x26,0xF2,0xBC,0x89,0x30,0x4C,0x20,0xE1,0x2A,0x88,0xB7,
+  0x10,0xC2,0x2D,0x85,0x70,0xA8,0x21,0x5C,0x81,0x08,0x87,0x1A,0xC2,0xA9,0x85,0x70,
+  0x0D,0x21,0x5E,0x33,0xC8,0x44,0x94,0x36,0x90,0x89,0x30,0x2D,0x20,0x13,0x79,0xDE,
+  0x44,0xA2,0xB6,0x36,0xB5,0xAD,0x4D,0x5D,0x6C,0x7A,0x4D,0x4C,0xE8,0x00,0x69,0x88,
+  0xC9,0x6B,0xD8,0xA4,0xAE,0xD3,0x91,0xAE,0x6C,0xA5,0x2B,0xA1,0xC8,0x06,0x62,0x11,
+  0x63,0x19,0x84,0x42,0xC1,0x4A,0xC8,0x34,0x86,0xB6,0x90,0x49,0x14,0xC9,0x21,0x93,
+  0x28,0xD0,0x43,0x26,0x51,0x2C,0x86,0x4C,0x63,0x70,0x0A,0xA1,0x50,0xD0,0x0E,0x62,
+  0x11,0x83,0x15,0x44,0x64,0x03,0x21,0xE3,0xE9,0xD2,0xA6,0xB6,0x95,0xAD,0x4D,0x5D,
+  0x2D,0x7A,0x4D,0x4C,0xE8,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,
+  0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0xEA,0x03,0x82,0x22,0x0A,0x59,0x08,0x45,
+  0x14,0xB2,0x10,0x8A,0x28,0x64,0x21,0x50,0x18,0x88,0x42,0x16,0xF2,0x88,0x81,0x28,
+  0x64,0x21,0xCE,0x18,0x88,0x42,0x16,0xD2,0x90,0x81,0x28,0x64,0x21,0x4C,0x19,0x88,
+  0x42,0x16,0xB2,0x14,0x82,0x28,0x64,0x21,0x0B,0x29,0x88,0x42,0x16,0xB2,0x0C,0x83,
+  0x28,0x64,0x21,0xCB,0x30,0x88,0x42,0x16,0xB2,0x88,0x83,0x28,0x64,0x21,0x4B,0x40,
+  0x88,0x42,0x16,0x42,0x11,0x85,0x2C,0x84,0x22,0x19,0xA1,0x48,0x46,0x28,0x92,0x91,
+  0x98,0x00,0x3F,0xB0,0x4C,0xAB,0x38,0xA2,0xB0,0x8D,0x24,0x4E,0x1B,0x8A,0xCB,0x48,
+  0x52,0x0A,0x83,0x91,0x84,0x1C,0x05,0x23,0x08,0x49,0x08,0x46,0x90,0xA1,0x10,0x8C,
+  0x20,0x43,0x21,0x58,0x39,0x46,0x42,0x32,0x63,0x0C,0xA4,0x68,0x7A,0xCB,0x1D,0xF6,
+  0x30,0xA7,0x35,0x53,0x90,0xE2,0x68,0xE4,0x20,0x87,0xC1,0x08,0x42,0x90,0x82,0x11,
+  0x84,0x24,0x04,0x23,0x08,0x49,0x08,0x46,0x10,0x92,0x10,0xAC,0x1C,0x24,0x21,0x59,
+  0x31,0x48,0x42,0xB2,0x97,0x10,0xCD,0x25,0x83,0x6B,0x08,0xF1,0x16,0x42,0x42,0x84,
+  0x0C,0x69,0x90,0xC7,0x6B,0x5A,0xB4,0xAA,0x34,0xA5,0x2A,0x55,0x29,0x3B,0x53,0x40,
+  0xCA,0x34,0x10,0x31,0x19,0x04,0x4C,0x08,0xF1,0x92,0x42,0xB8,0xC4,0x90,0xED,0x3C,
+  0x64,0xFB,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0xC8,
+  0x42,0x14,0x42,0x91,0x85,0x28,0x84,0x22,0x0B,0x51,0x08,0x45,0x16,0xA2,0x10,0x8A,
+  0x2C,0x44,0x21,0x14,0x59,0x88,0x42,0x28,0xB2,0x10,0x85,0x50,0x24,0x23,0x14,0xC9,
+  0x48,0x4C,0x00,0x3F,0xF8,0x41,0x9E,0xD2,0x47,0xCE,0xB0,0x56,0x21,0xB9,0x93,0x40,
+  0x50,0x82,0xA2,0x71,0x9C,0xE6,0x38,0xE5,0x28,0x51,0x69,0x0A,0x42,0x26,0xC2,0x14,
+  0xA4,0x4C,0x45,0x29,0x09,0xA9,0x88,0x42,0x14,0x52,0x11,0x65,0x2C,0xA4,0x22,0xCA,
+  0x58,0x48,0x45,0x14,0xA2,0x90,0x8A,0x28,0x25,0x21,0x15,0x59,0x0A,0x52,0xA6,0xC2,
+  0x14,0x84,0x4C,0xC4,0x29,0x47,0x89,0x0A,0x34,0x8E,0xD3,0x9C,0x48,0x20,0x28,0x41,
+  0x53,0x48,0xEE,0x57,0xC3,0x49,0xBE,0x34,0x01,0x3F,0xF8,0x41,0x9E,0xD2,0x47,0xCE,
+  0xB0,0x7E,0xB7,0x43,0x09,0x82,0xC8,0x71,0x9A,0xF3,0x90,0xA3,0x44,0xE5,0x21,0x07,
+  0x99,0xC8,0x43,0x8C,0x32,0x15,0x8C,0x54,0x04,0x23,0x15,0xC1,0x48,0x45,0x30,0x52,
+  0x11,0x8C,0x54,0x04,0x23,0x15,0x71,0x88,0x51,0xA6,0xE2,0x90,0x83,0x4C,0xE4,0x21,
+  0x47,0x89,0xCA,0x43,0x8E,0xD3,0x9C,0x0D,0x25,0xA8,0xBB,0x5F,0x0D,0x27,0xF9,0xD2,
+  0x04,0x3F,0xF8,0x41,0x9E,0xD2,0x47,0xCE,0xB0,0x7E,0xB7,0x09,0x0F,0x4A,0x10,0x23,
+  0x9A,0xD3,0x9C,0x65,0x30,0x25,0x2A,0x0B,0x59,0xC8,0x44,0x96,0x92,0x94,0xA9,0x2C,
+  0x05,0x21,0x15,0x61,0xCA,0x41,0x2A,0xD2,0x14,0x83,0x54,0xE4,0x19,0x06,0xA9,0x08,
+  0x24,0x0C,0x52,0x91,0x28,0x18,0xA4,0x22,0x58,0x99,0x4A,0x46,0x26,0xA2,0x95,0xA8,
+  0x68,0xA7,0x39,0x1B,0x4A,0x50,0x77,0xBF,0x1A,0x4E,0xF2,0xA5,0x09,0x3F,0xF8,0xC1,
+  0x0F,0x7E,0xB0,0xE1,0x4E,0x53,0xC1,0xD8,0x92,0x30,0x38,0x34,0x0C,0xEE,0x14,0xEE,
+  0x30,0xC5,0x33,0x4B,0x01,0x8B,0x52,0xC2,0xA2,0x10,0xB1,0x28,0x63,0x2C,0xCA,0x18,
+  0x8B,0x42,0xC2,0xB2,0x14,0xB0,0x30,0xC5,0x2B,0x4E,0xE1,0x0A,0x54,0xB4,0x32,0x8D,
+  0xAC,0x54,0xC2,0xE0,0x52,0x30,0x78,0xC6,0x33,0x9E,0x71,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xB0,0xE1,0x4E,0x6F,0x9B,0x09,0x0D,0x5F,0x04,0xC3,0x97,0x11,0x1E,0x85,0x84,0x46,
+  0x29,0x61,0x59,0x0A,0x58,0x98,0xF2,0x95,0xA6,0x78,0xE5,0x19,0x5E,0x81,0x44,0x57,
+  0xA4,0xD0,0x95,0xB7,0xBC,0xE5,0x2D,0x6F,0xE9,0x78,0xC6,0x33,0x9E,0xF1,0x8C,0x03,
+  0x3F,0xC8,0x03,0x3D,0x3E,0xF2,0x18,0x8E,0x3C,0x48,0x23,0x8F,0xC2,0xC8,0xC3,0x2C,
+  0x12,0x31,0x8A,0x4C,0x0D,0x2A,0x05,0x69,0x98,0x43,0x0C,0xF2,0x30,0xC5,0x18,0x24,
+  0x62,0x87,0x39,0xC8,0xC4,0x06,0x04,0x52,0xF2,0xA1,0x2B,0x55,0xA9,0x4A,0x95,0x44,
+  0x26,0x45,0x11,0x68,0x59,0xC4,0x51,0x19,0x61,0x54,0xAA,0x52,0x95,0xAA,0x15,0xB5,
+  0x05,0x1E,0x72,0x00,0x3F,0xF8,0xD7,0x19,0xC5,0xEA,0xE5,0x6D,0x3B,0xE4,0x48,0x4B,
+  0x6A,0x88,0x71,0xA2,0xC3,0x10,0xA3,0x54,0x85,0x21,0x45,0xB9,0x0A,0x45,0x32,0x32,
+  0x95,0xAC,0x48,0x64,0x23,0x12,0xD9,0x88,0x44,0x36,0x22,0x91,0x8D,0x48,0x64,0x23,
+  0x12,0xD9,0x88,0x54,0xB2,0xA2,0x90,0x82,0x64,0x64,0x21,0x45,0xB9,0xCA,0x42,0x8C,
+  0x52,0x15,0x86,0x18,0x27,0x3A,0x57,0x5A,0x52,0xB6,0xB7,0xEC,0x55,0x31,0x9E,0x0B,
+  0x3F,0xF8,0xC1,0x0F,0xC0,0xCC,0xF1,0xCC,0x5F,0xBF,0x21,0xC5,0x07,0x02,0x43,0xBC,
+  0xC3,0x10,0xD0,0x2C,0x24,0x2C,0x71,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,
+  0x26,0x70,0x51,0x48,0x58,0x16,0x02,0x9A,0x85,0x78,0x87,0x21,0xC5,0x07,0x42,0xF5,
+  0x2D,0x7F,0xF1,0x2C,0x03,0x3F,0xF8,0x41,0x9E,0x92,0xF0,0xBD,0x42,0x74,0x53,0x18,
+  0x5C,0xDE,0xF2,0x86,0x12,0xB4,0x1D,0x06,0x69,0xA5,0x49,0x1A,0x69,0x4A,0x40,0xB2,
+  0xB2,0x94,0xA1,0x60,0x64,0x29,0x05,0xC1,0x88,0x52,0x0C,0x82,0x91,0xA4,0x1C,0x04,
+  0x23,0x47,0x49,0x08,0x46,0x8C,0xA2,0x10,0x8C,0x14,0x65,0x21,0x58,0x19,0xCA,0x52,
+  0x32,0x12,0x94,0x86,0x68,0xA9,0x29,0xDB,0x61,0xCE,0x86,0x12,0xB4,0xE5,0x2D,0x73,
+  0x43,0x98,0x9D,0x28,0xDE,0x17,0x92,0x04,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,
+  0x78,0xE5,0x23,0x8C,0xF9,0x08,0x63,0x3E,0xB2,0x9C,0x8F,0x24,0xA9,0xFA,0x40,0x90,
+  0x7A,0x50,0xA2,0x2E,0x14,0xA8,0x0F,0xE5,0xE1,0x45,0x79,0xCA,0x42,0x9A,0xE2,0x14,
+  0x86,0x34,0xC5,0x21,0x0D,0x69,0x8A,0x43,0x1A,0xD2,0x14,0x87,0x34,0xA4,0x29,0x0E,
+  0xF1,0x8A,0x43,0xBC,0xE2,0x10,0xAF,0x38,0xA5,0x2B,0x0F,0xE9,0x0A,0x5C,0x00,0x3F,
+  0xF8,0xD7,0x12,0xB6,0x78,0x88,0xAC,0x0E,0xE4,0xF2,0x96,0xB7,0xD2,0xA2,0xAC,0x03,
+  0x21,0xAB,0x44,0xA9,0x2A,0x90,0x09,0x0A,0x45,0xA0,0x42,0x90,0xA9,0x3C,0xA5,0x28,
+  0x12,0x71,0xCC,0x41,0x24,0xD2,0x94,0x84,0x48,0x64,0x31,0x0A,0x91,0x88,0x62,0x16,
+  0x22,0x91,0xA4,0x34,0x44,0x22,0x87,0x71,0x88,0x54,0x8A,0xF2,0x94,0x89,0x10,0x05,
+  0x22,0x54,0x09,0x0C,0x54,0xAA,0x14,0x15,0x0B,0x41,0xC7,0x52,0x4B,0xB2,0xBC,0xE5,
+  0x2F,0x32,0xD4,0x4C,0x1C,0x71,0x0B,0xCB,0x02,0x3F,0xD8,0x83,0x15,0xB8,0x41,0x0D,
+  0xAD,0x48,0x45,0x2B,0x50,0xE1,0x8A,0x53,0xBC,0xC2,0x14,0xB0,0x28,0x45,0x2C,0x48,
+  0x21,0x8B,0x51,0xCC,0x42,0x14,0xB4,0x08,0x45,0x55,0x2C,0x72,0xCD,0x6B,0x5C,0xC4,
+  0x2A,0xB5,0x08,0x05,0x2D,0x44,0x31,0x8B,0x51,0xC8,0x82,0x14,0xB1,0x28,0x05,0x2C,
+  0x4C,0xF1,0x8A,0x53,0xB8,0x02,0x15,0xAD,0x48,0x45,0x1B,0xD4,0xE0,0x82,0x15,0x00,
+  0x3F,0x30,0x49,0x5C,0x62,0x12,0x93,0x98,0xC4,0xC4,0x21,0x1F,0x71,0xC8,0x47,0x1C,
+  0xF2,0x11,0x87,0x78,0xC5,0x21,0x5D,0x39,0x3E,0xF0,0x8A,0x0F,0xC4,0xE1,0x03,0x92,
+  0xF8,0x40,0x24,0x3E,0xF0,0x8E,0x82,0x90,0xB1,0x24,0x64,0x24,0x0A,0x19,0x89,0x42,
+  0x46,0xA2,0x90,0x91,0x28,0x64,0x24,0x0A,0x19,0x89,0x42,0x46,0x12,0x97,0x98,0x00,
+  0x3F,0xF8,0xC1,0x0F,0x86,0xE2,0xA6,0x8E,0x28,0x8B,0x23,0x49,0xD3,0x48,0xE2,0x34,
+  0x92,0x90,0xC2,0x64,0x04,0x21,0x47,0xC1,0x48,0x32,0x12,0x82,0x91,0x64,0x24,0x04,
+  0x23,0x08,0x49,0x48,0x14,0x0C,0x82,0x0C,0x85,0x40,0xC2,0x20,0xC8,0x50,0xC8,0x33,
+  0x0C,0x82,0x0C,0x65,0x38,0xC5,0x20,0xC8,0x48,0x48,0x53,0x8E,0x72,0x8C,0x64,0x34,
+  0x05,0x29,0xC7,0x40,0x08,0x53,0x92,0x53,0x8C,0x83,0x34,0x64,0xC1,0xCE,0x60,0x34,
+  0x23,0x1C,0xBD,0x04,0x28,0x7B,0x18,0x2E,0x31,0x89,0x49,0x4C,0xE2,0x01,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xB0,0x91,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0xA2,0x06,
+  0x83,0xA4,0xC2,0x20,0xE8,0x30,0xB8,0x53,0x0C,0xDE,0x94,0x83,0x33,0x05,0xE1,0x4B,
+  0x49,0xF8,0x42,0xE2,0x21,0x8B,0x39,0x00,0x3F,0xF8,0x41,0x9E,0xD2,0x47,0xCE,0xB0,
+  0x7E,0xB7,0x43,0x09,0xDA,0x4E,0x73,0xB4,0x12,0x15,0x8D,0x4C,0x44,0x0A,0x46,0x99,
+  0x0A,0x24,0x0C,0x52,0x91,0x67,0x18,0xA4,0x22,0x4D,0x31,0x48,0x45,0x98,0x72,0x90,
+  0x8A,0x2C,0x05,0x21,0x15,0x51,0x4A,0x42,0x2A,0xA2,0x10,0xA5,0x4C,0x45,0x19,0x0C,
+  0x99,0xC8,0x22,0x9A,0x12,0x95,0x25,0x38,0xA7,0x39,0x1B,0x4A,0x50,0x77,0xBF,0x1A,
+  0x4E,0xF2,0xA5,0x09,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0xE1,0x4E,0x6F,0x5B,0xE3,0x19,
+  0x7F,0xCF,0x6B,0xA2,0xE0,0x15,0x48,0x78,0xE5,0x19,0x5E,0x69,0x8A,0x57,0x98,0xF2,
+  0x95,0xA5,0x7C,0x65,0x29,0x60,0x59,0x08,0x58,0x98,0x01,0x96,0x46,0x80,0xC5,0x09,
+  0x60,0xE9,0x78,0xC6,0x33,0x9E,0xF1,0x8C,0x03,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0xF1,
+  0x8C,0x47,0xA3,0xE0,0x4F,0x29,0xF8,0x53,0x0A,0xEE,0x10,0xA6,0x80,0x83,0x29,0xE1,
+  0x58,0x8A,0x48,0x92,0x42,0x0E,0xA4,0x94,0xE4,0x28,0xE6,0x30,0xCA,0x49,0x8A,0x82,
+  0x8E,0xA2,0xA0,0xA3,0x28,0x27,0x29,0x4A,0x59,0x0C,0x43,0x16,0xE3,0x8C,0x23,0xD9,
+  0xDA,0xDE,0x34,0x97,0xBD,0x0B,0x3F,0xF8,0xC1,0x0F,0xC0,0x0F,0x08,0xEA,0x03,0x82,
+  0xFA,0x80,0x70,0xC6,0xF0,0x01,0xC1,0x94,0x21,0x91,0x85,0x50,0x21,0x41,0x12,0x38,
+  0x96,0xE4,0x0D,0x26,0x75,0xA4,0x49,0xDC,0x70,0x94,0x46,0x9E,0xA4,0x0D,0x48,0x61,
+  0x24,0x4A,0xD8,0x98,0x92,0x35,0x28,0x35,0x11,0x2B,0x41,0x05,0x53,0x4E,0xD1,0x52,
+  0x33,0xBC,0x44,0x7D,0x40,0x50,0x1F,0x10,0xD4,0x07,0x04,0xF5,0x01,0x01,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x03,0xA9,0x94,0xC4,0x38,0x24,0x29,0xD2,0x38,0x8A,0x15,0x92,
+  0x82,0x0C,0x24,0x1C,0xC6,0x28,0x46,0x38,0x0A,0x52,0x8C,0x70,0x14,0xC3,0x18,0xE1,
+  0x28,0x86,0x31,0xC2,0x51,0x0C,0x43,0x88,0xA3,0x18,0xC5,0x10,0x09,0x31,0x0A,0x31,
+  0x96,0x61,0x10,0x83,0x8C,0xA4,0x24,0x25,0x19,0x63,0x22,0x0F,0x59,0x00,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x03,0x06,0xAD,0x0C,0x75,0x26,0x24,0xCD,0x51,0x46,0xA2,0x10,
+  0x91,0x30,0x24,0x1C,0xCE,0x08,0x87,0x33,0xC2,0xE1,0x8C,0x70,0x38,0x23,0x1C,0xCE,
+  0x08,0x87,0x33,0x42,0xC2,0x10,0x91,0x28,0x64,0x34,0x47,0x21,0xA1,0xE9,0x50,0xB6,
+  0x22,0x3F,0xF8,0xC1,0x0F,0x7E,0x10,0x98,0x36,0xAD,0x2B,0x6D,0xA7,0x3B,0x0B,0x61,
+  0x4A,0x72,0x14,0x92,0x24,0x64,0x2C,0x49,0x09,0xCB,0x42,0xC0,0xC2,0x90,0xC7,0x28,
+  0xA5,0x21,0x8F,0x29,0x54,0x43,0x1E,0x53,0x24,0x87,0x3C,0xA6,0x40,0x0F,0x79,0x4C,
+  0x61,0x22,0xF2,0x98,0x82,0x4C,0xE4,0x31,0x1C,0x89,0x09,0x5C,0x58,0xD4,0xA2,0x16,
+  0xB5,0x08,0x3F,0xF8,0xC1,0x0F,0x44,0xC3,0x32,0x94,0x18,0xC4,0x1C,0xCA,0x20,0x07,
+  0x33,0xC4,0xE1,0x8C,0x50,0x40,0x22,0x14,0x81,0x0B,0x04,0x28,0x04,0x27,0x88,0x4F,
+  0x08,0x82,0x10,0x88,0xF8,0x84,0x20,0x08,0x81,0x88,0x4F,0x08,0x82,0x18,0x87,0xF8,
+  0x84,0x20,0x88,0x52,0x88,0x4F,0x08,0x43,0x40,0x83,0x00,0x85,0x60,0x84,0x12,0x88,
+  0x50,0x0C,0xA4,0x18,0x81,0x08,0x47,0x43,0xC4,0xC1,0x0C,0x72,0x28,0xC3,0x24,0x06,
+  0x41,0x19,0x6B,0x00,0x3F,0xF8,0x41,0x40,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,
+  0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,
+  0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0xDC,0xD0,0x86,0x36,0xB4,0x01,0xC4,0x18,
+  0x83,0x33,0xC2,0xE1,0x8C,0xAF,0x38,0xA3,0x3B,0x0D,0x5D,0x90,0x43,0x95,0x03,0x51,
+  0xE4,0x48,0xD4,0x38,0x14,0x25,0x0E,0x8B,0x56,0xB4,0xA2,0x15,0xAD,0x68,0x45,0x2B,
+  0x62,0x0F,0x7B,0x8C,0xB1,0x94,0xE9,0x20,0x43,0x31,0xD1,0x49,0x86,0x72,0x1E,0xA4,
+  0x8C,0x04,0x39,0x87,0x19,0x48,0x72,0x8A,0x33,0x0E,0x22,0x10,0x67,0x40,0xC3,0x20,
+  0x03,0x71,0x82,0x34,0x8A,0x32,0x90,0x90,0x0C,0x85,0x20,0xE1,0x2A,0x88,0xA8,0x0A,
+  0x22,0x26,0x83,0x8C,0xE7,0x20,0x64,0x41,0x08,0xC4,0x90,0xC7,0x18,0x9C,0x11,0x0E,
+  0x67,0x7C,0xA5,0xA1,0xCD,0x69,0xE8,0x82,0x1C,0xAA,0x1C,0x88,0x22,0x47,0xA2,0xC6,
+  0x61,0x0F,0x8B,0x56,0xB4,0xA2,0x15,0x19,0x24,0x44,0x47,0xF9,0xD0,0x71,0x3A,0x84,
+  0x90,0x60,0x70,0x27,0x21,0xC2,0xD0,0x8E,0x42,0x86,0x81,0x9D,0x65,0x14,0xC3,0x3A,
+  0xCC,0x30,0x06,0x85,0x16,0x72,0x8C,0xE9,0x30,0x04,0x19,0x53,0x71,0xA8,0x33,0x20,
+  0xEA,0x04,0x89,0x86,0x34,0xA4,0xED,0x90,0x87,0x3C,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0x14,0xF3,0x1A,0x04,0x3F,0xA6,
+  0xD8,0x8F,0x29,0xF6,0x63,0x8A,0xFD,0x98,0xE4,0x3E,0x06,0x3F,0xF8,0x41,0x1F,0x64,
+  0x02,0x1B,0x17,0xB1,0x4A,0x2D,0x42,0x41,0x0B,0x51,0xCC,0x62,0x14,0xB2,0x20,0x45,
+  0x2C,0x4A,0x01,0x0B,0x53,0xBC,0x72,0x04,0xA3,0x78,0xC3,0x20,0xC6,0x00,0x83,0x61,
+  0x8C,0x70,0x22,0x56,0xA9,0x45,0x28,0x68,0x21,0x8A,0x59,0x8C,0x42,0x16,0xA4,0x88,
+  0x45,0x29,0x60,0x61,0x8A,0x57,0x9C,0xE2,0x0D,0x68,0x80,0x41,0x0A,0x3F,0xF8,0xC1,
+  0x0F,0xD2,0x20,0x05,0x70,0x40,0xC3,0x2B,0x4E,0xF1,0x0A,0x53,0xC0,0xA2,0x14,0xB1,
+  0x20,0x85,0x2C,0x46,0x31,0x0B,0x51,0xD0,0x22,0x14,0x55,0xB1,0xE8,0x0C,0x86,0x31,
+  0x02,0x38,0x8C,0x71,0x0C,0xAF,0x18,0xE1,0x28,0x5E,0x61,0x0A,0x58,0x94,0x22,0x16,
+  0xA4,0x90,0xC5,0x28,0x66,0x21,0x0A,0x5A,0x84,0xA2,0x2A,0x16,0xB9,0x06,0x1E,0x73,
+  0x00,0x40,0x31,0x4A,0x51,0x8C,0x52,0x14,0xA3,0x18,0xA5,0x28,0x46,0x29,0x8A,0x51,
+  0x8C,0x52,0x14,0xA3,0x14,0xC5,0x28,0x46,0x29,0x8A,0x51,0x8A,0x62,0x14,0xA3,0x14,
+  0xC5,0x28,0x45,0xF9,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0x24,0xC5,0x28,0x45,0x31,0x4A,
+  0x51,0x8C,0x62,0x94,0xA2,0x18,0xA5,0x28,0x46,0x31,0x4A,0x51,0x8C,0x52,0x14,0xA3,
+  0x18,0xA5,0x28,0x46,0x29,0x8A,0x51,0x8C,0x52,0x14,0xA3,0x14,0xE5,0x07,0x3F,0xF8,
+  0xC1,0x0F,0xA6,0x62,0x94,0xA2,0x18,0xA5,0x28,0x46,0x31,0x4A,0x51,0x8C,0x52,0x14,
+  0xA3,0x18,0xA5,0x28,0x46,0x29,0x8A,0x51,0x8C,0x52,0x14,0xA3,0x14,0xC5,0x28,0x46,
+  0x29,0x8A,0x51,0x8A,0x02,0x45,0x31,0x8A,0x51,0x8A,0x62,0x94,0xA2,0x18,0xC5,0x28,
+  0x45,0x31,0x4A,0x51,0x8C,0x62,0x94,0xA2,0x18,0xA5,0x28,0x46,0x31,0x4A,0x51,0x8C,
+  0x52,0x14,0xA3,0x18,0xA5,0x28,0x86,0x32,0x4A,0x51,0x8C,0x52,0x14,0xA3,0x18,0xA5,
+  0x28,0x46,0x29,0x8A,0x51,0x8C,0x52,0x14,0xA3,0x14,0xC5,0x28,0x46,0x29,0x8A,0x51,
+  0x8A,0x62,0x14,0xA3,0x14,0xC5,0x28,0x45,0xF9,0x41,0x50,0x8C,0x62,0x94,0xA2,0x18,
+  0xA5,0x28,0x46,0x31,0x4A,0x51,0x8C,0x52,0x14,0xA3,0x18,0xA5,0x28,0x46,0x29,0x8A,
+  0x51,0x8C,0x52,0x14,0xA3,0x14,0xC5,0x28,0x46,0x29,0x8A,0xA1,0x8C,0x52,0x14,0xA3,
+  0x14,0xC5,0x28,0x46,0x29,0x8A,0x51,0x8A,0x62,0x14,0xA3,0x14,0xC5,0x28,0x45,0x31,
+  0x8A,0x51,0x8A,0x62,0x94,0xA2,0x18,0xC5,0x28,0x45,0x31,0x4A,0x51,0x96,0x62,0x14,
+  0xA3,0x14,0xC5,0x28,0x45,0x31,0x8A,0x51,0x8A,0x62,0x94,0xA2,0x18,0xC5,0x28,0x45,
+  0x31,0x4A,0x51,0x8C,0x62,0x94,0xA2,0x18,0xA5,0x28,0x46,0x31,0x4A,0x51,0x8C,0x52,
+  0x17,0xA3,0x14,0xC5,0x28,0x45,0x31,0x8A,0x51,0x8A,0x62,0x94,0xA2,0x18,0xC5,0x28,
+  0x45,0x31,0x4A,0x51,0x8C,0x62,0x94,0xA2,0x18,0xA5,0x28,0x46,0x31,0x4A,0x51,0x8C,
+  0x52,0x14,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0x80,0x35,0x4A,
+  0x51,0x8C,0x52,0x14,0xA3,0x18,0xA5,0x28,0x46,0x29,0x8A,0x51,0x8C,0x52,0x14,0xA3,
+  0x14,0xC5,0x28,0x46,0x29,0x8A,0x51,0x8A,0x62,0x14,0xA3,0x14,0xC5,0x28,0x45,0x31,
+  0x8A,0x51,0x8A,0x62,0x94,0xA2,0x18,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,
+  0xE0,0x03,0xD6,0x28,0x45,0x31,0x4A,0x51,0x8C,0x62,0x94,0xA2,0x18,0xA5,0x28,0x46,
+  0x31,0x4A,0x51,0x8C,0x52,0x14,0xA3,0x18,0xA5,0x28,0x46,0x29,0x8A,0x51,0x8C,0x52,
+  0x14,0xA3,0x14,0xC5,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xB0,
+  0x46,0x29,0x8A,0x51,0x8A,0x62,0x14,0xA3,0x14,0xC5,0x28,0x45,0x31,0x8A,0x51,0x8A,
+  0x62,0x94,0xA2,0x18,0xC5,0x28,0x45,0x31,0x4A,0x51,0x8C,0x62,0x94,0xA2,0x18,0xA5,
+  0x28,0x46,0x31,0x4A,0x51,0x8C,0x52,0x14,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,
+  0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0xE2,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,
+  0x34,0x19,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,
+  0x62,0x12,0x93,0x98,0x60,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x68,0x69,0x88,
+  0xC9,0x6B,0xD8,0xA4,0x2E,0xB4,0x95,0xCD,0x64,0x66,0x33,0xDF,0xC8,0x04,0x12,0xAE,
+  0x82,0x60,0xA1,0x58,0x08,0xB9,0xC4,0xB0,0x14,0x62,0x8D,0x01,0x35,0xA4,0x22,0x43,
+  0x81,0x08,0x55,0x06,0xD4,0x90,0xA9,0x10,0x6A,0x21,0x13,0x29,0x1A,0x42,0xA6,0x81,
+  0x34,0x83,0x4C,0x63,0x69,0x03,0x99,0x84,0xD3,0x02,0x32,0x05,0xE9,0xA1,0x6D,0x6D,
+  0x6A,0x5B,0x9B,0xBA,0xD8,0xF4,0x9A,0x98,0xD0,0x01,0x69,0x88,0xC9,0x6B,0xD8,0xA4,
+  0x2E,0xB4,0x95,0x6D,0x0A,0x12,0xAB,0xC4,0xD3,0xAC,0xD1,0xBC,0x8A,0x28,0x4C,0x20,
+  0x54,0x41,0x56,0x41,0xA6,0x62,0x2C,0x84,0x4C,0xA4,0x58,0x0A,0x99,0x48,0x81,0x1A,
+  0x32,0x0D,0xA3,0x40,0x64,0x12,0x07,0x6A,0xC8,0x34,0x0C,0xB5,0x90,0x89,0x14,0x0D,
+  0x21,0x13,0x39,0x9A,0x41,0xA6,0x92,0xB4,0x81,0x50,0x45,0x69,0x01,0xA9,0x48,0xF3,
+  0xAC,0xF1,0xB4,0x4B,0x48,0xAD,0x0A,0x54,0x5B,0x9B,0xBA,0xD8,0xF4,0x9A,0x98,0xD0,
+  0x01,0x69,0x88,0xC9,0x6B,0xD8,0xA4,0x2E,0xB4,0x95,0xCD,0x64,0x51,0xA0,0xDA,0x24,
+  0xA2,0x37,0x8D,0x86,0x09,0x64,0x1A,0xCB,0x2A,0xC8,0x44,0x8E,0x85,0x90,0xA9,0x10,
+  0x4B,0x21,0x54,0x19,0x50,0x43,0x2A,0x32,0x14,0x88,0x58,0x63,0x40,0x0D,0xB9,0xC4,
+  0xA0,0x16,0x82,0x85,0xA1,0x21,0xC4,0x6B,0x06,0x09,0xDB,0x40,0xC6,0x16,0x10,0xF3,
+  0xA1,0x6D,0x6D,0x6A,0x5B,0x9B,0xBA,0xD8,0xF4,0x9A,0x98,0xD0,0x01,0x3F,0xD8,0xDD,
+  0x68,0x3B,0x9D,0x25,0x26,0x59,0x86,0x32,0x54,0x41,0x10,0x52,0x24,0x82,0x30,0x84,
+  0x44,0xE3,0x80,0xC7,0x80,0x88,0x21,0x0D,0xF2,0x8C,0xA3,0x1C,0xE6,0x18,0x0E,0x31,
+  0xC8,0x52,0x0C,0xD2,0x8C,0x63,0x34,0xE4,0x18,0xCD,0x30,0x88,0x43,0x8C,0xD1,0x0C,
+  0x63,0x40,0xC3,0x18,0xCD,0x30,0x06,0x34,0x8C,0xD1,0x0C,0x63,0x40,0xC3,0x18,0xCD,
+  0x30,0x06,0x34,0x8C,0xD1,0x0C,0x63,0x40,0xC3,0x18,0x0D,0x29,0x06,0x34,0x0A,0xE2,
+  0x8C,0x82,0x38,0xC3,0x18,0x0F,0x29,0x86,0x33,0x0A,0x02,0x8D,0x62,0x38,0xA3,0x18,
+  0x11,0xE1,0x88,0x54,0xB0,0x42,0x19,0xCA,0x58,0x89,0x49,0x99,0xEE,0xEC,0xE8,0x00,
+  0x15,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,
+  0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x42,0x65,0xE2,0x03,0x92,
+  0xF8,0x80,0x24,0x3E,0x20,0x09,0xFC,0x83,0x1F,0xFC,0xE0,0xFA,0xC0,0x07,0x3E,0xF0,
+  0x81,0x0F,0x7C,0x40,0x03,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,
+  0xDA,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0xFA,0x07,0x3F,0xF8,0xC1,0xF5,0x81,
+  0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0x80,0x06,0x15,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,
+  0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,
+  0x48,0x4A,0x08,0x92,0x12,0x02,0x57,0x84,0xC0,0x15,0x21,0x70,0x45,0x08,0x5C,0x91,
+  0x98,0xC4,0x24,0x26,0xF1,0x07,0x42,0xF5,0x81,0x50,0x7D,0x20,0x54,0x1F,0x08,0x15,
+  0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,
+  0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x42,0x65,0x82,0x50,0x99,0x20,
+  0x54,0x26,0x08,0x95,0x09,0x12,0x93,0x98,0xC4,0x24,0x26,0xD4,0x07,0x04,0xF5,0x01,
+  0x41,0x7D,0x40,0x50,0x1F,0x10,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0xA5,0xF4,0x91,0x33,
+  0xAC,0xDF,0xED,0x50,0x82,0xB8,0xE2,0x1C,0xAD,0x40,0x46,0x23,0x52,0xC9,0xCA,0x54,
+  0x30,0x42,0x15,0xEA,0x03,0xE7,0xF9,0xC0,0x79,0x3E,0x70,0x26,0x52,0x11,0x8C,0x54,
+  0x04,0x23,0x15,0xC9,0xC8,0x44,0x34,0x32,0x11,0x8D,0x4C,0x44,0x2B,0x11,0x01,0x79,
+  0xA0,0xC5,0x4C,0x62,0xF3,0x1E,0x86,0x14,0xA4,0x4A,0x0A,0x29,0x88,0x95,0x12,0x52,
+  0x90,0x4B,0x1D,0xA4,0x20,0x99,0x2A,0x48,0x41,0x34,0x45,0x90,0x82,0x70,0x4A,0x20,
+  0x05,0xF1,0x52,0x40,0x0A,0xF2,0xF1,0x4D,0x73,0xD9,0xBB,0x5C,0xDE,0x56,0x41,0xBE,
+  0x23,0x90,0x82,0x78,0x67,0x20,0x05,0xE1,0x4E,0x41,0x0A,0xB2,0x1D,0x83,0x14,0x44,
+  0x33,0x08,0x29,0x08,0x76,0x12,0x52,0x90,0xCB,0x2C,0xA4,0x20,0xD5,0x71,0x0B,0x4C,
+  0x62,0x31,0x07,0x19,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,
+  0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x3C,0xE3,0x19,0xCF,0x38,0x3F,0xF8,0xC1,0x0F,
+  0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0xE2,0x8E,0x75,0xAC,0x63,
+  0x3D,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,
+  0x4C,0x62,0x12,0x13,0x19,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,
+  0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0x60,0x1D,0xEB,0x58,0xC7,0x7A,0x4C,0x62,0x12,
+  0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,
+  0x19,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,
+  0x12,0x93,0x98,0xC4,0x3C,0xE3,0x19,0xCF,0x78,0x46,0x62,0x12,0x93,0x98,0xC4,0x24,
+  0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x3F,0xF8,0xC1,0x0F,
+  0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0xE2,0x0F,0x7C,0xE0,0x03,
+  0x1F,0xF8,0xC0,0x07,0x74,0x46,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,
+  0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x19,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,
+  0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,
+  0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,
+  0x98,0xC4,0x24,0x26,0x19,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,
+  0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0x60,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,
+  0xE8,0x8C,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,
+  0x31,0x89,0x49,0x4C,0x00,0x3F,0xF8,0xC1,0x0F,0x86,0xE2,0xA6,0x8E,0x28,0x8B,0x23,
+  0x49,0x8B,0x86,0x41,0x12,0xF7,0x14,0x83,0x24,0xA4,0x30,0x4E,0x31,0x08,0x42,0x8E,
+  0xD2,0x90,0x83,0x24,0x23,0x21,0xCD,0x40,0x48,0x32,0x12,0xD2,0x0C,0x84,0x20,0x24,
+  0x21,0x0D,0x39,0x08,0x32,0x14,0xE2,0x8C,0x83,0x20,0x43,0x21,0x0E,0x31,0x08,0x32,
+  0x94,0x01,0x0D,0x83,0x20,0x23,0x21,0x10,0x29,0xCA,0x31,0x92,0x21,0x8D,0xA2,0x1C,
+  0x03,0x21,0xD2,0x28,0x4E,0x31,0x0E,0x22,0x11,0x03,0x47,0xE5,0xD0,0x4F,0x41,0xB4,
+  0x33,0x96,0xEC,0x61,0xB8,0xC4,0x24,0x26,0x31,0x89,0x07,0x69,0x88,0xC9,0x6B,0xD8,
+  0xA4,0x2E,0xB4,0x95,0x2D,0x1A,0x12,0x93,0xCA,0xD3,0xA8,0xD2,0xBC,0x89,0x30,0x4C,
+  0x20,0xD3,0x58,0x56,0x41,0xA6,0x81,0x2C,0x84,0x4C,0xA4,0x58,0x0A,0xA1,0x46,0x81,
+  0x1A,0x42,0x11,0xA2,0x40,0xA4,0x1A,0x04,0x6A,0x48,0x45,0x06,0xB5,0x10,0x6B,0x0C,
+  0x0D,0x21,0xD6,0x28,0x9A,0x41,0x2A,0x82,0xB4,0x81,0x4C,0x65,0x69,0x01,0x99,0x8A,
+  0xF3,0xA6,0x21,0xB5,0xB5,0xA9,0x6D,0x6D,0xEA,0x62,0xD3,0x6B,0x62,0x42,0x07,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0xDA,0x07,0x04,0xF5,0x01,0x41,
+  0x7D,0x40,0x50,0x1F,0x10,0x31,0x89,0x49,0x4C,0x62,0x42,0x65,0x82,0x50,0x99,0x20,
+  0x54,0x26,0x08,0x95,0x09,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,
+  0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,
+  0x20,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0xEF,0x07,0x42,0xF5,
+  0x81,0x50,0x7D,0x20,0x54,0x1F,0x08,0x15,0x89,0x49,0x4C,0x62,0x12,0x13,0x02,0x57,
+  0x84,0xC0,0x15,0x21,0x70,0x45,0x08,0x5C,0x11,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,
+  0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,
+  0xA4,0x84,0x20,0x15,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,
+  0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x42,0x65,
+  0x82,0x50,0x99,0x20,0x54,0x26,0x08,0x95,0x09,0x12,0x93,0x98,0xC4,0x24,0x26,0x54,
+  0x26,0x08,0x95,0x09,0x42,0x65,0x82,0x50,0x99,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,
+  0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,
+  0x29,0x21,0x48,0x4A,0x08,0x02,0x15,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,
+  0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,
+  0x08,0x92,0x12,0x02,0x57,0x84,0xC0,0x15,0x21,0x70,0x45,0x08,0x5C,0x91,0x98,0xC4,
+  0x24,0x26,0x31,0x21,0x70,0x45,0x08,0x5C,0x11,0x02,0x57,0x84,0xC0,0x15,0x21,0x48,
+  0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,
+  0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x02,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x1F,0xFC,0xE0,0x07,0xDA,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0xFA,0x07,0x3F,
+  0xF8,0xC1,0x95,0x89,0x0F,0x48,0xE2,0x03,0x92,0xF8,0x80,0x24,0x70,0x45,0x08,0x92,
+  0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,
+  0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0x00,0x15,0x21,0x48,0x4A,0x08,0x92,0x12,
+  0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,
+  0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,
+  0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,
+  0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,
+  0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,
+  0x20,0x15,0x21,0x48,0x4A,0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,
+  0x08,0x92,0x12,0x82,0xA4,0x84,0x20,0x29,0x21,0x48,0x4A,0x08,0x42,0x65,0xE2,0x03,
+  0x92,0xF8,0x80,0x24,0x3E,0x20,0x09,0xFC,0x83,0x1F,0xFC,0xE0,0xCA,0xC4,0x07,0x24,
+  0xF1,0x01,0x49,0x7C,0x40,0x12,0xB8,0x22,0x04,0x49,0x09,0x41,0x52,0x42,0x90,0x94,
+  0x10,0x24,0x25,0x04,0x49,0x09,0x41,0x52,0x42,0x90,0x94,0x10,0x24,0x25,0x04,0x49,
+  0x09,0x41,0x00,0x3F,0xF8,0x41,0x1B,0xA8,0xE0,0x0D,0x69,0x70,0x05,0x22,0x5D,0x21,
+  0x0C,0x41,0xBE,0x12,0xA8,0x80,0x84,0x73,0x8C,0xA5,0x21,0x0C,0x59,0x90,0x32,0x12,
+  0x85,0x88,0x45,0x29,0x21,0x61,0x48,0x48,0x18,0x12,0x12,0x86,0x84,0x84,0x21,0x61,
+  0x51,0x8A,0x48,0x14,0x32,0x16,0xA4,0x90,0x86,0x30,0x25,0x24,0xA5,0x48,0x02,0x15,
+  0x10,0x90,0x10,0x86,0x20,0x1E,0x81,0x48,0x37,0xA4,0xE1,0x05,0x2A,0x00,0x3F,0xF8,
+  0x81,0x48,0xA6,0x54,0x11,0xE8,0x49,0xC4,0x99,0x10,0x29,0xC2,0x51,0x9F,0x32,0x8C,
+  0xE2,0x3A,0x65,0x18,0x04,0x4A,0x90,0x43,0x04,0x42,0x98,0xC6,0x38,0x89,0x28,0x51,
+  0x69,0x50,0x41,0x26,0xE2,0x1C,0xA2,0x4C,0xA5,0x31,0x05,0xA9,0x88,0x53,0x0A,0x52,
+  0x11,0xC7,0x10,0xA4,0x22,0x0D,0x1A,0x48,0x45,0x18,0x25,0x90,0x8A,0x30,0x24,0x30,
+  0x01,0xA9,0xC8,0x42,0x04,0x36,0x95,0x26,0x10,0x6B,0x22,0xD4,0x8A,0x4A,0xB5,0x1C,
+  0x73,0xB5,0x04,0x65,0x7B,0xCB,0x5E,0x1D,0x21,0xAA,0x00,0x17,0x89,0x49,0x4C,0xC6,
+  0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0x8A,0x28,0x64,
+  0x21,0x14,0x51,0xC8,0x42,0x28,0xA2,0x90,0x85,0x50,0x44,0x21,0x0B,0xA1,0x88,0x42,
+  0x16,0x42,0x11,0x85,0x2C,0x84,0x22,0x19,0xA1,0x48,0x46,0x28,0x82,0x15,0xAA,0x5C,
+  0xC4,0x22,0x17,0xB1,0x4A,0x55,0xAC,0x52,0x95,0xAB,0x4C,0x05,0x3B,0xCF,0xC9,0x52,
+  0x92,0xB6,0xDC,0xDD,0x8F,0x8E,0x10,0x55,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,
+  0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA0,0x30,0x7C,0x40,0x3C,0x62,0xF8,0x80,0x70,
+  0xC6,0x40,0x14,0xB2,0x90,0x86,0x0C,0x44,0x21,0x0B,0x61,0xCA,0x40,0x14,0xB2,0x90,
+  0xA5,0x10,0x44,0x21,0x0B,0x59,0x48,0x41,0x14,0xB2,0x90,0x85,0x14,0x44,0x21,0x0B,
+  0x59,0x86,0x41,0x14,0xB2,0x90,0x45,0x1C,0x44,0x21,0x0B,0x59,0x86,0x41,0x14,0xB2,
+  0x90,0x85,0x14,0x44,0x21,0x0B,0x59,0x48,0x41,0x14,0xB2,0x90,0xA5,0x10,0x44,0x21,
+  0x0B,0x61,0xCA,0x40,0x14,0xB2,0x90,0x86,0x0C,0x44,0x21,0x0B,0x71,0xC6,0x40,0x14,
+  0xB2,0x90,0x47,0x0C,0x24,0x23,0x50,0x18,0x48,0x46,0x28,0x92,0x91,0x98,0x00,0x3F,
+  0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,0xFA,0x80,0x58,0x48,0xF1,0x01,0xB1,
+  0x90,0xE2,0x03,0x62,0x21,0xC5,0x07,0xC4,0x42,0x0A,0xA2,0x90,0x85,0x50,0x44,0x21,
+  0x0B,0xA1,0x88,0x42,0x16,0x42,0x11,0x85,0x2C,0x84,0x22,0x0A,0x59,0x08,0x45,0x14,
+  0xB2,0x10,0x8A,0x28,0x64,0x21,0x14,0x51,0xC8,0x42,0x28,0xA2,0x90,0x85,0x50,0x44,
+  0x21,0x0B,0x59,0x48,0x41,0x14,0xB2,0x90,0x85,0x14,0x44,0x21,0x0B,0x59,0x48,0x41,
+  0x14,0xB2,0x90,0x85,0x14,0x44,0x21,0x0B,0xA1,0x88,0x42,0x16,0x42,0x91,0x8C,0x50,
+  0x24,0x23,0x14,0xC9,0x48,0x4C,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,
+  0x82,0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x88,0x25,0x20,0x1F,0x10,0x8B,0x38,0x88,
+  0x42,0x16,0xB2,0x0C,0x83,0x28,0x64,0x21,0xCB,0x30,0x88,0x42,0x16,0xB2,0x90,0x82,
+  0x28,0x64,0x21,0x4B,0x21,0x88,0x42,0x16,0xC2,0x94,0x81,0x28,0x64,0x21,0x0D,0x19,
+  0x88,0x42,0x16,0xE2,0x8C,0x81,0x28,0x64,0x21,0x8F,0x18,0x88,0x42,0x16,0x02,0x85,
+  0x81,0x28,0x64,0x21,0x14,0x51,0xC8,0x42,0x28,0xA2,0x90,0x85,0x50,0x44,0x21,0x0B,
+  0xA1,0x88,0x42,0x16,0x42,0x11,0x85,0x2C,0x84,0x22,0x19,0xA1,0x48,0x46,0x28,0x92,
+  0x91,0x98,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0x91,0x98,0xC4,0x24,0x26,0x31,0x89,
+  0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x3C,0xE3,0x19,0xCF,0x78,0xC6,0x01,0x3F,0xF8,
+  0xC1,0x0F,0x40,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0xA1,0x48,0x46,0x28,0x92,0x11,
+  0x8A,0x64,0x84,0x22,0x19,0xA1,0x48,0x46,0xA0,0x30,0x90,0x8C,0x3C,0x62,0xF8,0x80,
+  0x70,0xC6,0xF0,0x01,0xD1,0x90,0xE1,0x03,0x82,0x29,0xC3,0x07,0xC4,0x52,0x88,0x0F,
+  0x88,0x85,0x14,0x24,0x23,0xCB,0x30,0x48,0x46,0x96,0x61,0x90,0x8C,0x2C,0xE2,0x20,
+  0x19,0x59,0x02,0x42,0x32,0x42,0x91,0x8C,0x50,0x24,0x23,0x14,0xC9,0x08,0x45,0x32,
+  0x02,0x3F,0xF8,0xC1,0x0F,0x40,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0x81,0xC2,0x40,
+  0x32,0xF2,0x88,0x81,0x64,0xC4,0x19,0x03,0xC9,0x48,0x43,0x06,0x92,0x11,0xA6,0x0C,
+  0x24,0x23,0x4B,0x21,0x48,0x46,0x16,0x52,0x7C,0x40,0x2C,0xA4,0xF8,0x80,0x58,0x86,
+  0xF1,0x01,0xB1,0x88,0xE3,0x03,0x62,0x19,0xC6,0x07,0xC4,0x42,0x0A,0x92,0x91,0x85,
+  0x14,0x24,0x23,0x4B,0x21,0x48,0x46,0x98,0x32,0x90,0x8C,0x34,0x64,0x20,0x19,0x71,
+  0xC6,0x40,0x32,0xF2,0x88,0x81,0x64,0x04,0x0A,0x03,0xC9,0x08,0x45,0x32,0x02,0x3F,
+  0xF8,0xC1,0x0F,0x40,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0x59,0x48,0x41,0x32,0xB2,
+  0x90,0x82,0x64,0x64,0x21,0x05,0xC9,0xC8,0x42,0x0A,0x92,0x11,0x8A,0x64,0x84,0x22,
+  0x19,0xA1,0x3E,0x20,0xA8,0x0F,0x08,0xEA,0x03,0x82,0xFA,0x80,0xA0,0x3E,0x20,0x28,
+  0x92,0x11,0x8A,0x64,0x64,0x21,0x05,0xC9,0xC8,0x42,0x0A,0x92,0x91,0x85,0x14,0x24,
+  0x23,0x0B,0x29,0x48,0x46,0x28,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,0x01,0x19,0x89,
+  0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,
+  0x98,0x60,0x1D,0xEB,0x58,0xC7,0x3A,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,
+  0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0xF0,0x8C,0x67,0x3C,0xE3,0x19,0x89,0x49,
+  0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,
+  0x00,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,
+  0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,
+  0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,0x3E,
+  0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,
+  0x03,0x1F,0xF8,0xC0,0x07,0x3E,0xF0,0x81,0x0F,0x7C,0xE0,0x03,0x16,0x9B,0xDE,0xF4,
+  0xA6,0x37,0xBD,0xE9,0x4D,0x6F,0x7A,0xD3,0x9B,0xDE,0xF4,0xA6,0x37,0xBD,0xE9,0x4D,
+  0x6F,0x7A,0xD3,0x9B,0xDE,0xF4,0xA6,0x37,0xBD,0xE9,0x4D,0x6F,0x7A,0xD3,0x9B,0xDE,
+  0xF4,0xA6,0x37,0xBD,0xE9,0x4D,0x6F,0x7A,0xD3,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,
+  0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0xE4,0xB9,0x4C,0x62,0x2E,0x93,0x98,0xCB,
+  0x24,0xE6,0x32,0x01,0x3F,0xF8,0xC1,0x0F,0x40,0x92,0x11,0x8A,0x64,0x84,0x22,0x19,
+  0xA1,0x48,0x46,0x28,0x92,0x91,0x25,0x20,0x24,0x23,0x8B,0x38,0x48,0x46,0x96,0x61,
+  0x90,0x8C,0x2C,0xC3,0x20,0x19,0x59,0x48,0xF1,0x01,0xB1,0x14,0xE2,0x03,0x82,0x29,
+  0xC3,0x07,0x44,0x43,0x86,0x0F,0x08,0x67,0x0C,0x1F,0x10,0x8F,0x18,0x48,0x46,0xA0,
+  0x30,0x90,0x8C,0x50,0x24,0x23,0x14,0xC9,0x08,0x45,0x32,0x42,0x91,0x8C,0x50,0x24,
+  0x23,0x14,0xC9,0x08,0x45,0x32,0x02,0xC0,0xD6,0xB6,0xB6,0xB5,0xAD,0x6D,0x6D,0x6B,
+  0x5B,0xDB,0xDA,0xD6,0xB6,0xB6,0xB5,0xAD,0x6D,0x6D,0x6B,0x5B,0xDB,0xDA,0xD6,0xB6,
+  0xB6,0xB5,0xAD,0x6D,0x6D,0x6B,0x5B,0xDB,0xDA,0xD6,0xB6,0xB6,0xB5,0xAD,0x6D,0x6D,
+  0x6B,0x5B,0xDB,0x3F,0xF8,0xD7,0x19,0xC5,0xEA,0xE5,0x6D,0x67,0x69,0x49,0xD7,0x89,
+  0x8E,0x55,0xAA,0x52,0x95,0xAB,0x50,0x24,0x23,0x50,0x10,0x4A,0x56,0x1C,0x21,0x90,
+  0x8D,0x34,0x43,0x20,0x1B,0x61,0x88,0x40,0x36,0xB2,0x14,0x81,0x6C,0x44,0x29,0x03,
+  0xD9,0x88,0x42,0x08,0xB2,0x11,0x65,0x14,0x25,0x2B,0xCA,0x30,0x48,0x46,0x16,0x71,
+  0x94,0xAB,0x2C,0x21,0x29,0x55,0xB1,0x4E,0x74,0xAE,0xB4,0xA4,0x6C,0x6F,0xD9,0xAB,
+  0x62,0x3C,0x17,0x3F,0xF8,0xC1,0x0F,0xBA,0x0F,0x94,0xE7,0x03,0xA7,0xF9,0x40,0x6A,
+  0x3E,0x90,0x98,0x0F,0x28,0xC6,0xB8,0x05,0x26,0x31,0x89,0x49,0x58,0x16,0xE2,0x10,
+  0x88,0x2C,0x84,0x41,0x0E,0x59,0x88,0xB2,0x1A,0xB2,0x14,0xA4,0x35,0x64,0x29,0x05,
+  0x64,0xC8,0x02,0x07,0xB4,0x90,0xC5,0x19,0x48,0x21,0x0C,0x43,0x50,0x42,0x9A,0xB4,
+  0x9C,0x84,0x38,0xC6,0x39,0x47,0x19,0x11,0x51,0x4A,0x68,0x3A,0xB4,0xA5,0x8B,0x3D,
+  0x3F,0xF8,0xD7,0x19,0xC5,0xEA,0xE5,0x6D,0x4F,0xA1,0x48,0x4B,0x8A,0x04,0x71,0xA2,
+  0xF3,0x0C,0xA2,0x54,0xC5,0x21,0x43,0xB9,0x0A,0x53,0x06,0x92,0x91,0xA5,0x0C,0x25,
+  0x2B,0x0A,0x21,0xC8,0x46,0x14,0x42,0x90,0x8D,0x28,0xA3,0x20,0x1B,0x51,0x84,0x41,
+  0x36,0xA2,0x8C,0x82,0x6C,0x44,0x21,0x04,0xD9,0x88,0x42,0x88,0x92,0x15,0xA5,0x10,
+  0x24,0x23,0x4C,0x19,0xCA,0x55,0x1A,0x42,0x94,0xAA,0x3C,0x83,0x38,0xD1,0x81,0x44,
+  0x91,0x96,0x24,0x05,0x63,0x6F,0xD9,0xAB,0x62,0x3C,0x17,0x3F,0xF8,0xD7,0x19,0xC5,
+  0xEA,0xE5,0x6D,0x67,0x69,0x49,0xD7,0x89,0x0E,0x13,0x92,0x52,0x15,0x46,0x1C,0xE5,
+  0x2A,0xCB,0x30,0x48,0x46,0x96,0x51,0x94,0xAC,0x28,0x84,0x20,0x1B,0x51,0xCA,0x40,
+  0x36,0xB2,0x14,0x81,0x6C,0x84,0x21,0x02,0xD9,0x48,0x33,0x04,0xB2,0x11,0x47,0x08,
+  0x64,0x23,0x4F,0x10,0x4A,0x56,0x26,0x92,0x11,0xAA,0x5C,0xA5,0x2A,0x55,0xB1,0x4E,
+  0x74,0xAE,0xB4,0xA4,0x6C,0x6F,0xD9,0xAB,0x62,0x3C,0x17,0x3F,0xF8,0x41,0x9E,0xD2,
+  0x47,0xCE,0xB0,0x52,0x03,0xB9,0x51,0x39,0x50,0x82,0xA0,0x62,0x9C,0xE6,0x38,0x04,
+  0x29,0x51,0x71,0x46,0x42,0x26,0xE2,0x0C,0xA4,0x4C,0xA5,0x21,0x07,0xA9,0x88,0x33,
+  0x0E,0x52,0x11,0x87,0x18,0xA4,0x22,0xCF,0x30,0x48,0x45,0x1E,0x52,0x90,0x8A,0x40,
+  0xA3,0x20,0x15,0x81,0x46,0x51,0xA6,0xF2,0x10,0x83,0x4C,0xC4,0x29,0x47,0x89,0x8A,
+  0x53,0x8E,0xD3,0x1C,0x67,0x28,0x28,0x41,0xDD,0xFD,0x6A,0x38,0xC9,0x97,0x26,0x3F,
+  0xF8,0xD7,0x19,0xC5,0xEA,0xE5,0x6D,0x47,0xA3,0x48,0x4B,0x72,0x0A,0x71,0xA2,0xD3,
+  0x14,0xA2,0x54,0x85,0x21,0x45,0xB9,0xCA,0x32,0x0C,0x92,0x91,0x65,0x14,0x25,0x2B,
+  0x0A,0x21,0xC8,0x46,0x96,0x41,0x90,0x8D,0x2C,0x64,0x20,0x1B,0x61,0xC6,0x40,0x36,
+  0xC2,0x10,0x81,0x6C,0xA4,0x19,0x02,0xD9,0x48,0x33,0x84,0x92,0x15,0x86,0x0C,0x24,
+  0x23,0x4B,0x21,0xCA,0x55,0x96,0x52,0x94,0xAA,0x30,0xE3,0x38,0xD1,0xB9,0xD2,0x92,
+  0xB2,0xBD,0x65,0xAF,0x8A,0xF1,0x5C,0x3F,0xF8,0xC1,0x0F,0x7E,0xB0,0x7D,0x00,0x39,
+  0x1F,0x40,0xCE,0x07,0x90,0xF3,0x01,0xE4,0x7C,0x00,0x85,0x07,0x36,0xB0,0x81,0x4B,
+  0x5C,0xE0,0x02,0x17,0xB8,0xC0,0xE5,0x2D,0x6F,0x79,0x8B,0x5B,0x3A,0xBD,0xF1,0x8C,
+  0x67,0x3C,0xE3,0xF2,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0xE0,0x7C,0x80,0x0A,0x1F,0xA0,
+  0xC2,0x07,0xA8,0xF0,0x01,0x2A,0x7C,0x80,0x52,0xA4,0x21,0xDF,0x80,0x48,0x37,0xA2,
+  0xB2,0x11,0x89,0x68,0x84,0x22,0x19,0xA1,0x08,0x46,0x2A,0x82,0x91,0x8A,0x60,0xA4,
+  0x22,0x18,0xA1,0x0A,0x56,0xA6,0x82,0x15,0xA9,0x68,0xE5,0x39,0x1A,0x52,0x10,0x87,
+  0x3D,0x0B,0xD2,0x11,0xA2,0x0A,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0xE6,0x03,0x82,
+  0xFA,0x80,0xA0,0x3E,0x20,0xA8,0x0F,0x08,0xEA,0x03,0x42,0x23,0x0C,0x09,0x09,0x43,
+  0x42,0xC2,0x90,0x90,0x30,0x24,0x24,0x0C,0x09,0x09,0x43,0x42,0xC2,0x90,0x90,0x30,
+  0x24,0x24,0x4B,0x09,0xC9,0x42,0xC4,0xA2,0x10,0xB1,0x24,0x65,0x2C,0x47,0x21,0x4D,
+  0x61,0x48,0x68,0xBE,0xB3,0xA5,0x8B,0x35,0x3F,0xF8,0xC1,0x0F,0xC0,0xCC,0xF1,0xCC,
+  0x5F,0xDF,0xFA,0x40,0x70,0x0F,0x6C,0xE0,0x12,0x97,0x27,0x84,0xC4,0x11,0x21,0x69,
+  0x46,0x48,0x18,0x12,0x92,0xA5,0x84,0x44,0x29,0x22,0x51,0xC8,0x48,0x94,0x31,0x16,
+  0x65,0x88,0x65,0x11,0xA2,0x59,0x42,0x78,0xAA,0x0F,0x84,0xEA,0x5B,0xFE,0xE2,0x59,
+  0x06,0x3F,0xF8,0xC1,0x0F,0xC0,0xCC,0xF1,0xCC,0x4F,0x61,0xF8,0x91,0x18,0x3E,0x10,
+  0x9E,0xC1,0x1D,0x87,0x78,0x86,0x29,0x5F,0x59,0x4A,0x58,0x14,0x32,0x12,0x85,0x8C,
+  0x44,0x19,0x24,0x51,0x44,0x49,0x94,0x41,0x12,0x85,0x8C,0x44,0x21,0x23,0x51,0x4A,
+  0x58,0x96,0xF2,0x95,0x86,0x78,0xC6,0x19,0xDC,0x81,0xC4,0xF0,0x81,0x10,0x85,0xE1,
+  0x5B,0xFE,0xE2,0x59,0x06,0x3F,0xF8,0xC1,0x0F,0xC0,0xCC,0xF1,0xCC,0x5F,0xDF,0xFA,
+  0x40,0x60,0x42,0x78,0x18,0x21,0x9A,0x65,0x88,0x65,0x19,0x63,0x51,0xC8,0x48,0x94,
+  0x22,0x92,0xA5,0x84,0x84,0x21,0x21,0x69,0x46,0x48,0x1C,0x11,0x92,0x27,0x84,0x04,
+  0x2E,0x6F,0x79,0x4D,0x7B,0xAA,0x0F,0x84,0xEA,0x5B,0xFE,0xE2,0x59,0x06,0x3F,0xC8,
+  0x03,0x3D,0x3E,0xF2,0x18,0x8E,0x3C,0x48,0x23,0x8F,0xC2,0xC8,0xC3,0x2C,0x12,0x31,
+  0x8A,0x4C,0x0D,0x2A,0x16,0x73,0x48,0xC6,0x14,0xB3,0xB1,0xC3,0x28,0x61,0x62,0x03,
+  0x4A,0x44,0x45,0x93,0x81,0xBD,0xA4,0x68,0x4B,0x29,0x9A,0x5A,0x4A,0xA6,0x98,0x82,
+  0x29,0x87,0x5C,0x0A,0x1A,0xD5,0x92,0x04,0xA5,0xAA,0x30,0xA9,0x54,0xA5,0x2A,0x55,
+  0x2B,0x6A,0x0B,0x3C,0xE4,0x00,0x7E,0xA0,0xC5,0x4C,0xE2,0x02,0x1F,0x17,0xB9,0xA9,
+  0x4D,0x6E,0x72,0x91,0x9B,0x5C,0x04,0x86,0x26,0x75,0xE2,0xA9,0xCE,0x80,0x68,0x43,
+  0x24,0xC9,0x94,0x68,0x2E,0x25,0xA2,0x0B,0x81,0x50,0x36,0xA0,0xB3,0x0D,0x07,0x71,
+  0xC2,0x39,0x5E,0x68,0x10,0x7B,0x58,0xC4,0x9E,0xF6,0xB8,0x05,0x26,0xB1,0x98,0x03,
+  0x00,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,
+  0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,
+  0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x3F,0xF8,0xC1,0x0F,
+  0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x5F,0x98,0x85,0x3C,0x62,0x02,0x97,0xB7,0xC0,
+  0x24,0x1E,0xF2,0x90,0xC5,0x1C,0x00,0x3F,0xF8,0xC1,0x0F,0x7E,0x50,0x92,0x98,0xC4,
+  0x24,0x26,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x49,
+  0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x89,0x09,0x3F,0xF8,0x81,0x40,0x18,
+  0x12,0x12,0x86,0x84,0x84,0x21,0x21,0x61,0x48,0x48,0x18,0x12,0x12,0x86,0x84,0x84,
+  0x21,0x21,0x61,0x48,0x48,0x18,0x12,0x12,0x86,0x84,0x84,0x21,0x21,0x61,0x48,0x46,
+  0x09,0x92,0x51,0x82,0x64,0x94,0x20,0x19,0x25,0x48,0x48,0x18,0x12,0x12,0x86,0x84,
+  0x84,0x21,0x21,0x61,0x48,0x48,0x18,0x12,0x12,0x86,0x84,0x84,0x21,0x21,0x61,0x48,
+  0x48,0x18,0x12,0x12,0x86,0x84,0x84,0x21,0x21,0x61,0x08,0x2A,0x21,0x86,0x4A,0x88,
+  0xA1,0x12,0x62,0xA8,0x84,0x18,0x2A,0x21,0x86,0x4A,0x88,0xA1,0x12,0x62,0xA8,0x84,
+  0x18,0x2A,0x21,0x86,0x4A,0x88,0xA1,0x12,0x62,0xA8,0x84,0x18,0x2A,0x21,0x86,0x4A,
+  0x88,0xA1,0x12,0x62,0xA8,0x84,0x18,0x2A,0x21,0x86,0x4A,0x88,0xA1,0x12,0x62,0xA8,
+  0x84,0x18,0x2A,0x21,0x86,0x4A,0x88,0xA1,0x12,0x62,0xA8,0x84,0x18,0x2A,0x21,0x86,
+  0x4A,0x88,0xA1,0x12,0x62,0xA8,0x84,0x18,0x2A,0x21,0x86,0x4A,0x88,0xA1,0x12,0x62,
+  0xA8,0x84,0x18,0xF9,0x60,0x06,0x15,0x1A,0xC2,0x10,0x49,0x34,0xA3,0x18,0xC6,0x80,
+  0x48,0x33,0x8A,0x61,0x8C,0xA7,0x34,0xA3,0x18,0xC6,0x68,0x4E,0x33,0x8A,0x61,0x0C,
+  0xE6,0x38,0xA3,0x20,0xC5,0x50,0xD0,0x33,0x88,0x52,0x0C,0x04,0x45,0x64,0x30,0x03,
+  0x39,0x90,0x94,0x82,0x64,0xA0,0x0A,0x05,0xA9,0x40,0xD6,0x19,0xD0,0x80,0x32,0x33,
+  0x9C,0xE1,0x70,0xE3,0x20,0x02,0x1A,0x48,0x79,0x06,0x33,0xA2,0xE1,0x88,0x87,0x20,
+  0xC1,0x00,0x11,0x41,0x84,0xF1,0x9D,0x82,0x0C,0xA3,0x43,0xC5,0x28,0xC6,0x86,0x8C,
+  0x61,0x0C,0x0D,0x15,0xE4,0x18,0x18,0x32,0x08,0x32,0x2E,0x74,0x50,0x08,0x25,0xF4,
+  0x39,0x0B,0x75,0x0E,0x43,0x9D,0xE2,0x50,0x87,0x6C,0x63,0x12,0xDD,0x98,0x82,0x37,
+  0x00,0x3F,0xF8,0x81,0x7A,0xD8,0x95,0xB6,0xF3,0x99,0xB0,0x84,0xA4,0x1C,0xE5,0x38,
+  0xC5,0x29,0x7E,0xE0,0x1D,0x1F,0x78,0xC7,0x07,0xDE,0x31,0xE4,0x21,0x0F,0x79,0xC8,
+  0x43,0x1E,0xF2,0x90,0x3F,0xF0,0x8E,0x0F,0xBC,0xE3,0x03,0x0F,0x3F,0xF8,0xC1,0x0F,
+  0x7E,0xF0,0x03,0xA6,0x24,0xE5,0x29,0x4C,0x2A,0x92,0x43,0x96,0x35,0xAC,0xA6,0x24,
+  0x2D,0x68,0x0D,0x49,0x38,0x43,0x90,0x42,0xA4,0xC2,0x30,0xE5,0x20,0x86,0x41,0x0C,
+  0x43,0x0E,0x72,0x94,0xC4,0x2C,0xC4,0x20,0x88,0x41,0xCC,0x42,0x0C,0x92,0x94,0xA4,
+  0x2C,0xC4,0x20,0x89,0x49,0x8A,0x42,0x0C,0xA2,0x94,0xC4,0x24,0xC4,0x20,0x8A,0x49,
+  0x4A,0x42,0x0C,0xB2,0x94,0xC4,0x1C,0xC5,0x20,0x8B,0x41,0x8E,0x41,0x0E,0xC2,0x1C,
+  0x42,0x11,0xE5,0x28,0x4B,0x4F,0x08,0xD3,0x84,0x96,0x90,0x66,0x11,0x4B,0x21,0x4E,
+  0x32,0xD2,0x57,0x94,0x02,0x3F,0xF8,0x81,0x41,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,
+  0x31,0x89,0x49,0x4C,0x62,0x12,0x13,0xD3,0x14,0xC4,0x30,0x9A,0x29,0x88,0x61,0x34,
+  0x53,0x10,0xC3,0x68,0xA6,0x20,0x86,0xD1,0x4C,0x41,0x0C,0xA3,0x99,0x82,0x18,0xA6,
+  0x24,0x31,0x89,0x49,0x4C,0x62,0x12,0x93,0x98,0xC4,0x24,0x26,0x31,0x01,0x3F,0xF8,
+  0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,0xC1,0x0F,0xD4,0x40,0x08,
+  0x76,0x10,0x42,0x2D,0x84,0x50,0x0B,0x21,0xD4,0x20,0x0C,0x61,0xB4,0xA8,0x3D,0xAF,
+  0x81,0x09,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x60,0x79,0x4F,
+  0x3B,0x86,0xB1,0x8E,0x62,0xA8,0xE2,0x10,0xAA,0x38,0x84,0x2A,0x0E,0xA1,0x8E,0x62,
+  0xAC,0x63,0x18,0xED,0x79,0x0B,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x03,0x9C,0xC4,0x24,
+  0x26,0x31,0xF9,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xB0,0x48,0x4C,
+  0x62,0x12,0x13,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xFC,0xE0,0x07,0x3F,0xF8,
+  0xC1,0x0F,0x2A,0xF3,0x9A,0xD7,0xBC,0xE6,0x35,0xAF,0x01,0x3F,0xF8,0xC1,0x0F,0x7E,
+  0xF0,0x83,0x1F,0xFC,0x00,0x1D,0xF2,0x90,0x87,0x3C,0xE4,0x11,0xD3,0x90,0x86,0x34,
+  0xA4,0x21,0x05,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xC8,0x64,0x19,0xE3,0x60,
+  0xC6,0x38,0x98,0x31,0x0E,0x62,0x14,0x24,0x1C,0xC5,0x30,0x46,0x38,0x8A,0x61,0x8C,
+  0x70,0x14,0xC3,0x18,0xE1,0x28,0x86,0x31,0xC2,0x51,0x0C,0x63,0x84,0x83,0x28,0xC5,
+  0x08,0x07,0x51,0x08,0x12,0x12,0xE1,0x0C,0x24,0x4C,0x41,0x1A,0x51,0x90,0xC6,0x33,
+  0xA0,0xF1,0x0C,0xC7,0x1C,0x46,0x01,0x3F,0xF8,0xC1,0x0F,0x7E,0xF0,0x83,0x1F,0xC8,
+  0x44,0x29,0xE2,0x50,0x8C,0x38,0x92,0x13,0x92,0xE4,0x84,0x23,0x41,0xE1,0x40,0x48,
+  0x40,0xC2,0x81,0x0C,0x81,0x84,0xE3,0x20,0x02,0x09,0xC7,0x31,0x06,0x12,0x0E,0x83,
+  0x0C,0x24,0x24,0x04,0x21,0x48,0x48,0x08,0x42,0x90,0x70,0x15,0x44,0x54,0x05,0x11,
+  0x93,0x41,0xC6,0x73,0x10,0xB2,0x20,0x04,0x3F,0xC8,0x79,0xC6,0x33,0x9E,0xF1,0x8C,
+  0x67,0x3C,0xE3,0x19,0xCF,0x78,0xC6,0x33,0x9E,0xF1,0x8C,0x67,0x3C,0xE3,0x19,0xCF,
+  0x78,0xC6,0x33,0x9E,0xF1,0x8C,0x67,0x3C,0xE3,0x19,0xCF,0x78,0xC6,0x33,0x9E,0x71,
+};
+
+__UG_CONST UG_U16 font_32x53r_offset[257]={
+  0,0,108,185,245,295,355,409,409,409,409,409,496,576,576,640,
+  709,752,795,848,895,938,1043,1083,1155,1191,1229,1279,1329,1369,1427,1470,
+  1513,1513,1544,1576,1664,1739,1849,1944,1969,2024,2074,2132,2174,2202,2238,2263,
+  2305,2369,2430,2505,2585,2646,2721,2805,2865,2949,3033,3069,3109,3177,3257,3323,
+  3387,3486,3547,3638,3709,3777,3870,3939,4018,4069,4137,4187,4253,4299,4349,4398,
+  4463,4529,4608,4683,4770,4819,4861,4905,4949,5026,5069,5167,5224,5264,5313,5355,
+  5399,5427,5506,5570,5632,5694,5777,5845,5933,5977,6012,6072,6137,6170,6209,6247,
+  6308,6373,6435,6473,6555,6613,6651,6691,6735,6803,6860,6948,7008,7035,7093,7135,
+  7193,7280,7329,7427,7531,7621,7715,7816,7895,8003,8097,8195,8233,8284,8326,8398,
+  8470,8578,8673,8755,8841,8913,8989,9051,9104,9172,9248,9301,9384,9455,9545,9616,
+  9680,9774,9816,9892,9945,10006,10078,10142,10193,10258,10340,10382,10473,10555,10587,10653,
+  10721,10837,11042,11192,11217,11246,11322,11409,11485,11600,11653,11688,11743,11798,11855,11939,
+  11964,12004,12048,12092,12136,12180,12229,12331,12415,12481,12547,12630,12713,12777,12865,12947,
+  13022,13115,13192,13311,13415,13523,13550,13633,13727,13806,13831,13873,13949,13993,14020,14103,
+  14147,14227,14304,14395,14475,14559,14647,14693,14758,14824,14881,14949,15006,15078,15136,15180,
+  15207,15243,15323,15411,15537,15580,15685,15742,15778,15814,15843,15867,15891,15959,16024,16064,
+  16064,
+};
+
+__UG_CONST UG_FONT_RLE font_32x53r_rle={font_32x53r_data,font_32x53r_offset,6,5};
+#endif
+
 #ifdef USE_FONT_4X6
-   const UG_FONT FONT_4X6 = {(unsigned char*)font_4x6,NULL,4,6};
+   const UG_FONT FONT_4X6 = {(unsigned char*)font_4x6,NULL,4,6,NULL,NULL};
 #endif
 #ifdef USE_FONT_5X8
-   const UG_FONT FONT_5X8 = {(unsigned char*)font_5x8,NULL,5,8};
+   const UG_FONT FONT_5X8 = {(unsigned char*)font_5x8,NULL,5,8,NULL,NULL};
 #endif
 #ifdef USE_FONT_5X12
-   const UG_FONT FONT_5X12 = {(unsigned char*)font_5x12,NULL,5,12};
+   const UG_FONT FONT_5X12 = {(unsigned char*)font_5x12,NULL,5,12,NULL,NULL};
 #endif
 #ifdef USE_FONT_6X8
-   const UG_FONT FONT_6X8 = {(unsigned char*)font_6x8,NULL,6,8};
+   const UG_FONT FONT_6X8 = {(unsigned char*)font_6x8,NULL,6,8,NULL,NULL};
 #endif
 #ifdef USE_FONT_6X10
-   const UG_FONT FONT_6X10 = {(unsigned char*)font_6x10,NULL,6,10};
+   const UG_FONT FONT_6X10 = {(unsigned char*)font_6x10,NULL,6,10,NULL,NULL};
 #endif
 #ifdef USE_FONT_7X12
-   const UG_FONT FONT_7X12 = {(unsigned char*)font_7x12,NULL,7,12};
+   const UG_FONT FONT_7X12 = {(unsigned char*)font_7x12,NULL,7,12,NULL,NULL};
 #endif
 #ifdef USE_FONT_8X8
-   const UG_FONT FONT_8X8 = {(unsigned char*)font_8x8,NULL,8,8};
+   const UG_FONT FONT_8X8 = {(unsigned char*)font_8x8,NULL,8,8,NULL,NULL};
 #endif
 #ifdef USE_FONT_8X12_KRPM
-   const UG_FONT FONT_8X12_KRPM = {(unsigned char*)font_8x12_KRPM, LUT_8x12_KRPM,8,12};
+   const UG_FONT FONT_8X12_KRPM = {(unsigned char*)font_8x12_KRPM, LUT_8x12_KRPM,8,12,NULL,NULL};
 #endif
 #ifdef USE_FONT_8X12
-   const UG_FONT FONT_8X12 = {(unsigned char*)font_8x12,NULL,8,12};
+   const UG_FONT FONT_8X12 = {(unsigned char*)font_8x12,NULL,8,12,NULL,NULL};
 #endif
 #ifdef USE_FONT_8X14
-   const UG_FONT FONT_8X14 = {(unsigned char*)font_8x14,NULL,8,14};
+   const UG_FONT FONT_8X14 = {(unsigned char*)font_8x14,NULL,8,14,NULL,NULL};
+#endif
+#ifdef USE_FONT_8X14P
+   const UG_FONT FONT_8X14P = {(unsigned char*)font_8x14p_bitmap,NULL,8,14,&font_8x14p_prop,NULL};
 #endif
 #ifdef USE_FONT_10X16
-   const UG_FONT FONT_10X16 = {(unsigned char*)font_10x16,NULL,10,16};
+   const UG_FONT FONT_10X16 = {(unsigned char*)font_10x16,NULL,10,16,NULL,NULL};
 #endif
 #ifdef USE_FONT_12X16
-   const UG_FONT FONT_12X16 = {(unsigned char*)font_12x16,NULL,12,16};
+   const UG_FONT FONT_12X16 = {(unsigned char*)font_12x16,NULL,12,16,NULL,NULL};
 #endif
 #ifdef USE_FONT_12X20
-   const UG_FONT FONT_12X20 = {(unsigned char*)font_12x20,NULL,,12,20};
+   const UG_FONT FONT_12X20 = {(unsigned char*)font_12x20,NULL,12,20,NULL,NULL};
 #endif
 #ifdef USE_FONT_16X26
-   const UG_FONT FONT_16X26 = {(unsigned char*)font_16x26,NULL,16,26};
+   const UG_FONT FONT_16X26 = {(unsigned char*)font_16x26,NULL,16,26,NULL,NULL};
 #endif
 #ifdef USE_FONT_20X32
-   const UG_FONT FONT_20X32 = {(unsigned char*)font_20x32,LUT_20x32, 20,32};
+   const UG_FONT FONT_20X32 = {(unsigned char*)font_20x32,LUT_20x32, 20,32,NULL,NULL};
 #endif
 #ifdef USE_FONT_22X36
-   const UG_FONT FONT_22X36 = {(unsigned char*)font_22x36,NULL,22,36};
+   const UG_FONT FONT_22X36 = {(unsigned char*)font_22x36,NULL,22,36,NULL,NULL};
 #endif
 #ifdef USE_FONT_24X40
-   const UG_FONT FONT_24X40 = {(unsigned char*)font_24x40,NULL,24,40};
+   const UG_FONT FONT_24X40 = {(unsigned char*)font_24x40,NULL,24,40,NULL,NULL};
+#endif
+#ifdef USE_FONT_24X40R
+   const UG_FONT FONT_24X40R = {NULL,NULL,24,40,NULL,&font_24x40r_rle};
 #endif
 #ifdef USE_FONT_32X53
-   const UG_FONT FONT_32X53 = {(unsigned char*)font_32x53,NULL,32,53};
+   const UG_FONT FONT_32X53 = {(unsigned char*)font_32x53,NULL,32,53,NULL,NULL};
+#endif
+#ifdef USE_FONT_32X53R
+   const UG_FONT FONT_32X53R = {NULL,NULL,32,53,NULL,&font_32x53r_rle};
 #endif
 
 
@@ -4381,6 +6352,8 @@ UG_S16 UG_Init( UG_GUI* g, void (*p)(UG_S16,UG_S16,UG_COLOR), UG_S16 x, UG_S16 y
    g->font.char_v_space = 1;
    g->font.p = NULL;
    g->font.LUT = NULL;
+   g->font.prop = NULL;
+   g->font.rle = NULL;
    g->desktop_color = 0x5E8BEf;
    g->fore_color = C_WHITE;
    g->back_color = C_BLACK;
@@ -4388,6 +6361,14 @@ UG_S16 UG_Init( UG_GUI* g, void (*p)(UG_S16,UG_S16,UG_COLOR), UG_S16 x, UG_S16 y
    g->active_window = NULL;
    g->last_window = NULL;
 
+   /* Nothing is clipped but the screen edges */
+   g->clip[0].xs = 0;
+   g->clip[0].ys = 0;
+   g->clip[0].xe = x - 1;
+   g->clip[0].ye = y - 1;
+   g->clip_depth = 0;
+   g->dirty_cnt = 0;
+
    /* Clear drivers */
    for(i=0;i<NUMBER_OF_DRIVERS;i++)
    {
@@ -4408,8 +6389,11 @@ UG_S16 UG_SelectGUI( UG_GUI* g )
 void UG_FontSelect( const UG_FONT* font )
 {
    gui->font.p = font->p;
+   gui->font.LUT = font->LUT;
    gui->font.char_width = font->char_width;
    gui->font.char_height = font->char_height;
+   gui->font.prop = font->prop;
+   gui->font.rle = font->rle;
 }
 
 void UG_FillScreen( UG_COLOR c )
@@ -4420,6 +6404,7 @@ void UG_FillScreen( UG_COLOR c )
 void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 {
    UG_S16 n,m;
+   UG_AREA* clip;
 
    if ( x2 < x1 )
    {
@@ -4434,6 +6419,14 @@ void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
       y1 = n;
    }
 
+   /* Trim to the clip rectangle */
+   clip = &gui->clip[gui->clip_depth];
+   if ( x1 < clip->xs ) x1 = clip->xs;
+   if ( y1 < clip->ys ) y1 = clip->ys;
+   if ( x2 > clip->xe ) x2 = clip->xe;
+   if ( y2 > clip->ye ) y2 = clip->ye;
+   if ( (x1 > x2) || (y1 > y2) ) return;
+
    /* Is hardware acceleration available? */
    if ( gui->driver[DRIVER_FILL_FRAME].state & DRIVER_ENABLED )
    {
@@ -4502,6 +6495,7 @@ void UG_FillRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG
 void UG_DrawMesh( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 {
    UG_S16 n,m;
+   UG_PSET pset;
 
    if ( x2 < x1 )
    {
@@ -4516,11 +6510,14 @@ void UG_DrawMesh( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
       y1 = n;
    }
 
+   pset = _UG_ClipPSet(x1,y1,x2,y2);
+   if ( pset == NULL ) return;
+
    for( m=y1; m<=y2; m+=2 )
    {
       for( n=x1; n<=x2; n+=2 )
       {
-         gui->pset(n,m,c);
+         pset(n,m,c);
       }
    }
 }
@@ -4564,17 +6561,47 @@ void UG_DrawRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG
 
 void UG_DrawPixel( UG_S16 x0, UG_S16 y0, UG_COLOR c )
 {
+   _UG_PSetClipped(x0,y0,c);
+}
+
+void _UG_PSetClipped( UG_S16 x0, UG_S16 y0, UG_COLOR c )
+{
+   UG_AREA* clip = &gui->clip[gui->clip_depth];
+
+   if ( (x0 < clip->xs) || (x0 > clip->xe) ) return;
+   if ( (y0 < clip->ys) || (y0 > clip->ye) ) return;
    gui->pset(x0,y0,c);
 }
 
+/* Picks the pixel function for a shape within the given bounds: the plain one
+   when it is fully inside the clip rectangle, the checked one when it crosses
+   an edge and none at all when it is fully outside. */
+static UG_PSET _UG_ClipPSet( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2 )
+{
+   UG_AREA* clip = &gui->clip[gui->clip_depth];
+   UG_S16 n;
+
+   if ( x2 < x1 ) { n = x1; x1 = x2; x2 = n; }
+   if ( y2 < y1 ) { n = y1; y1 = y2; y2 = n; }
+
+   if ( (x2 < clip->xs) || (x1 > clip->xe) ) return NULL;
+   if ( (y2 < clip->ys) || (y1 > clip->ye) ) return NULL;
+   if ( (x1 >= clip->xs) && (x2 <= clip->xe) && (y1 >= clip->ys) && (y2 <= clip->ye) ) return gui->pset;
+   return _UG_PSetClipped;
+}
+
 void UG_DrawCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c )
 {
    UG_S16 x,y,xd,yd,e;
+   UG_PSET pset;
 
    if ( x0<0 ) return;
    if ( y0<0 ) return;
    if ( r<=0 ) return;
 
+   pset = _UG_ClipPSet(x0-r,y0-r,x0+r,y0+r);
+   if ( pset == NULL ) return;
+
    xd = 1 - (r << 1);
    yd = 0;
    e = 0;
@@ -4583,14 +6610,14 @@ void UG_DrawCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c )
 
    while ( x >= y )
    {
-      gui->pset(x0 - x, y0 + y, c);
-      gui->pset(x0 - x, y0 - y, c);
-      gui->pset(x0 + x, y0 + y, c);
-      gui->pset(x0 + x, y0 - y, c);
-      gui->pset(x0 - y, y0 + x, c);
-      gui->pset(x0 - y, y0 - x, c);
-      gui->pset(x0 + y, y0 + x, c);
-      gui->pset(x0 + y, y0 - x, c);
+      pset(x0 - x, y0 + y, c);
+      pset(x0 - x, y0 - y, c);
+      pset(x0 + x, y0 + y, c);
+      pset(x0 + x, y0 - y, c);
+      pset(x0 - y, y0 + x, c);
+      pset(x0 - y, y0 - x, c);
+      pset(x0 + y, y0 + x, c);
+      pset(x0 + y, y0 - x, c);
 
       y++;
       e += yd;
@@ -4645,11 +6672,15 @@ void UG_FillCircle( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_COLOR c )
 void UG_DrawArc( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_U8 s, UG_COLOR c )
 {
    UG_S16 x,y,xd,yd,e;
+   UG_PSET pset;
 
    if ( x0<0 ) return;
    if ( y0<0 ) return;
    if ( r<=0 ) return;
 
+   pset = _UG_ClipPSet(x0-r,y0-r,x0+r,y0+r);
+   if ( pset == NULL ) return;
+
    xd = 1 - (r << 1);
    yd = 0;
    e = 0;
@@ -4659,20 +6690,20 @@ void UG_DrawArc( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_U8 s, UG_COLOR c )
    while ( x >= y )
    {
       // Q1
-      if ( s & 0x01 ) gui->pset(x0 + x, y0 - y, c);
-      if ( s & 0x02 ) gui->pset(x0 + y, y0 - x, c);
+      if ( s & 0x01 ) pset(x0 + x, y0 - y, c);
+      if ( s & 0x02 ) pset(x0 + y, y0 - x, c);
 
       // Q2
-      if ( s & 0x04 ) gui->pset(x0 - y, y0 - x, c);
-      if ( s & 0x08 ) gui->pset(x0 - x, y0 - y, c);
+      if ( s & 0x04 ) pset(x0 - y, y0 - x, c);
+      if ( s & 0x08 ) pset(x0 - x, y0 - y, c);
 
       // Q3
-      if ( s & 0x10 ) gui->pset(x0 - x, y0 + y, c);
-      if ( s & 0x20 ) gui->pset(x0 - y, y0 + x, c);
+      if ( s & 0x10 ) pset(x0 - x, y0 + y, c);
+      if ( s & 0x20 ) pset(x0 - y, y0 + x, c);
 
       // Q4
-      if ( s & 0x40 ) gui->pset(x0 + y, y0 + x, c);
-      if ( s & 0x80 ) gui->pset(x0 + x, y0 + y, c);
+      if ( s & 0x40 ) pset(x0 + y, y0 + x, c);
+      if ( s & 0x80 ) pset(x0 + x, y0 + y, c);
 
       y++;
       e += yd;
@@ -4689,6 +6720,7 @@ void UG_DrawArc( UG_S16 x0, UG_S16 y0, UG_S16 r, UG_U8 s, UG_COLOR c )
 void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
 {
    UG_S16 n, dx, dy, sgndx, sgndy, dxabs, dyabs, x, y, drawx, drawy;
+   UG_PSET pset;
 
    if ( x2 < x1 )
    {
@@ -4703,8 +6735,11 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
       y1 = n;
    }
 
-   /* Is hardware acceleration available? */
-   if ( gui->driver[DRIVER_DRAW_LINE].state & DRIVER_ENABLED )
+   pset = _UG_ClipPSet(x1,y1,x2,y2);
+   if ( pset == NULL ) return;
+
+   /* Is hardware acceleration available? Only for lines that need no clipping */
+   if ( (pset == gui->pset) && (gui->driver[DRIVER_DRAW_LINE].state & DRIVER_ENABLED) )
    {
       if( ((UG_RESULT(*)(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c))gui->driver[DRIVER_DRAW_LINE].driver)(x1,y1,x2,y2,c) == UG_RESULT_OK ) return;
    }
@@ -4720,7 +6755,7 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
    drawx = x1;
    drawy = y1;
 
-   gui->pset(drawx, drawy,c);
+   pset(drawx, drawy,c);
 
    if( dxabs >= dyabs )
    {
@@ -4733,7 +6768,7 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
             drawy += sgndy;
          }
          drawx += sgndx;
-         gui->pset(drawx, drawy,c);
+         pset(drawx, drawy,c);
       }
    }
    else
@@ -4747,15 +6782,17 @@ void UG_DrawLine( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c )
             drawx += sgndx;
          }
          drawy += sgndy;
-         gui->pset(drawx, drawy,c);
+         pset(drawx, drawy,c);
       }
    }
 }
 
 void UG_PutString( UG_S16 x, UG_S16 y, char* str )
 {
-   UG_S16 xp,yp;
+   UG_S16 xp,yp,cw;
    char chr;
+   UG_U8 last=0;
+   const UG_GLYPH* g;
 
    xp=x;
    yp=y;
@@ -4770,27 +6807,106 @@ void UG_PutString( UG_S16 x, UG_S16 y, char* str )
          continue;
       }
 
-      if ( xp+gui->font.char_width > gui->x_dim - 1 )
+      cw = gui->font.char_width;
+      if ( gui->font.prop != NULL )
+      {
+         g = _UG_PropGlyph(gui->font.prop, (UG_U8)chr);
+         cw = ( g != NULL ) ? g->advance : 0;
+         xp += _UG_PropKerning(gui->font.prop, last, (UG_U8)chr);
+         last = (UG_U8)chr;
+      }
+
+      if ( xp+cw > gui->x_dim - 1 )
       {
          xp = x;
          yp += gui->font.char_height+gui->font.char_v_space;
+         last = 0;
       }
 
       UG_PutChar(chr, xp, yp, gui->fore_color, gui->back_color);
 
-      xp += gui->font.char_width+gui->font.char_h_space;
+      xp += cw+gui->font.char_h_space;
       str++;
    }
 }
 
-void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
+/* Glyph of a proportional font, NULL if the font has none for the code */
+const UG_GLYPH* _UG_PropGlyph( const UG_FONT_PROP* prop, UG_U8 bt )
 {
-   UG_U16 i,j,k,xo,yo,c,bn;
-   UG_U8 b,bt;
-   unsigned char* p;
+   if ( (bt < prop->first) || (bt > prop->last) ) return NULL;
+   return &prop->glyph[bt - prop->first];
+}
 
-   bt = (UG_U8)chr;
+/* Pen adjustment between two codes, a binary search of the pair table */
+UG_S16 _UG_PropKerning( const UG_FONT_PROP* prop, UG_U8 left, UG_U8 right )
+{
+   UG_S16 lo,hi,mid;
+   UG_U16 key,k;
+
+   if ( prop->kern == NULL ) return 0;
+
+   key = ((UG_U16)left << 8) | right;
+   lo = 0;
+   hi = prop->kern_cnt - 1;
+   while ( lo <= hi )
+   {
+      mid = (lo + hi) >> 1;
+      k = ((UG_U16)prop->kern[mid].left << 8) | prop->kern[mid].right;
+      if ( k == key ) return prop->kern[mid].adjust;
+      if ( k < key ) lo = mid + 1;
+      else hi = mid - 1;
+   }
+   return 0;
+}
+
+/* Width of one line (up to '\n' or the end) in a proportional font */
+UG_S16 _UG_PropWidth( const UG_FONT_PROP* prop, const char* str, UG_S16 h_space )
+{
+   const UG_GLYPH* g;
+   UG_S16 w = -h_space;
+   UG_U8 bt,last=0;
+
+   while ( (*str != 0) && (*str != '\n') )
+   {
+      bt = (UG_U8)*str++;
+      g = _UG_PropGlyph(prop, bt);
+      if ( g != NULL ) w += g->advance;
+      w += _UG_PropKerning(prop, last, bt) + h_space;
+      last = bt;
+   }
+   return w;
+}
+
+/* Draws the bounding box of one proportional glyph, the rest of the cell
+   keeps its pixels. Returns the advance. */
+UG_S16 _UG_PutPropChar( const UG_FONT_PROP* prop, UG_U8 bt, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
+{
+   const UG_GLYPH* g = _UG_PropGlyph(prop, bt);
+
+   if ( g == NULL ) return 0;
+   if ( g->width && g->height )
+   {
+      _UG_PutGlyph(&prop->bitmap[g->offset], x + g->x_ofs, y + g->y_ofs, g->width, g->height, fc, bc);
+   }
+   return g->advance;
+}
+
+const UG_GLYPH* UG_FontGetGlyph( const UG_FONT* font, UG_U8 chr )
+{
+   if ( font->prop == NULL ) return NULL;
+   return _UG_PropGlyph(font->prop, chr);
+}
+
+UG_S16 UG_FontGetKerning( const UG_FONT* font, UG_U8 left, UG_U8 right )
+{
+   if ( font->prop == NULL ) return 0;
+   return _UG_PropKerning(font->prop, left, right);
+}
 
+/* Maps the Latin-1 umlauts and symbols onto their code page 437 glyphs. Only
+   called for codes from 0xB0 on, plain ASCII never gets here. */
+UG_U8 _UG_RemapChar( UG_U8 bt )
+{
    switch ( bt )
    {
       case 0xF6: bt = 0x94; break; // 
@@ -4802,8 +6918,33 @@ void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
       case 0xB5: bt = 0xE6; break; // 
       case 0xB0: bt = 0xF8; break; // 
    }
+   return bt;
+}
+
+void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
+{
+   UG_U16 bn;
+   UG_U8 bt;
+   unsigned char* p;
+
+   bt = (UG_U8)chr;
+
+   if ( gui->font.prop != NULL )
+   {
+      _UG_PutPropChar(gui->font.prop, bt, x, y, fc, bc);
+      return;
+   }
+
+   /* Sparse fonts map the code straight to their glyph number */
+   if ( gui->font.LUT != NULL ) bt = gui->font.LUT[bt];
+   else if ( bt >= 0xB0 ) bt = _UG_RemapChar(bt);
+
+   if ( gui->font.rle != NULL )
+   {
+      _UG_PutRleGlyph(gui->font.rle, bt, x, y, gui->font.char_width, gui->font.char_height, fc, bc);
+      return;
+   }
 
-   yo = y;
    bn = gui->font.char_width;
    if ( !bn ) return;
    bn >>= 3;
@@ -4811,29 +6952,96 @@ void UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc )
    p = gui->font.p;
    p+= bt * gui->font.char_height * bn;
 
-   for( j=0;j<gui->font.char_height;j++ )
+   _UG_PutGlyph(p, x, y, gui->font.char_width, gui->font.char_height, fc, bc);
+}
+
+/* Draws one font bitmap. The rows and columns outside the clip rectangle are
+   cut off before the loops, so no pixel is tested on its own. */
+void _UG_PutGlyph( const unsigned char* p, UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, UG_COLOR fc, UG_COLOR bc )
+{
+   UG_S16 i,j,i0,i1,j0,j1,bn;
+   UG_AREA* clip = &gui->clip[gui->clip_depth];
+
+   j0 = ( y < clip->ys ) ? clip->ys - y : 0;
+   j1 = ( y + h - 1 > clip->ye ) ? clip->ye - y : h - 1;
+   i0 = ( x < clip->xs ) ? clip->xs - x : 0;
+   i1 = ( x + w - 1 > clip->xe ) ? clip->xe - x : w - 1;
+   if ( (j0 > j1) || (i0 > i1) ) return;
+
+   /* Is hardware acceleration available? Only for glyphs that need no clipping */
+   if ( (j0 == 0) && (i0 == 0) && (j1 == h - 1) && (i1 == w - 1) && (gui->driver[DRIVER_PUT_CHAR].state & DRIVER_ENABLED) )
+   {
+      if( ((UG_RESULT(*)(const unsigned char* p, UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, UG_COLOR fc, UG_COLOR bc))gui->driver[DRIVER_PUT_CHAR].driver)(p,x,y,w,h,fc,bc) == UG_RESULT_OK ) return;
+   }
+
+   bn = (w + 7) >> 3;
+   p += j0 * bn;
+   for( j=j0;j<=j1;j++ )
    {
-      xo = x;
-      c=gui->font.char_width;
-      for( i=0;i<bn;i++ )
+      for( i=i0;i<=i1;i++ )
       {
-         b = *p++;
-         for( k=0;(k<8) && c;k++ )
+         if( p[i>>3] & (1<<(i&7)) )
          {
-            if( b & 0x01 )
-            {
-               gui->pset(xo,yo,fc);
-            }
-            else
-            {
-               gui->pset(xo,yo,bc);
-            }
-            b >>= 1;
-            xo++;
-            c--;
+            gui->pset(x+i,y+j,fc);
+         }
+         else
+         {
+            gui->pset(x+i,y+j,bc);
          }
       }
-      yo++;
+      p += bn;
+   }
+}
+
+/* Draws glyph n of a run length coded font. Each run is cut at the column
+   ends and goes out as a one pixel wide UG_FillFrame(), so with the fill
+   driver the runs are decoded straight into the display memory. */
+void _UG_PutRleGlyph( const UG_FONT_RLE* rle, UG_U16 n, UG_S16 x, UG_S16 y, UG_S16 w, UG_S16 h, UG_COLOR fc, UG_COLOR bc )
+{
+   const UG_U8* s = &rle->data[rle->offset[n]];
+   const UG_U8* end = &rle->data[rle->offset[n+1]];
+   UG_AREA* clip = &gui->clip[gui->clip_depth];
+   UG_U32 bits=0;
+   UG_U8 have=0,size=rle->bits_bg,fg=0;
+   UG_U16 run;
+   UG_S16 col=0,row=0,k;
+
+   if ( (x > clip->xe) || (y > clip->ye) || (x + w <= clip->xs) || (y + h <= clip->ys) ) return;
+
+   while ( col < w )
+   {
+      while ( (have < size) && (s < end) )
+      {
+         bits |= (UG_U32)*s++ << have;
+         have += 8;
+      }
+      if ( have < size )
+      {
+         /* End of the data, the rest of the glyph is background */
+         fg = 0;
+         run = (w - col) * h - row;
+      }
+      else
+      {
+         run = bits & ((1 << size) - 1);
+         bits >>= size;
+         have -= size;
+      }
+      while ( run && (col < w) )
+      {
+         k = h - row;
+         if ( k > run ) k = run;
+         UG_FillFrame(x+col, y+row, x+col, y+row+k-1, fg ? fc : bc);
+         run -= k;
+         row += k;
+         if ( row == h )
+         {
+            row = 0;
+            col++;
+         }
+      }
+      fg ^= 1;
+      size = fg ? rle->bits_fg : rle->bits_bg;
    }
 }
 
@@ -4918,6 +7126,193 @@ void UG_FontSetVSpace( UG_U16 s )
    gui->font.char_v_space = s;
 }
 
+/* Narrows drawing to the intersection of the given and the current clip
+   rectangle until the matching UG_ClipPop() */
+UG_RESULT UG_ClipPush( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   UG_AREA* cur;
+   UG_AREA* next;
+   UG_S16 n;
+
+   if ( gui->clip_depth >= UG_CLIP_DEPTH ) return UG_RESULT_FAIL;
+
+   if ( xe < xs ) { n = xs; xs = xe; xe = n; }
+   if ( ye < ys ) { n = ys; ys = ye; ye = n; }
+
+   cur = &gui->clip[gui->clip_depth];
+   next = cur + 1;
+   next->xs = ( xs > cur->xs ) ? xs : cur->xs;
+   next->ys = ( ys > cur->ys ) ? ys : cur->ys;
+   next->xe = ( xe < cur->xe ) ? xe : cur->xe;
+   next->ye = ( ye < cur->ye ) ? ye : cur->ye;
+   /* An empty intersection stays empty (xs > xe), everything is rejected */
+   gui->clip_depth++;
+   return UG_RESULT_OK;
+}
+
+UG_RESULT UG_ClipPop( void )
+{
+   if ( gui->clip_depth == 0 ) return UG_RESULT_FAIL;
+   gui->clip_depth--;
+   return UG_RESULT_OK;
+}
+
+void UG_ClipGetArea( UG_AREA* a )
+{
+   *a = gui->clip[gui->clip_depth];
+}
+
+/* Marks an area of the active window to be repainted by the next UG_Update().
+   It is merged with every dirty rectangle it overlaps or touches. When the
+   list is full, the rectangle that grows least takes it in. */
+void UG_Invalidate( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   UG_AREA* d;
+   UG_U8 i,best;
+   UG_S32 cost,best_cost;
+   UG_S16 n;
+
+   if ( xe < xs ) { n = xs; xs = xe; xe = n; }
+   if ( ye < ys ) { n = ys; ys = ye; ye = n; }
+   if ( xs < 0 ) xs = 0;
+   if ( ys < 0 ) ys = 0;
+   if ( xe >= gui->x_dim ) xe = gui->x_dim - 1;
+   if ( ye >= gui->y_dim ) ye = gui->y_dim - 1;
+   if ( (xs > xe) || (ys > ye) ) return;
+
+   /* The union may in turn touch rectangles already checked, start over */
+   i = 0;
+   while ( i < gui->dirty_cnt )
+   {
+      d = &gui->dirty[i];
+      if ( (xs <= d->xe+1) && (xe+1 >= d->xs) && (ys <= d->ye+1) && (ye+1 >= d->ys) )
+      {
+         if ( d->xs < xs ) xs = d->xs;
+         if ( d->ys < ys ) ys = d->ys;
+         if ( d->xe > xe ) xe = d->xe;
+         if ( d->ye > ye ) ye = d->ye;
+         *d = gui->dirty[--gui->dirty_cnt];
+         i = 0;
+         continue;
+      }
+      i++;
+   }
+
+   if ( gui->dirty_cnt >= UG_DIRTY_RECTS )
+   {
+      best = 0;
+      best_cost = 0x7FFFFFFF;
+      for(i=0; i<gui->dirty_cnt; i++)
+      {
+         d = &gui->dirty[i];
+         cost = (UG_S32)(((d->xe > xe) ? d->xe : xe) - ((d->xs < xs) ? d->xs : xs) + 1)
+              * (((d->ye > ye) ? d->ye : ye) - ((d->ys < ys) ? d->ys : ys) + 1)
+              - (UG_S32)(d->xe - d->xs + 1) * (d->ye - d->ys + 1);
+         if ( cost < best_cost )
+         {
+            best_cost = cost;
+            best = i;
+         }
+      }
+      d = &gui->dirty[best];
+      if ( d->xs < xs ) xs = d->xs;
+      if ( d->ys < ys ) ys = d->ys;
+      if ( d->xe > xe ) xe = d->xe;
+      if ( d->ye > ye ) ye = d->ye;
+      *d = gui->dirty[--gui->dirty_cnt];
+      /* The list is one shorter now, this ends after UG_DIRTY_RECTS calls */
+      UG_Invalidate( xs, ys, xe, ye );
+      return;
+   }
+
+   d = &gui->dirty[gui->dirty_cnt++];
+   d->xs = xs;
+   d->ys = ys;
+   d->xe = xe;
+   d->ye = ye;
+}
+
+/* Flags an object for a full redraw and invalidates its rectangle. Objects of
+   a window that is not shown are drawn with the whole window later on. */
+void _UG_ObjectInvalidate( UG_WINDOW* wnd, UG_OBJECT* obj )
+{
+   UG_AREA a;
+
+   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+
+   if ( (wnd != gui->active_window) || !(wnd->state & WND_STATE_VISIBLE) ) return;
+   if ( wnd->state & WND_STATE_UPDATE ) return;
+
+   UG_WindowGetArea(wnd,&a);
+   UG_Invalidate( obj->a_rel.xs + a.xs, obj->a_rel.ys + a.ys, obj->a_rel.xe + a.xs, obj->a_rel.ye + a.ys );
+}
+
+/* Repaints the dirty rectangles of a window: the background first, then every
+   visible object that intersects them, each clipped to the rectangle */
+void _UG_RedrawDirty( UG_WINDOW* wnd )
+{
+   UG_U16 i,n,objcnt;
+   UG_OBJECT* obj;
+   UG_AREA a,r;
+   UG_RESULT clipped;
+
+   UG_WindowGetArea(wnd,&a);
+   objcnt = wnd->objcnt;
+
+   /* Objects flagged without _UG_ObjectInvalidate() get their rectangle added
+      here, otherwise a dirty rectangle that only clips them would clear the
+      flag with part of the object left unpainted */
+   for(i=0; i<objcnt; i++)
+   {
+      obj = (UG_OBJECT*)&wnd->objlst[i];
+      if ( (obj->state & OBJ_STATE_FREE) || !(obj->state & OBJ_STATE_VALID) || !(obj->state & OBJ_STATE_UPDATE) ) continue;
+      UG_Invalidate( obj->a_rel.xs + a.xs, obj->a_rel.ys + a.ys, obj->a_rel.xe + a.xs, obj->a_rel.ye + a.ys );
+   }
+
+   if ( gui->dirty_cnt == 0 ) return;
+
+   for(n=0; n<gui->dirty_cnt; n++)
+   {
+      r = gui->dirty[n];
+      if ( r.xs < a.xs ) r.xs = a.xs;
+      if ( r.ys < a.ys ) r.ys = a.ys;
+      if ( r.xe > a.xe ) r.xe = a.xe;
+      if ( r.ye > a.ye ) r.ye = a.ye;
+      if ( (r.xs > r.xe) || (r.ys > r.ye) ) continue;
+
+      clipped = UG_ClipPush(r.xs,r.ys,r.xe,r.ye);
+      UG_FillFrame(r.xs,r.ys,r.xe,r.ye,wnd->bc);
+      for(i=0; i<objcnt; i++)
+      {
+         obj = (UG_OBJECT*)&wnd->objlst[i];
+         if ( (obj->state & OBJ_STATE_FREE) || !(obj->state & OBJ_STATE_VALID) || !(obj->state & OBJ_STATE_VISIBLE) ) continue;
+         if ( (obj->a_rel.xs + a.xs > r.xe) || (obj->a_rel.xe + a.xs < r.xs) ) continue;
+         if ( (obj->a_rel.ys + a.ys > r.ye) || (obj->a_rel.ye + a.ys < r.ys) ) continue;
+         obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+         obj->update(wnd,obj);
+      }
+      if ( clipped == UG_RESULT_OK ) UG_ClipPop();
+      _UG_DirtyReport(r.xs,r.ys,r.xe,r.ye);
+   }
+   gui->dirty_cnt = 0;
+
+   /* Hidden objects are covered by the background painted above */
+   for(i=0; i<objcnt; i++)
+   {
+      obj = (UG_OBJECT*)&wnd->objlst[i];
+      if ( !(obj->state & OBJ_STATE_VISIBLE) ) obj->state &= ~OBJ_STATE_UPDATE;
+   }
+}
+
+/* Hands a repainted area to the display driver, if it wants to know */
+void _UG_DirtyReport( UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye )
+{
+   if ( gui->driver[DRIVER_DIRTY_AREA].state & DRIVER_ENABLED )
+   {
+      ((void(*)(UG_S16,UG_S16,UG_S16,UG_S16))gui->driver[DRIVER_DIRTY_AREA].driver)(xs,ys,xe,ye);
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -4980,123 +7375,170 @@ const UG_COLOR pal_button_released[] =
 /* -------------------------------------------------------------------------------- */
 /* -- INTERNAL FUNCTIONS                                                         -- */
 /* -------------------------------------------------------------------------------- */
-void _UG_PutText(UG_TEXT* txt)
+/* Width of one line (up to '\n' or the end) */
+UG_S16 _UG_LineWidth( const UG_FONT* font, const char* str, UG_S16 h_space )
 {
-   UG_U16 sl,rc;
-   UG_S16 xp,yp;
-   UG_S16 xs=txt->a.xs;
-   UG_S16 ys=txt->a.ys;
-   UG_S16 xe=txt->a.xe;
-   UG_S16 ye=txt->a.ye;
-   UG_U8  align=txt->align;
-   UG_S16 char_width=txt->font->char_width;
-   UG_S16 char_height=txt->font->char_height;
-   UG_S16 char_h_space=txt->h_space;
-   UG_S16 char_v_space=txt->v_space;
-   UG_U16 i,j,k,xo,yo,cw,bn;
-   UG_U8  b,bt;
-
-   unsigned char* p;
+   UG_S16 sl=0;
 
-   char* str = txt->str;
-   char* c = str;
+   if ( font->prop != NULL ) return _UG_PropWidth(font->prop, str, h_space);
+   while ( (str[sl] != 0) && (str[sl] != '\n') ) sl++;
+   return font->char_width*sl + h_space*(sl-1);
+}
 
-   if ( txt->font->p == NULL ) return;
-   if ( str == NULL ) return;
-   if ( (ye - ys) < txt->font->char_height ) return;
+/* Lays out up to UG_TEXT_LINES lines of txt, starting at char 'first'. The
+   vertical origin is only worked out for the first line of the text. */
+void _UG_TextLayout( UG_TEXT* txt, UG_TEXT_LAYOUT* l, UG_U16 first )
+{
+   UG_S16 xp,yp,rc;
+   UG_U8  align=txt->align;
+   char* str=txt->str+first;
+   char* c;
 
-   rc=1;
-   c=str;
-   while ( *c != 0 )
-   {
-      if ( *c == '\n' ) rc++;
-      c++;
-   }
+   l->valid = 1;
+   l->lines = 0;
+   l->next = 0;
+   l->w = txt->a.xe - txt->a.xs + 1;
+   l->h = txt->a.ye - txt->a.ys + 1;
 
-   yp = 0;
-   if ( align & (ALIGN_V_CENTER | ALIGN_V_BOTTOM) )
+   if ( first == 0 )
    {
-      yp = ye - ys + 1;
-      yp -= char_height*rc;
-      yp -= char_v_space*(rc-1);
-      if ( yp < 0 ) return;
-   }
-   if ( align & ALIGN_V_CENTER ) yp >>= 1;
-   yp += ys;
+      rc=1;
+      for ( c=str; *c != 0; c++ )
+      {
+         if ( *c == '\n' ) rc++;
+      }
 
-   while( 1 )
-   {
-      sl=0;
-      c=str;
-      while( (*c != 0) && (*c != '\n') )
+      yp = 0;
+      if ( align & (ALIGN_V_CENTER | ALIGN_V_BOTTOM) )
       {
-         c++;
-         sl++;
+         yp = l->h;
+         yp -= txt->font->char_height*rc;
+         yp -= txt->v_space*(rc-1);
+         if ( yp < 0 ) return;
       }
+      if ( align & ALIGN_V_CENTER ) yp >>= 1;
+      l->y = yp;
+   }
 
-      xp = xe - xs + 1;
-      xp -= char_width*sl;
-      xp -= char_h_space*(sl-1);
+   while ( l->lines < UG_TEXT_LINES )
+   {
+      l->start[l->lines] = str - txt->str;
+      l->width[l->lines] = _UG_LineWidth(txt->font, str, txt->h_space);
+      xp = l->w - l->width[l->lines];
+      /* Nothing from a line that does not fit on */
       if ( xp < 0 ) return;
 
       if ( align & ALIGN_H_LEFT ) xp = 0;
       else if ( align & ALIGN_H_CENTER ) xp >>= 1;
-      xp += xs;
+      l->x[l->lines++] = xp;
+
+      while( (*str != 0) && (*str != '\n') ) str++;
+      if ( *str == 0 ) return;
+      str++;
+   }
+   l->next = str - txt->str;
+}
+
+/* Size of the box str takes in font: its widest line by all lines */
+void UG_MeasureText( const UG_FONT* font, const char* str, UG_S16 h_space, UG_S16 v_space, UG_S16* w, UG_S16* h )
+{
+   UG_S16 lw;
+
+   *w = 0;
+   *h = font->char_height;
+   while ( 1 )
+   {
+      lw = _UG_LineWidth(font, str, h_space);
+      if ( lw > *w ) *w = lw;
+      while( (*str != 0) && (*str != '\n') ) str++;
+      if ( *str == 0 ) return;
+      str++;
+      *h += font->char_height + v_space;
+   }
+}
+
+/* Draws one line of txt, up to '\n' or the end */
+void _UG_PutTextLine( UG_TEXT* txt, char* str, UG_S16 xp, UG_S16 yp )
+{
+   UG_S16 char_width=txt->font->char_width;
+   UG_S16 char_height=txt->font->char_height;
+   UG_S16 char_h_space=txt->h_space;
+   UG_U16 bn;
+   UG_U8  bt,last=0;
+   const UG_FONT_PROP* prop=txt->font->prop;
+   unsigned char* p;
 
-      while( (*str != '\n') )
+   while( (*str != 0) && (*str != '\n') )
+   {
+      /*----------------------------------*/
+      /* Draw one char                    */
+      /*----------------------------------*/
+      bt = (UG_U8)*str;
+      if ( prop != NULL )
       {
-         if ( *str == 0 ) return;
-         /*----------------------------------*/
-         /* Draw one char                    */
-         /*----------------------------------*/
-         bt = (UG_U8)*str;
-         switch ( bt )
-         {
-            case 0xF6: bt = 0x94; break; // 
-            case 0xD6: bt = 0x99; break; // 
-            case 0xFC: bt = 0x81; break; // 
-            case 0xDC: bt = 0x9A; break; // 
-            case 0xE4: bt = 0x84; break; // 
-            case 0xC4: bt = 0x8E; break; // 
-            case 0xB5: bt = 0xE6; break; // 
-            case 0xB0: bt = 0xF8; break; // 
-         }
-         yo = yp;
-         bn = char_width;
-         bn >>= 3;
-         if ( char_width % 8 ) bn++;
-         p = txt->font->p;
-         p+= bt * char_height * bn;
-         for( j=0;j<char_height;j++ )
-         {
-            xo = xp;
-            cw=char_width;
-            for( i=0;i<bn;i++ )
-            {
-               b = *p++;
-               for( k=0;(k<8) && cw;k++ )
-               {
-                  if( b & 0x01 )
-                  {
-                     gui->pset(xo,yo,txt->fc);
-                  }
-                  else
-                  {
-                     gui->pset(xo,yo,txt->bc);
-                  }
-                  b >>= 1;
-                  xo++;
-                  cw--;
-               }
-            }
-            yo++;
-         }
-         /*----------------------------------*/
+         xp += _UG_PropKerning(prop, last, bt);
+         xp += _UG_PutPropChar(prop, bt, xp, yp, txt->fc, txt->bc) + char_h_space;
+         last = bt;
+         str++;
+         continue;
+      }
+      if ( txt->font->LUT != NULL ) bt = txt->font->LUT[bt];
+      else if ( bt >= 0xB0 ) bt = _UG_RemapChar(bt);
+      if ( txt->font->rle != NULL )
+      {
+         _UG_PutRleGlyph(txt->font->rle, bt, xp, yp, char_width, char_height, txt->fc, txt->bc);
          xp += char_width + char_h_space;
          str++;
+         continue;
       }
+      bn = char_width;
+      bn >>= 3;
+      if ( char_width % 8 ) bn++;
+      p = txt->font->p;
+      p+= bt * char_height * bn;
+      _UG_PutGlyph(p, xp, yp, char_width, char_height, txt->fc, txt->bc);
+      /*----------------------------------*/
+      xp += char_width + char_h_space;
       str++;
-      yp += char_height + char_v_space;
+   }
+}
+
+/* Draws txt from its cached layout. The layout is only made again when it
+   was invalidated or the area changed size, an unchanged text costs no
+   scanning or alignment math. */
+void _UG_PutText(UG_TEXT* txt)
+{
+   UG_TEXT_LAYOUT tmp;
+   UG_TEXT_LAYOUT* l=txt->layout;
+   UG_S16 yp;
+   UG_U8 i;
+
+   if ( (txt->font->p == NULL) && (txt->font->rle == NULL) ) return;
+   if ( txt->str == NULL ) return;
+   if ( (txt->a.ye - txt->a.ys) < txt->font->char_height ) return;
+
+   if ( l == NULL ) l = &tmp;
+   if ( (l == &tmp) || !l->valid || (l->w != txt->a.xe - txt->a.xs + 1) || (l->h != txt->a.ye - txt->a.ys + 1) )
+   {
+      _UG_TextLayout(txt, l, 0);
+   }
+
+   yp = txt->a.ys + l->y;
+   while ( 1 )
+   {
+      for ( i=0; i<l->lines; i++ )
+      {
+         /* The remaining lines are all below the clip rectangle */
+         if ( yp > gui->clip[gui->clip_depth].ye ) return;
+
+         _UG_PutTextLine(txt, txt->str + l->start[i], txt->a.xs + l->x[i], yp);
+         yp += txt->font->char_height + txt->v_space;
+      }
+      if ( l->next == 0 ) return;
+
+      /* More lines than a layout holds, go on without caching them */
+      _UG_TextLayout(txt, &tmp, l->next);
+      l = &tmp;
    }
 }
 
@@ -5251,12 +7693,14 @@ void _UG_UpdateObjects( UG_WINDOW* wnd )
          if ( objstate & OBJ_STATE_UPDATE )
          {
             obj->update(wnd,obj);
+            _UG_DirtyReport(obj->a_abs.xs,obj->a_abs.ys,obj->a_abs.xe,obj->a_abs.ye);
          }
          if ( (objstate & OBJ_STATE_VISIBLE) && (objstate & OBJ_STATE_TOUCH_ENABLE) )
          {
             if ( (objtouch & (OBJ_TOUCH_STATE_CHANGED | OBJ_TOUCH_STATE_IS_PRESSED)) )
             {
                obj->update(wnd,obj);
+               _UG_DirtyReport(obj->a_abs.xs,obj->a_abs.ys,obj->a_abs.xe,obj->a_abs.ye);
             }
          }
       }
@@ -5352,6 +7796,7 @@ void UG_DriverDisable( UG_U8 type )
 void UG_Update( void )
 {
    UG_WINDOW* wnd;
+   UG_U8 touch;
 
    /* Is somebody waiting for this update? */
    if ( gui->state & UG_SATUS_WAIT_FOR_UPDATE ) gui->state &= ~UG_SATUS_WAIT_FOR_UPDATE;
@@ -5365,7 +7810,7 @@ void UG_Update( void )
          gui->active_window = gui->next_window;
 
          /* Do we need to draw an inactive title? */
-         if ( (gui->last_window->style & WND_STYLE_SHOW_TITLE) && (gui->last_window->state & WND_STATE_VISIBLE) )
+         if ( (gui->last_window != NULL) && (gui->last_window->style & WND_STYLE_SHOW_TITLE) && (gui->last_window->state & WND_STATE_VISIBLE) )
          {
             /* Do both windows differ in size */
             if ( (gui->last_window->xs != gui->active_window->xs) || (gui->last_window->xe != gui->active_window->xe) || (gui->last_window->ys != gui->active_window->ys) || (gui->last_window->ye != gui->active_window->ye) )
@@ -5394,9 +7839,24 @@ void UG_Update( void )
       /* Is the window visible? */
       if ( wnd->state & WND_STATE_VISIBLE )
       {
-         _UG_ProcessTouchData( wnd );
-         _UG_UpdateObjects( wnd );
-         _UG_HandleEvents( wnd );
+         /* Repaint what the setters have invalidated */
+         _UG_RedrawDirty( wnd );
+
+         /* The objects are only walked while the touch is pressed and once
+            after it was released, to deliver the release and click */
+         touch = (gui->touch.state == TOUCH_STATE_PRESSED);
+         if ( touch || (gui->state & UG_SATUS_TOUCH_ACTIVE) )
+         {
+            _UG_ProcessTouchData( wnd );
+            _UG_UpdateObjects( wnd );
+            _UG_HandleEvents( wnd );
+         }
+         if ( touch ) gui->state |= UG_SATUS_TOUCH_ACTIVE;
+         else gui->state &= ~UG_SATUS_TOUCH_ACTIVE;
+      }
+      else
+      {
+         gui->dirty_cnt = 0;
       }
    }
 }
@@ -5409,11 +7869,12 @@ void UG_WaitForUpdate( void )
 
 void UG_DrawBMP( UG_S16 xp, UG_S16 yp, const UG_BMP  * bmp )
 {
-   UG_S16 x,y,xs;
+   UG_S16 x,y,x0,x1,y0,y1;
    UG_U8 r,g,b;
    UG_U16* p;
    UG_U16 tmp;
    UG_COLOR c;
+   UG_AREA* clip = &gui->clip[gui->clip_depth];
 
    if ( bmp->p == NULL ) return;
 
@@ -5427,13 +7888,19 @@ void UG_DrawBMP( UG_S16 xp, UG_S16 yp, const UG_BMP  * bmp )
       return;
    }
 
-   xs = xp;
-   for(y=0;y<bmp->height;y++)
+   /* Trim to the clip rectangle */
+   y0 = ( yp < clip->ys ) ? clip->ys - yp : 0;
+   y1 = ( yp + bmp->height - 1 > clip->ye ) ? clip->ye - yp : bmp->height - 1;
+   x0 = ( xp < clip->xs ) ? clip->xs - xp : 0;
+   x1 = ( xp + bmp->width - 1 > clip->xe ) ? clip->xe - xp : bmp->width - 1;
+   if ( (y0 > y1) || (x0 > x1) ) return;
+
+   p += y0 * bmp->width;
+   for(y=y0;y<=y1;y++)
    {
-      xp = xs;
-      for(x=0;x<bmp->width;x++)
+      for(x=x0;x<=x1;x++)
       {
-         tmp = *p++;
+         tmp = p[x];
          /* Convert RGB565 to RGB888 */
          r = (tmp>>11)&0x1F;
          r<<=3;
@@ -5442,9 +7909,9 @@ void UG_DrawBMP( UG_S16 xp, UG_S16 yp, const UG_BMP  * bmp )
          b = (tmp)&0x1F;
          b<<=3;
          c = ((UG_COLOR)r<<16) | ((UG_COLOR)g<<8) | (UG_COLOR)b;
-         UG_DrawPixel( xp++ , yp , c );
+         gui->pset( xp + x , yp + y , c );
       }
-      yp++;
+      p += bmp->width;
    }
 }
 
@@ -6123,10 +8590,12 @@ UG_RESULT _UG_WindowDrawTitle( UG_WINDOW* wnd )
       txt.align = wnd->title.align;
       txt.h_space = wnd->title.h_space;
       txt.v_space = wnd->title.v_space;
+      txt.layout = NULL;
       _UG_PutText( &txt );
 
       /* Draw line */
       UG_DrawLine(xs,ys+wnd->title.height,xe,ys+wnd->title.height,pal_window[11]);
+      _UG_DirtyReport(xs,ys,xe,ys+wnd->title.height);
       return UG_RESULT_OK;
    }
    return UG_RESULT_FAIL;
@@ -6134,8 +8603,6 @@ UG_RESULT _UG_WindowDrawTitle( UG_WINDOW* wnd )
 
 void _UG_WindowUpdate( UG_WINDOW* wnd )
 {
-   UG_U16 i,objcnt;
-   UG_OBJECT* obj;
    UG_S16 xs,ys,xe,ye;
 
    xs = wnd->xs;
@@ -6151,6 +8618,7 @@ void _UG_WindowUpdate( UG_WINDOW* wnd )
       if ( (wnd->style & WND_STYLE_3D) && !(wnd->state & WND_STATE_REDRAW_TITLE) )
       {
          _UG_DrawObjectFrame(xs,ys,xe,ye,(UG_COLOR*)pal_window);
+         _UG_DirtyReport(xs,ys,xe,ye);
          xs+=3;
          ys+=3;
          xe-=3;
@@ -6167,20 +8635,14 @@ void _UG_WindowUpdate( UG_WINDOW* wnd )
             return;
          }
       }
-      /* Draw window area? */
-      UG_FillFrame(xs,ys,xe,ye,wnd->bc);
-
-      /* Force each object to be updated! */
-      objcnt = wnd->objcnt;
-      for(i=0; i<objcnt; i++)
-      {
-         obj = (UG_OBJECT*)&wnd->objlst[i];
-         if ( !(obj->state & OBJ_STATE_FREE) && (obj->state & OBJ_STATE_VALID) && (obj->state & OBJ_STATE_VISIBLE) ) obj->state |= (OBJ_STATE_UPDATE | OBJ_STATE_REDRAW);
-      }
+      /* The window area and every object in it are repainted from the dirty list */
+      gui->dirty_cnt = 0;
+      UG_Invalidate(xs,ys,xe,ye);
    }
    else
    {
       UG_FillFrame(wnd->xs,wnd->xs,wnd->xe,wnd->ye,gui->desktop_color);
+      _UG_DirtyReport(wnd->xs,wnd->xs,wnd->xe,wnd->ye);
    }
 }
 
@@ -6192,6 +8654,7 @@ UG_RESULT _UG_WindowClear( UG_WINDOW* wnd )
       {
          wnd->state &= ~WND_STATE_VISIBLE;
          UG_FillFrame( wnd->xs, wnd->ys, wnd->xe, wnd->ye, gui->desktop_color );
+         _UG_DirtyReport( wnd->xs, wnd->ys, wnd->xe, wnd->ye );
 
          if ( wnd != gui->active_window )
          {
@@ -6227,6 +8690,7 @@ UG_RESULT UG_ButtonCreate( UG_WINDOW* wnd, UG_BUTTON* btn, UG_U8 id, UG_S16 xs,
    btn->style = BTN_STYLE_3D;
    btn->font = NULL;
    btn->str = "-";
+   btn->layout.valid = 0;
 
    /* Initialize standard object parameters */
    obj->update = _UG_ButtonUpdate;
@@ -6264,7 +8728,7 @@ UG_RESULT UG_ButtonShow( UG_WINDOW* wnd, UG_U8 id )
    if ( obj == NULL ) return UG_RESULT_FAIL;
 
    obj->state |= OBJ_STATE_VISIBLE;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6283,7 +8747,7 @@ UG_RESULT UG_ButtonHide( UG_WINDOW* wnd, UG_U8 id )
    obj->touch_state = OBJ_TOUCH_STATE_INIT;
    obj->event = OBJ_EVENT_NONE;
    obj->state &= ~OBJ_STATE_VISIBLE;
-   obj->state |= OBJ_STATE_UPDATE;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6298,7 +8762,7 @@ UG_RESULT UG_ButtonSetForeColor( UG_WINDOW* wnd, UG_U8 id, UG_COLOR fc )
 
    btn = (UG_BUTTON*)(obj->data);
    btn->fc = fc;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6313,7 +8777,7 @@ UG_RESULT UG_ButtonSetBackColor( UG_WINDOW* wnd, UG_U8 id, UG_COLOR bc )
 
    btn = (UG_BUTTON*)(obj->data);
    btn->bc = bc;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6328,7 +8792,7 @@ UG_RESULT UG_ButtonSetAlternateForeColor( UG_WINDOW* wnd, UG_U8 id, UG_COLOR afc
 
    btn = (UG_BUTTON*)(obj->data);
    btn->afc = afc;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6343,7 +8807,7 @@ UG_RESULT UG_ButtonSetAlternateBackColor( UG_WINDOW* wnd, UG_U8 id, UG_COLOR abc
 
    btn = (UG_BUTTON*)(obj->data);
    btn->abc = abc;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6358,7 +8822,8 @@ UG_RESULT UG_ButtonSetText( UG_WINDOW* wnd, UG_U8 id, char* str )
 
    btn = (UG_BUTTON*)(obj->data);
    btn->str = str;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   btn->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6373,7 +8838,8 @@ UG_RESULT UG_ButtonSetFont( UG_WINDOW* wnd, UG_U8 id, const UG_FONT* font )
 
    btn = (UG_BUTTON*)(obj->data);
    btn->font = font;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   btn->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6413,7 +8879,7 @@ UG_RESULT UG_ButtonSetStyle( UG_WINDOW* wnd, UG_U8 id, UG_U8 style )
    {
       btn->style &= ~BTN_STYLE_3D;
    }
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6611,6 +9077,7 @@ void _UG_ButtonUpdate(UG_WINDOW* wnd, UG_OBJECT* obj)
             txt.h_space = 2;
             txt.v_space = 2;
             txt.str = btn->str;
+            txt.layout = &btn->layout;
             _UG_PutText( &txt );
             obj->state &= ~OBJ_STATE_REDRAW;
          }
@@ -6651,6 +9118,7 @@ UG_RESULT UG_TextboxCreate( UG_WINDOW* wnd, UG_TEXTBOX* txb, UG_U8 id, UG_S16 xs
    txb->align = ALIGN_CENTER;
    txb->h_space = 2;
    txb->v_space = 2;
+   txb->layout.valid = 0;
 
    /* Initialize standard object parameters */
    obj->update = _UG_TextboxUpdate;
@@ -6688,7 +9156,7 @@ UG_RESULT UG_TextboxShow( UG_WINDOW* wnd, UG_U8 id )
    if ( obj == NULL ) return UG_RESULT_FAIL;
 
    obj->state |= OBJ_STATE_VISIBLE;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6701,7 +9169,7 @@ UG_RESULT UG_TextboxHide( UG_WINDOW* wnd, UG_U8 id )
    if ( obj == NULL ) return UG_RESULT_FAIL;
 
    obj->state &= ~OBJ_STATE_VISIBLE;
-   obj->state |= OBJ_STATE_UPDATE;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6716,7 +9184,7 @@ UG_RESULT UG_TextboxSetForeColor( UG_WINDOW* wnd, UG_U8 id, UG_COLOR fc )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->fc = fc;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6731,7 +9199,7 @@ UG_RESULT UG_TextboxSetBackColor( UG_WINDOW* wnd, UG_U8 id, UG_COLOR bc )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->bc = bc;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6746,7 +9214,8 @@ UG_RESULT UG_TextboxSetText( UG_WINDOW* wnd, UG_U8 id, char* str )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->str = str;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   txb->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6761,7 +9230,8 @@ UG_RESULT UG_TextboxSetFont( UG_WINDOW* wnd, UG_U8 id, const UG_FONT* font )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->font = font;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   txb->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6776,7 +9246,8 @@ UG_RESULT UG_TextboxSetHSpace( UG_WINDOW* wnd, UG_U8 id, UG_S8 hs )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->h_space = hs;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   txb->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6791,7 +9262,8 @@ UG_RESULT UG_TextboxSetVSpace( UG_WINDOW* wnd, UG_U8 id, UG_S8 vs )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->v_space = vs;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   txb->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6806,7 +9278,8 @@ UG_RESULT UG_TextboxSetAlignment( UG_WINDOW* wnd, UG_U8 id, UG_U8 align )
 
    txb = (UG_TEXTBOX*)(obj->data);
    txb->align = align;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   txb->layout.valid = 0;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -6964,6 +9437,7 @@ void _UG_TextboxUpdate(UG_WINDOW* wnd, UG_OBJECT* obj)
             txt.h_space = txb->h_space;
             txt.v_space = txb->v_space;
             txt.str = txb->str;
+            txt.layout = &txb->layout;
             _UG_PutText( &txt );
             obj->state &= ~OBJ_STATE_REDRAW;
          }
@@ -7026,7 +9500,7 @@ UG_RESULT UG_ImageShow( UG_WINDOW* wnd, UG_U8 id )
    if ( obj == NULL ) return UG_RESULT_FAIL;
 
    obj->state |= OBJ_STATE_VISIBLE;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -7039,7 +9513,7 @@ UG_RESULT UG_ImageHide( UG_WINDOW* wnd, UG_U8 id )
    if ( obj == NULL ) return UG_RESULT_FAIL;
 
    obj->state &= ~OBJ_STATE_VISIBLE;
-   obj->state |= OBJ_STATE_UPDATE;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -7055,7 +9529,7 @@ UG_RESULT UG_ImageSetBMP( UG_WINDOW* wnd, UG_U8 id, const UG_BMP* bmp )
    img = (UG_IMAGE*)(obj->data);
    img->img = (void*)bmp;
    img->type = IMG_TYPE_BMP;
-   obj->state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+   _UG_ObjectInvalidate( wnd, obj );
 
    return UG_RESULT_OK;
 }
@@ -0,0 +1,475 @@
+/**
+  ******************************************************************************
+  * @file    alarm_test.c
+  * @author  Louis Barrett
+  * @brief   Host test of alarm.c against a model of the alarm list. Random
+  *          sets, clears and restarts are mixed with firing alarm A, with
+  *          time wrapping round the week many times. The handler clears
+  *          and sets alarms itself, and every restart reloads the list from
+  *          the data EEPROM.
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -Wno-int-to-pointer-cast -O2 -I Tests/stub -I Inc Tests/alarm_test.c Src/alarm.c -o alarm_test
+  *   ./alarm_test
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#define _DEFAULT_SOURCE
+#include "alarm.h"
+#include "rtc.h"
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#define SECONDS_PER_DAY     86400UL
+#define SECONDS_PER_WEEK    (7 * SECONDS_PER_DAY)
+#define STEPS               200000
+#define EEPROM_SIZE         4096
+
+/* The model of one slot. A one-shot alarm keeps the week time it is due. */
+typedef struct
+{
+  int used;
+  ALARM_Entry entry;
+  unsigned long due;
+} Slot;
+
+static Slot model[ALARM_MAX_ENTRIES];
+
+/* Week time the calendar stub reads, and alarm A as programmed */
+static unsigned long now = 0;
+static int armed = 0;
+static unsigned long programmed = 0;
+
+static RTC_HandleTypeDef handle;
+
+/* Slots due when alarm A fired, and the last one the handler was called for */
+static int dueAtFire[ALARM_MAX_ENTRIES];
+static int lastFired = -1;
+static unsigned long handlerCalls = 0;
+static unsigned long handlerChanges = 0;
+
+static unsigned long failures = 0;
+
+static void Check(int ok, const char *what, long value)
+{
+  if (!ok)
+  {
+    if (failures < 20)
+    {
+      printf("FAIL %s: %ld (week time %lu)\n", what, value, now);
+    }
+    failures++;
+  }
+}
+
+/* HAL and RTC stubs ---------------------------------------------------------*/
+
+RTC_HandleTypeDef* RTC_GetHandle(void)
+{
+  return &handle;
+}
+
+void RTC_ReadCalendar(RTC_TimeTypeDef *time, RTC_DateTypeDef *date)
+{
+  unsigned long dayTime = now % SECONDS_PER_DAY;
+
+  memset(time, 0, sizeof(*time));
+  memset(date, 0, sizeof(*date));
+  time->Hours = RTC_ByteToBcd2(dayTime / 3600);
+  time->Minutes = RTC_ByteToBcd2((dayTime / 60) % 60);
+  time->Seconds = RTC_ByteToBcd2(dayTime % 60);
+  date->WeekDay = (uint8_t)(now / SECONDS_PER_DAY + RTC_WEEKDAY_MONDAY);
+}
+
+HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sAlarm, uint32_t Format)
+{
+  Check(Format == RTC_FORMAT_BIN && sAlarm->Alarm == RTC_ALARM_A, "alarm format", (long)Format);
+  Check(!armed, "alarm A set twice", 0);
+  armed = 1;
+  programmed = (sAlarm->AlarmDateWeekDay - RTC_WEEKDAY_MONDAY) * SECONDS_PER_DAY
+               + sAlarm->AlarmTime.Hours * 3600UL + sAlarm->AlarmTime.Minutes * 60UL
+               + sAlarm->AlarmTime.Seconds;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc, uint32_t Alarm)
+{
+  armed = 0;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Unlock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Lock(void)
+{
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Program(uint32_t TypeProgram, uint32_t Address, uint32_t Data)
+{
+  Check(Address >= DATA_EEPROM_BASE && Address + 4 <= DATA_EEPROM_BASE + EEPROM_SIZE, "EEPROM address", (long)Address);
+  *(volatile uint32_t *)(uintptr_t)Address = Data;
+  return HAL_OK;
+}
+
+void TRACE_Event(uint8_t event, uint16_t payload)
+{
+}
+
+/* Model ---------------------------------------------------------------------*/
+
+static unsigned long DayTime(const ALARM_Entry *entry)
+{
+  return entry->hours * 3600UL + entry->minutes * 60UL + entry->seconds;
+}
+
+/* Next time a one-shot alarm set at the given week time goes off */
+static unsigned long OneShotDue(const ALARM_Entry *entry, unsigned long from)
+{
+  unsigned long day = from / SECONDS_PER_DAY;
+
+  if (DayTime(entry) <= from % SECONDS_PER_DAY)
+  {
+    day = (day + 1) % 7;
+  }
+  return day * SECONDS_PER_DAY + DayTime(entry);
+}
+
+static int ModelDueAt(int slot, unsigned long time)
+{
+  const Slot *s = &model[slot];
+
+  if (!s->used)
+  {
+    return 0;
+  }
+  if (s->entry.weekdays == ALARM_ONESHOT)
+  {
+    return s->due == time;
+  }
+  return DayTime(&s->entry) == time % SECONDS_PER_DAY
+         && (s->entry.weekdays & (1 << (time / SECONDS_PER_DAY)));
+}
+
+/* First occurrence after now, or the earliest one if that means next week.
+   Returns -1 if there are no alarms. */
+static long ModelNext(void)
+{
+  long best = -1;
+  unsigned long bestDistance = 0;
+  unsigned long time;
+  unsigned long distance;
+  int slot;
+  int day;
+
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    for (day = 0; day < 7; day++)
+    {
+      time = day * SECONDS_PER_DAY + DayTime(&model[slot].entry);
+      if (!ModelDueAt(slot, time))
+      {
+        continue;
+      }
+      /* An occurrence at now is a week away */
+      distance = (time + SECONDS_PER_WEEK - now - 1) % SECONDS_PER_WEEK;
+      if (best < 0 || distance < bestDistance)
+      {
+        best = (long)time;
+        bestDistance = distance;
+      }
+    }
+  }
+  return best;
+}
+
+/* The one-shot alarms are placed again relative to the current time */
+static void ModelReschedule(void)
+{
+  int slot;
+
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    if (model[slot].used && model[slot].entry.weekdays == ALARM_ONESHOT)
+    {
+      model[slot].due = OneShotDue(&model[slot].entry, now);
+    }
+  }
+}
+
+/* Test steps ----------------------------------------------------------------*/
+
+/* A few shared values make several alarms go off at the same time */
+static void RandomTime(uint8_t *hours, uint8_t *minutes, uint8_t *seconds)
+{
+  static const uint8_t pool[][3] = {{0, 0, 0}, {7, 30, 0}, {23, 59, 59}, {12, 0, 0}};
+
+  if (rand() % 3 == 0)
+  {
+    *hours = (uint8_t)(rand() % 24);
+    *minutes = (uint8_t)(rand() % 60);
+    *seconds = (uint8_t)(rand() % 60);
+  }
+  else
+  {
+    memcpy(hours, &pool[rand() % 4][0], 1);
+    memcpy(minutes, &pool[rand() % 4][1], 1);
+    memcpy(seconds, &pool[rand() % 4][2], 1);
+  }
+}
+
+static void Set(uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t weekdays)
+{
+  int expected = -1;
+  int slot;
+
+  if (hours < 24 && minutes < 60 && seconds < 60)
+  {
+    for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+    {
+      if (!model[slot].used)
+      {
+        expected = slot;
+        break;
+      }
+    }
+  }
+
+  slot = ALARM_Set(hours, minutes, seconds, weekdays);
+  Check(slot == expected, "ALARM_Set slot", slot);
+  if (slot < 0 || slot != expected)
+  {
+    return;
+  }
+
+  model[slot].used = 1;
+  model[slot].entry.hours = hours;
+  model[slot].entry.minutes = minutes;
+  model[slot].entry.seconds = seconds;
+  model[slot].entry.weekdays = weekdays & ALARM_EVERYDAY;
+  model[slot].due = OneShotDue(&model[slot].entry, now);
+}
+
+static void Clear(int slot)
+{
+  ALARM_Clear((uint8_t)slot);
+  model[slot].used = 0;
+}
+
+static void RandomSet(void)
+{
+  uint8_t hours;
+  uint8_t minutes;
+  uint8_t seconds;
+  uint8_t weekdays = (rand() % 4 == 0) ? ALARM_ONESHOT : (uint8_t)rand();
+
+  RandomTime(&hours, &minutes, &seconds);
+  if (rand() % 50 == 0)
+  {
+    /* Out of range, including ALARM_FREE */
+    hours = (rand() & 1) ? 24 : ALARM_FREE;
+  }
+  Set(hours, minutes, seconds, weekdays);
+}
+
+/* Every due slot that was not cleared before its turn must be reported */
+static void CheckSkipped(int upTo)
+{
+  int slot;
+
+  for (slot = lastFired + 1; slot < upTo; slot++)
+  {
+    Check(!(dueAtFire[slot] && ModelDueAt(slot, now)), "due alarm not reported", slot);
+  }
+}
+
+/* Checks the slot is still due, then often clears an alarm and sets another,
+   which takes the lowest free slot and so reuses the one just cleared when
+   nothing below it is free. The new alarm is never due now. */
+static void Handler(uint8_t slot)
+{
+  uint8_t hours;
+  uint8_t minutes;
+  uint8_t seconds;
+  int victim = rand() % ALARM_MAX_ENTRIES;
+
+  handlerCalls++;
+  Check(slot > lastFired, "report order", slot);
+  Check(dueAtFire[slot] && ModelDueAt(slot, now), "reported alarm not due", slot);
+  CheckSkipped(slot);
+  lastFired = slot;
+
+  switch (rand() % 4)
+  {
+    case 0:
+      victim = slot;
+      /* fall through */
+    case 1:
+      handlerChanges++;
+      Clear(victim);
+      do
+      {
+        RandomTime(&hours, &minutes, &seconds);
+      } while (hours * 3600UL + minutes * 60UL + seconds == now % SECONDS_PER_DAY);
+      Set(hours, minutes, seconds, (rand() & 1) ? ALARM_ONESHOT : (uint8_t)rand());
+      break;
+    default:
+      break;
+  }
+
+  /* What ALARM_Run() does after the handler: a one-shot alarm that is still
+     due has gone off */
+  if (model[slot].entry.weekdays == ALARM_ONESHOT && ModelDueAt(slot, now))
+  {
+    model[slot].used = 0;
+  }
+}
+
+static void Fire(void)
+{
+  int slot;
+
+  now = programmed;
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    dueAtFire[slot] = ModelDueAt(slot, now);
+  }
+  lastFired = -1;
+
+  HAL_RTC_AlarmAEventCallback(&handle);
+  ALARM_Run();
+  CheckSkipped(ALARM_MAX_ENTRIES);
+}
+
+static void CheckState(const char *what)
+{
+  const ALARM_Entry *entry;
+  long next = ModelNext();
+  int slot;
+
+  for (slot = 0; slot < ALARM_MAX_ENTRIES; slot++)
+  {
+    entry = ALARM_Get((uint8_t)slot);
+    if (!model[slot].used)
+    {
+      Check(entry->hours == ALARM_FREE, what, slot);
+      continue;
+    }
+    Check(entry->hours == model[slot].entry.hours && entry->minutes == model[slot].entry.minutes
+          && entry->seconds == model[slot].entry.seconds && entry->weekdays == model[slot].entry.weekdays,
+          what, slot);
+  }
+
+  Check(armed == (next >= 0), "alarm A armed", armed);
+  Check(!armed || programmed == (unsigned long)next, "alarm A time", (long)programmed);
+}
+
+int main(void)
+{
+  unsigned long step;
+  unsigned long fires = 0;
+  unsigned long restarts = 0;
+  unsigned long wraps = 0;
+  unsigned long last = 0;
+  void *eeprom;
+
+  /* alarm.c addresses data EEPROM by number, so give it the real one */
+  eeprom = mmap((void *)DATA_EEPROM_BASE, EEPROM_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (eeprom != (void *)DATA_EEPROM_BASE)
+  {
+    printf("cannot map data EEPROM at 0x%08lX\n", DATA_EEPROM_BASE);
+    return 1;
+  }
+
+  srand(1);
+  ALARM_SetHandler(Handler);
+
+  /* Blank EEPROM: every slot starts free */
+  now = 3 * SECONDS_PER_DAY + 12345;
+  ALARM_Init();
+  CheckState("blank EEPROM");
+
+  for (step = 0; step < STEPS; step++)
+  {
+    switch (rand() % 16)
+    {
+      case 0:
+      case 1:
+      case 2:
+      case 3:
+      case 4:
+        RandomSet();
+        CheckState("set");
+        break;
+      case 5:
+      case 6:
+        Clear(rand() % ALARM_MAX_ENTRIES);
+        CheckState("clear");
+        break;
+      case 7:
+        /* Restart at the same time, the alarms come back from EEPROM */
+        ALARM_Init();
+        ModelReschedule();
+        CheckState("restart");
+        restarts++;
+        break;
+      case 8:
+        /* The time was set */
+        now = (unsigned long)rand() % SECONDS_PER_WEEK;
+        ALARM_Reschedule();
+        ModelReschedule();
+        CheckState("reschedule");
+        break;
+      default:
+        if (armed)
+        {
+          Fire();
+          CheckState("after firing");
+          fires++;
+        }
+        break;
+    }
+    if (now < last)
+    {
+      wraps++;
+    }
+    last = now;
+  }
+
+  printf("%lu steps, %lu firings, %lu alarms reported, %lu changed by the handler, %lu restarts, %lu week wraps, %lu failures\n",
+         (unsigned long)STEPS, fires, handlerCalls, handlerChanges, restarts, wraps, failures);
+  return failures != 0;
+}
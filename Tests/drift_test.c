@@ -0,0 +1,222 @@
+/**
+  ******************************************************************************
+  * @file    drift_test.c
+  * @author  Louis Barrett
+  * @brief   Host test of drift.c: simulated clocks with a known rate error,
+  *          sync jitter, outliers and clock steps, checked against the
+  *          estimate, plus the sample spacing and ring buffer rules
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -O2 -I Inc Tests/drift_test.c Src/drift.c -lm -o drift_test
+  *   ./drift_test
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "drift.h"
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* calib.c asks for 12 hours of samples */
+#define MIN_SPAN            (12UL * 3600)
+#define RUNS                2000
+/* Hours each clock runs for */
+#define SIM_HOURS           48
+/* Sync jitter is up to JITTER_MS either way, outliers are off by up to
+   OUTLIER_MS */
+#define JITTER_MS           10
+#define OUTLIER_RATE        8
+#define OUTLIER_MS          900
+/* Bad samples among the ones used. A third one can already move the median
+   of the long pairs by several ppm. */
+#define OUTLIERS            2
+/* The estimate must be this close to the true rate, in ppb */
+#define TOLERANCE_PPB       1000
+
+static DRIFT_Estimator est;
+static unsigned long failures = 0;
+
+static void Check(int ok, const char *what, long value)
+{
+  if (!ok && failures++ < 20)
+  {
+    printf("FAIL %s: %ld\n", what, value);
+  }
+}
+
+static long Uniform(long low, long high)
+{
+  return low + rand() % (high - low + 1);
+}
+
+/**
+  * @brief  Runs one simulated clock from start for two days, offering a
+  *         sync every minute the way the GPS does, with the clock stepped
+  *         to the reference now and then. The samples kept are the ones on
+  *         the hour, the last DRIFT_MAX_SAMPLES of them are used.
+  * @param  outliers : how many of the samples used are off by up to
+  *         OUTLIER_MS, one offered sync in OUTLIER_RATE is as well
+  * @retval Estimate minus the true rate in ppb, or LONG_MAX if none was made
+  */
+static long Simulate(uint32_t start, long ppb, int outliers, int steps)
+{
+  uint32_t t;
+  uint32_t bad = 0;
+  uint32_t elapsed;
+  double phase = (double)Uniform(-5000, 5000);
+  long offset;
+  int32_t estimate;
+  int hour;
+
+  while (outliers-- > 0)
+  {
+    do
+    {
+      hour = SIM_HOURS - (int)Uniform(1, DRIFT_MAX_SAMPLES);
+    } while (bad & (1UL << (hour - (SIM_HOURS - DRIFT_MAX_SAMPLES))));
+    bad |= 1UL << (hour - (SIM_HOURS - DRIFT_MAX_SAMPLES));
+  }
+
+  DRIFT_Init(&est);
+  for (elapsed = 0; elapsed < SIM_HOURS * 3600UL; elapsed += 60)
+  {
+    t = start + elapsed;
+    offset = lround(phase) + Uniform(-JITTER_MS, JITTER_MS);
+    hour = (int)(elapsed / 3600) - (SIM_HOURS - DRIFT_MAX_SAMPLES);
+    if (elapsed % 3600 != 0)
+    {
+      if (rand() % OUTLIER_RATE == 0)
+      {
+        offset += Uniform(-OUTLIER_MS, OUTLIER_MS);
+      }
+    }
+    else if (hour >= 0 && (bad & (1UL << hour)))
+    {
+      offset += (rand() & 1) ? Uniform(OUTLIER_MS / 2, OUTLIER_MS) : -Uniform(OUTLIER_MS / 2, OUTLIER_MS);
+    }
+
+    Check(DRIFT_AddSample(&est, t, (int32_t)offset) == (elapsed % 3600 == 0), "sample spacing", (long)elapsed);
+    if (elapsed % 3600 == 0 && steps && rand() % 4 == 0)
+    {
+      /* Set to the reference as read, jitter and all */
+      DRIFT_Step(&est, (int32_t)-offset);
+      phase -= offset;
+    }
+    /* ms per s is 10^6 ppb */
+    phase += (double)ppb * 60 / 1e6;
+  }
+
+  if (!DRIFT_Estimate(&est, MIN_SPAN, &estimate))
+  {
+    return LONG_MAX;
+  }
+  return estimate - ppb;
+}
+
+/* The sample rules, independent of the estimate */
+static void CheckSpacing(void)
+{
+  int32_t ppb;
+  uint32_t t;
+  int i;
+
+  DRIFT_Init(&est);
+  Check(!DRIFT_Estimate(&est, 0, &ppb), "estimate from no samples", 0);
+  Check(DRIFT_AddSample(&est, 1000, 0), "first sample", 1000);
+  Check(!DRIFT_Estimate(&est, 0, &ppb), "estimate from one sample", 1);
+  Check(!DRIFT_AddSample(&est, 1000 + DRIFT_MIN_SPACING - 1, 0), "sample too close", DRIFT_MIN_SPACING - 1);
+  Check(!DRIFT_AddSample(&est, 1000, 0), "sample at the same time", 0);
+  Check(!DRIFT_AddSample(&est, 999, 0), "sample before the last", -1);
+  Check(!DRIFT_AddSample(&est, 1000 - 2 * DRIFT_MIN_SPACING, 0), "sample well before the last", -2 * DRIFT_MIN_SPACING);
+  Check(DRIFT_AddSample(&est, 1000 + DRIFT_MIN_SPACING, DRIFT_MIN_SPACING / 100), "sample at the spacing", DRIFT_MIN_SPACING);
+  Check(DRIFT_Estimate(&est, 0, &ppb) && ppb == 10000, "two point slope", ppb);
+  Check(!DRIFT_Estimate(&est, DRIFT_MIN_SPACING + 1, &ppb), "estimate below the span", ppb);
+
+  /* The reference time may wrap round */
+  DRIFT_Init(&est);
+  t = 0xFFFFFFFFUL - 2 * DRIFT_MIN_SPACING;
+  for (i = 0; i < 5; i++, t += DRIFT_MIN_SPACING)
+  {
+    Check(DRIFT_AddSample(&est, t, i * (DRIFT_MIN_SPACING / 10)), "sample across the wrap", i);
+  }
+  Check(DRIFT_Estimate(&est, 0, &ppb) && ppb == 100000, "slope across the wrap", ppb);
+
+  /* The ring keeps the newest samples, the old rate is forgotten */
+  DRIFT_Init(&est);
+  for (i = 0, t = 0; i < DRIFT_MAX_SAMPLES; i++, t += DRIFT_MIN_SPACING)
+  {
+    DRIFT_AddSample(&est, t, i * (DRIFT_MIN_SPACING / 10));
+  }
+  for (i = 0; i < DRIFT_MAX_SAMPLES; i++, t += DRIFT_MIN_SPACING)
+  {
+    DRIFT_AddSample(&est, t, -i * (DRIFT_MIN_SPACING / 100));
+  }
+  Check(est.count == DRIFT_MAX_SAMPLES, "ring count", est.count);
+  Check(DRIFT_Estimate(&est, 0, &ppb) && ppb == -10000, "rate after the ring wrapped", ppb);
+
+  /* A restart keeps only the newest sample */
+  DRIFT_Restart(&est);
+  Check(est.count == 1, "count after restart", est.count);
+  Check(!DRIFT_Estimate(&est, 0, &ppb), "estimate after restart", 0);
+  Check(!DRIFT_AddSample(&est, t - 1, 0), "spacing after restart", 0);
+  Check(DRIFT_AddSample(&est, t, 0), "sample after restart", 0);
+}
+
+int main(void)
+{
+  static const char *names[] = {"clean", "outliers", "steps", "outliers and steps"};
+  long worst[4] = {0};
+  long error;
+  long ppb;
+  int kind;
+  int run;
+
+  CheckSpacing();
+
+  srand(1);
+  for (kind = 0; kind < 4; kind++)
+  {
+    for (run = 0; run < RUNS; run++)
+    {
+      /* A crystal within 100 ppm, starting anywhere including near the wrap */
+      ppb = Uniform(-100000, 100000);
+      error = Simulate((uint32_t)rand() * 2654435761UL, ppb, (kind & 1) ? OUTLIERS : 0, kind & 2);
+      Check(labs(error) <= TOLERANCE_PPB, names[kind], error);
+      if (labs(error) > worst[kind])
+      {
+        worst[kind] = labs(error);
+      }
+    }
+    printf("%-20s worst error %5ld ppb over %d clocks\n", names[kind], worst[kind], RUNS);
+  }
+
+  printf("%lu failures\n", failures);
+  return failures != 0;
+}
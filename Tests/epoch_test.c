@@ -0,0 +1,174 @@
+/**
+  ******************************************************************************
+  * @file    epoch_test.c
+  * @author  Louis Barrett
+  * @brief   Host test of epoch.c against the C library calendar
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -O2 -I Inc Tests/epoch_test.c Src/epoch.c -o epoch_test
+  *   ./epoch_test
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#define _DEFAULT_SOURCE
+#include "epoch.h"
+#include <stdio.h>
+#include <time.h>
+
+/* 2000-01-01 00:00:00 in Unix time */
+#define UNIX_2000           946684800L
+
+static unsigned long failures = 0;
+
+static void Check(int ok, const char *what, long value)
+{
+  if (!ok && failures++ < 20)
+  {
+    printf("FAIL %s at %ld\n", what, value);
+  }
+}
+
+static uint8_t Bcd(int value)
+{
+  return (uint8_t)(((value / 10) << 4) | (value % 10));
+}
+
+/* Both directions for one instant, against timegm() and gmtime() */
+static void CheckInstant(const struct tm *tm)
+{
+  EPOCH_Calendar calendar;
+  struct tm copy = *tm;
+  time_t utc = timegm(&copy);
+  uint32_t seconds = (uint32_t)(utc - UNIX_2000);
+  struct tm *expect = gmtime(&utc);
+
+  calendar.year = Bcd(expect->tm_year - 100);
+  calendar.month = Bcd(expect->tm_mon + 1);
+  calendar.date = Bcd(expect->tm_mday);
+  calendar.weekday = 0;
+  calendar.hours = Bcd(expect->tm_hour);
+  calendar.minutes = Bcd(expect->tm_min);
+  calendar.seconds = Bcd(expect->tm_sec);
+  Check(EPOCH_FromCalendar(&calendar) == seconds, "EPOCH_FromCalendar", (long)seconds);
+
+  EPOCH_ToCalendar(seconds, &calendar);
+  Check(calendar.year == Bcd(expect->tm_year - 100) &&
+        calendar.month == Bcd(expect->tm_mon + 1) &&
+        calendar.date == Bcd(expect->tm_mday) &&
+        calendar.weekday == (expect->tm_wday == 0 ? 7 : expect->tm_wday) &&
+        calendar.hours == Bcd(expect->tm_hour) &&
+        calendar.minutes == Bcd(expect->tm_min) &&
+        calendar.seconds == Bcd(expect->tm_sec), "EPOCH_ToCalendar", (long)seconds);
+}
+
+int main(void)
+{
+  struct tm tm = {0};
+  uint32_t value;
+  uint32_t days = 0;
+  uint32_t instants = 0;
+
+  /* The reciprocal multiplies over every input they can get */
+  for (value = 0; value < 1029; value++)
+  {
+    Check(((value * 205U) >> 11) == value / 10, "205 >> 11", (long)value);
+  }
+  for (value = 0; value < 86400; value++)
+  {
+    Check(((value * 37283U) >> 27) == value / 3600, "37283 >> 27", (long)value);
+  }
+  for (value = 0; value < 3600; value++)
+  {
+    Check(((value * 2185U) >> 17) == value / 60, "2185 >> 17", (long)value);
+  }
+  for (value = 0; value < 100; value++)
+  {
+    Check(EPOCH_ToBCD((uint8_t)value) == Bcd((int)value), "EPOCH_ToBCD", (long)value);
+  }
+  /* Day 0 of the next month is the last day of this one */
+  for (value = 0; value < 100 * 12; value++)
+  {
+    struct tm last = {0};
+
+    last.tm_year = 100 + (int)(value / 12);
+    last.tm_mon = (int)(value % 12) + 1;
+    timegm(&last);
+    Check(EPOCH_MonthDays((uint8_t)(value / 12), (uint8_t)(value % 12 + 1)) == last.tm_mday,
+          "EPOCH_MonthDays", (long)value);
+  }
+
+  /* Every day from 2000 to 2099, at the first and last second and at a time
+     that moves through the day */
+  for (tm.tm_year = 100, tm.tm_mon = 0, tm.tm_mday = 1; tm.tm_year < 200; tm.tm_mday++)
+  {
+    tm.tm_hour = 0;
+    tm.tm_min = 0;
+    tm.tm_sec = 0;
+    timegm(&tm);
+    if (tm.tm_year >= 200)
+    {
+      break;
+    }
+    CheckInstant(&tm);
+    tm.tm_hour = 23;
+    tm.tm_min = 59;
+    tm.tm_sec = 59;
+    CheckInstant(&tm);
+    tm.tm_hour = days % 24;
+    tm.tm_min = (days * 7) % 60;
+    tm.tm_sec = (days * 13) % 60;
+    CheckInstant(&tm);
+    days++;
+    instants += 3;
+  }
+
+  /* Every second of a leap day and of the last day the RTC can hold */
+  for (value = 0; value < 86400; value++)
+  {
+    struct tm second = {0};
+
+    second.tm_year = 124;
+    second.tm_mon = 1;
+    second.tm_mday = 29;
+    second.tm_sec = (int)value;
+    CheckInstant(&second);
+    second.tm_year = 199;
+    second.tm_mon = 11;
+    second.tm_mday = 31;
+    second.tm_sec = (int)value;
+    CheckInstant(&second);
+    instants += 2;
+  }
+
+  printf("%lu days, %lu instants checked, %lu failures\n",
+         (unsigned long)days, (unsigned long)instants, failures);
+  return failures != 0;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
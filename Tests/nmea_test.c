@@ -0,0 +1,477 @@
+/**
+  ******************************************************************************
+  * @file    nmea_test.c
+  * @author  Louis Barrett
+  * @brief   Host fuzz test and benchmark of nmea.c
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -O2 -I Inc Tests/nmea_test.c Src/nmea.c -o nmea_test
+  *   ./nmea_test Tests/data/neo6m_rmc_zda.nmea
+  *
+  * The parser output is compared with a line based reference parser here,
+  * which follows the rules of nmea.c but works on whole sentences:
+  *  - the capture, fed in random chunk sizes as the DMA ring hands it out
+  *  - the capture with random bits flipped
+  *  - random bytes drawn mostly from the NMEA character set
+  *  - generated RMC and ZDA sentences with random, often out of range fields
+  * Every run must give exactly the fixes of the reference, in order.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#define _POSIX_C_SOURCE 199309L
+#include "nmea.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_STREAM          (1 << 20)
+#define MAX_FIXES           (1 << 16)
+/* Largest chunk handed to NMEA_Parse(), the GPS ring is 256 bytes */
+#define MAX_CHUNK           256
+#define FUZZ_RUNS           2000
+#define BENCH_BYTES         (64UL << 20)
+
+typedef struct
+{
+  NMEA_Fix fix[MAX_FIXES];
+  unsigned count;
+} FixList;
+
+static FixList expected;
+static FixList parsed;
+static uint8_t stream[MAX_STREAM];
+static unsigned long failures = 0;
+
+/* Private functions ---------------------------------------------------------*/
+
+static void Add(FixList *list, const NMEA_Fix *fix)
+{
+  if (list->count < MAX_FIXES)
+  {
+    list->fix[list->count++] = *fix;
+  }
+}
+
+static int Digits(const char *s, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    if (s[i] < '0' || s[i] > '9')
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Packs the last two of n decimal digits into BCD */
+static uint8_t Bcd(const char *s, size_t n)
+{
+  uint8_t bcd = 0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    bcd = (uint8_t)((bcd << 4) | (s[i] - '0'));
+  }
+  return bcd;
+}
+
+/* Returns field n (0 is the address) of a sentence body and its length */
+static const char* Field(const char *body, size_t length, unsigned n, size_t *size)
+{
+  const char *end = body + length;
+  const char *p = body;
+  const char *q;
+
+  while (n-- != 0)
+  {
+    p = memchr(p, ',', (size_t)(end - p));
+    if (p == NULL)
+    {
+      return NULL;
+    }
+    p++;
+  }
+  q = memchr(p, ',', (size_t)(end - p));
+  *size = (size_t)((q != NULL ? q : end) - p);
+  return p;
+}
+
+/* hhmmss[.fff...], only the first three digits of the fraction count */
+static int TimeField(const char *s, size_t n, NMEA_Fix *fix)
+{
+  size_t i;
+
+  if (n < 6 || !Digits(s, 6) || (n > 6 && (s[6] != '.' || !Digits(s + 7, n - 7))))
+  {
+    return 0;
+  }
+  fix->hours = Bcd(s, 2);
+  fix->minutes = Bcd(s + 2, 2);
+  fix->seconds = Bcd(s + 4, 2);
+  fix->ms = 0;
+  for (i = 0; i < 3; i++)
+  {
+    fix->ms = (uint16_t)(fix->ms * 10 + ((7 + i < n) ? s[7 + i] - '0' : 0));
+  }
+  return 1;
+}
+
+/* Checks one sentence body (between '$' and '*') the way nmea.c does */
+static int Reference(const char *body, size_t length, NMEA_Fix *fix)
+{
+  const char *f;
+  size_t n;
+  size_t letters;
+  int rmc;
+
+  for (letters = 0; letters < length && body[letters] != ','; letters++)
+  {
+  }
+  if (letters == length || letters < 3)
+  {
+    return 0;
+  }
+  if (memcmp(body + letters - 3, "RMC", 3) == 0)
+  {
+    rmc = 1;
+  }
+  else if (memcmp(body + letters - 3, "ZDA", 3) == 0)
+  {
+    rmc = 0;
+  }
+  else
+  {
+    return 0;
+  }
+
+  f = Field(body, length, 1, &n);
+  if (f == NULL || !TimeField(f, n, fix))
+  {
+    return 0;
+  }
+  fix->sentence = rmc ? NMEA_RMC : NMEA_ZDA;
+  if (rmc)
+  {
+    f = Field(body, length, 2, &n);
+    if (f == NULL || n != 1 || f[0] != 'A')
+    {
+      return 0;
+    }
+    f = Field(body, length, 9, &n);
+    if (f == NULL || n != 6 || !Digits(f, 6))
+    {
+      return 0;
+    }
+    fix->date = Bcd(f, 2);
+    fix->month = Bcd(f + 2, 2);
+    fix->year = Bcd(f + 4, 2);
+  }
+  else
+  {
+    f = Field(body, length, 2, &n);
+    if (f == NULL || n != 2 || !Digits(f, 2))
+    {
+      return 0;
+    }
+    fix->date = Bcd(f, 2);
+    f = Field(body, length, 3, &n);
+    if (f == NULL || n != 2 || !Digits(f, 2))
+    {
+      return 0;
+    }
+    fix->month = Bcd(f, 2);
+    f = Field(body, length, 4, &n);
+    if (f == NULL || n != 4 || !Digits(f, 4))
+    {
+      return 0;
+    }
+    fix->year = Bcd(f, 4);
+  }
+
+  return fix->hours <= 0x23 && fix->minutes <= 0x59 && fix->seconds <= 0x59 &&
+         fix->date != 0 && fix->date <= 0x31 && fix->month != 0 && fix->month <= 0x12;
+}
+
+static int Hex(uint8_t c)
+{
+  if (c >= '0' && c <= '9')
+  {
+    return c - '0';
+  }
+  return (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+}
+
+/* Finds every sentence with a good checksum in a stream. A '$' always
+   starts over, the address is up to five capitals and the rest printable. */
+static void ReferenceParse(const uint8_t *data, size_t length, FixList *list)
+{
+  size_t start;
+  size_t i;
+  uint8_t sum;
+  NMEA_Fix fix;
+
+  /* The lists are compared with memcmp(), padding included */
+  memset(&fix, 0, sizeof(fix));
+  list->count = 0;
+  for (start = 0; start < length; start++)
+  {
+    if (data[start] != '$')
+    {
+      continue;
+    }
+    sum = 0;
+    for (i = start + 1; i < length && i - start <= 5 && data[i] >= 'A' && data[i] <= 'Z'; i++)
+    {
+      sum ^= data[i];
+    }
+    if (i == length || data[i] != ',')
+    {
+      continue;
+    }
+    for (; i < length && data[i] != '*' && data[i] != '$' && data[i] >= 0x20 && data[i] <= 0x7E; i++)
+    {
+      sum ^= data[i];
+    }
+    if (i + 2 >= length || data[i] != '*' || data[i + 1] == '$' || data[i + 2] == '$' ||
+        Hex(data[i + 1]) < 0 || Hex(data[i + 2]) < 0 ||
+        ((Hex(data[i + 1]) << 4) | Hex(data[i + 2])) != sum)
+    {
+      continue;
+    }
+    if (Reference((const char *)data + start + 1, i - start - 1, &fix))
+    {
+      Add(list, &fix);
+    }
+  }
+}
+
+/* Feeds a stream to nmea.c in random chunks, like GPS_Run() does */
+static void ChunkParse(const uint8_t *data, size_t length, FixList *list)
+{
+  NMEA_Parser parser;
+  NMEA_Fix fix;
+  size_t pos = 0;
+  uint16_t chunk;
+  uint16_t used;
+
+  NMEA_Init(&parser);
+  memset(&fix, 0, sizeof(fix));
+  list->count = 0;
+  while (pos < length)
+  {
+    chunk = (uint16_t)(1 + rand() % MAX_CHUNK);
+    if (chunk > length - pos)
+    {
+      chunk = (uint16_t)(length - pos);
+    }
+    while (chunk != 0)
+    {
+      if (NMEA_Parse(&parser, data + pos, chunk, &used, &fix))
+      {
+        Add(list, &fix);
+      }
+      pos += used;
+      chunk -= used;
+    }
+  }
+}
+
+static void Compare(const char *what, const uint8_t *data, size_t length)
+{
+  ReferenceParse(data, length, &expected);
+  ChunkParse(data, length, &parsed);
+  if (expected.count != parsed.count ||
+      memcmp(expected.fix, parsed.fix, expected.count * sizeof(NMEA_Fix)) != 0)
+  {
+    if (failures++ < 10)
+    {
+      printf("FAIL %s: %u fixes expected, %u parsed\n", what, expected.count, parsed.count);
+    }
+  }
+}
+
+/* Inserts, deletes or replaces one character of a sentence body */
+static void Mutate(char *body)
+{
+  static const char fill[] = ",,..0123456789AGPRVZ";
+  size_t length = strlen(body);
+  size_t pos = (size_t)rand() % length;
+
+  switch (rand() % 3)
+  {
+    case 0:
+      memmove(body + pos + 1, body + pos, length - pos + 1);
+      body[pos] = fill[rand() % (sizeof(fill) - 1)];
+      break;
+    case 1:
+      memmove(body + pos, body + pos + 1, length - pos);
+      break;
+    default:
+      body[pos] = fill[rand() % (sizeof(fill) - 1)];
+      break;
+  }
+}
+
+/* One RMC or ZDA sentence with random fields, mostly well formed */
+static size_t Sentence(char *out)
+{
+  char body[128];
+  char date[16];
+  const char *status = (rand() % 8) ? "A" : "V";
+  unsigned sum = 0;
+  unsigned i;
+
+  if (rand() % 2)
+  {
+    sprintf(date, "%02d%02d%02d", rand() % 34, rand() % 14, rand() % 100);
+    sprintf(body, "G%cRMC,%02d%02d%02d.%0*d,%s,5230.1234,N,01322.5432,E,0.1,,%s,,,A",
+            "PNL"[rand() % 3], rand() % 26, rand() % 62, rand() % 62, 1 + rand() % 3, rand() % 10,
+            status, (rand() % 16) ? date : "3112");
+  }
+  else
+  {
+    sprintf(body, "GPZDA,%02d%02d%02d.%02d,%02d,%02d,%04d,00,00",
+            rand() % 26, rand() % 62, rand() % 62, rand() % 100, rand() % 34, rand() % 14, 1990 + rand() % 120);
+  }
+  /* Some get a character more, less or changed, still with a good sum */
+  if (rand() % 4 == 0)
+  {
+    Mutate(body);
+  }
+  for (i = 0; body[i] != 0; i++)
+  {
+    sum ^= (uint8_t)body[i];
+  }
+  if (rand() % 16 == 0)
+  {
+    sum ^= 1 << (rand() % 8);
+  }
+  return (size_t)sprintf(out, "$%s*%02X\r\n", body, sum);
+}
+
+static double Seconds(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+  static const char alphabet[] = "$$**,,,,..0123456789ABCDEFGNPRMZVT\r\n";
+  uint8_t *capture;
+  size_t length;
+  size_t i;
+  size_t bytes;
+  unsigned run;
+  unsigned fixes;
+  FILE *file;
+  NMEA_Parser parser;
+  NMEA_Fix fix;
+  uint16_t used;
+  double start;
+
+  if (argc != 2 || (file = fopen(argv[1], "rb")) == NULL)
+  {
+    fprintf(stderr, "usage: nmea_test capture.nmea\n");
+    return 2;
+  }
+  capture = malloc(MAX_STREAM);
+  length = fread(capture, 1, MAX_STREAM, file);
+  fclose(file);
+  srand(1);
+
+  /* The capture as received, in random chunk sizes */
+  ReferenceParse(capture, length, &expected);
+  fixes = expected.count;
+  for (run = 0; run < FUZZ_RUNS; run++)
+  {
+    Compare("capture", capture, length);
+  }
+
+  /* The capture with bit errors, as on a noisy line */
+  for (run = 0; run < FUZZ_RUNS; run++)
+  {
+    memcpy(stream, capture, length);
+    for (i = 0; i < 1 + (size_t)(rand() % 64); i++)
+    {
+      stream[rand() % length] ^= (uint8_t)(1 << (rand() % 8));
+    }
+    Compare("bit flips", stream, length);
+  }
+
+  /* Random bytes, mostly from the characters NMEA is made of */
+  for (run = 0; run < FUZZ_RUNS; run++)
+  {
+    for (i = 0; i < 4096; i++)
+    {
+      stream[i] = (rand() % 8) ? (uint8_t)alphabet[rand() % (sizeof(alphabet) - 1)] : (uint8_t)rand();
+    }
+    Compare("random bytes", stream, 4096);
+  }
+
+  /* Generated sentences with random fields, some cut short or run together */
+  for (run = 0; run < FUZZ_RUNS; run++)
+  {
+    for (bytes = 0; bytes < 8192; )
+    {
+      bytes += Sentence((char *)stream + bytes);
+      if (rand() % 8 == 0)
+      {
+        bytes -= (size_t)(rand() % 20);
+      }
+    }
+    Compare("sentences", stream, bytes);
+  }
+
+  /* Throughput over the capture, parsed as one chunk per pass */
+  start = Seconds();
+  NMEA_Init(&parser);
+  for (bytes = 0; bytes < BENCH_BYTES; bytes += length)
+  {
+    for (i = 0; i < length; i += used)
+    {
+      NMEA_Parse(&parser, capture + i, (uint16_t)(length - i > 0xFFFF ? 0xFFFF : length - i), &used, &fix);
+    }
+  }
+  printf("%u fixes in the capture, %d runs of each fuzz pattern, %lu failures\n",
+         fixes, FUZZ_RUNS, failures);
+  printf("%.2f ns per character over %lu MB\n",
+         (Seconds() - start) * 1e9 / bytes, (unsigned long)(bytes >> 20));
+  free(capture);
+  return failures != 0;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
@@ -0,0 +1,211 @@
+/**
+  ******************************************************************************
+  * @file    raster_bench.c
+  * @author  Louis Barrett
+  * @brief   Host check and benchmark of the raster.c span fill
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -O2 -I Inc Tests/raster_bench.c Src/raster.c Src/ugui.c -o raster_bench
+  *   ./raster_bench
+  *
+  * Random rectangles through RASTER_Apply() are compared with a pixel by
+  * pixel reference. Then the same fills are timed through UG_FillFrame(),
+  * once with the pset loop of uGUI and once with the DRIVER_FILL_FRAME
+  * accelerator that lcd.c registers.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#define _POSIX_C_SOURCE 199309L
+#include "raster.h"
+#include "ugui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FRAME_SIZE          (RASTER_WIDTH * RASTER_HEIGHT / 8)
+#define CHECK_RUNS          200000
+#define BENCH_RUNS          20000
+
+static uint8_t frame[FRAME_SIZE];
+static uint8_t expect[FRAME_SIZE];
+static UG_GUI gui;
+
+/* Private functions ---------------------------------------------------------*/
+
+/* The pixel output and fill accelerator lcd.c gives uGUI, on frame[]. PSet()
+   is LCD_PSet(), which lcd.c keeps to itself. */
+static void PSet(UG_S16 x, UG_S16 y, UG_COLOR c)
+{
+  if (x < 0 || x >= RASTER_WIDTH || y < 0 || y >= RASTER_HEIGHT)
+  {
+    return;
+  }
+  if (c != C_BLACK)
+  {
+    frame[x + (y/8)*RASTER_WIDTH] |= (1 << (y & 7));
+  }
+  else
+  {
+    frame[x + (y/8)*RASTER_WIDTH] &= ~(1 << (y & 7));
+  }
+}
+
+static UG_RESULT FillFrame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c)
+{
+  RASTER_Apply(frame, x1, y1, x2, y2, (c != C_BLACK) ? RASTER_ROP_SET : RASTER_ROP_CLEAR, 0);
+  return UG_RESULT_OK;
+}
+
+/* RASTER_Apply() one pixel at a time */
+static void Reference(uint8_t *buffer, int x1, int y1, int x2, int y2, uint8_t rop, uint8_t pattern)
+{
+  uint8_t *p;
+  uint8_t bit;
+  int x;
+  int y;
+  int swap;
+
+  if (x2 < x1)
+  {
+    swap = x2;
+    x2 = x1;
+    x1 = swap;
+  }
+  if (y2 < y1)
+  {
+    swap = y2;
+    y2 = y1;
+    y1 = swap;
+  }
+  for (y = y1; y <= y2; y++)
+  {
+    for (x = x1; x <= x2; x++)
+    {
+      if (x < 0 || x >= RASTER_WIDTH || y < 0 || y >= RASTER_HEIGHT)
+      {
+        continue;
+      }
+      bit = (uint8_t)(1 << (y & 7));
+      p = &buffer[x + (y / 8) * RASTER_WIDTH];
+      switch (rop)
+      {
+        case RASTER_ROP_SET:
+          *p |= bit;
+          break;
+        case RASTER_ROP_XOR:
+          *p ^= (uint8_t)(pattern & bit);
+          break;
+        default:
+          *p &= (uint8_t)~bit;
+          break;
+      }
+    }
+  }
+}
+
+/* A screen fill and two partial fills, as a window redraw does */
+static void Fills(void)
+{
+  UG_FillScreen(C_BLACK);
+  UG_FillFrame(10, 4, 100, 20, C_WHITE);
+  UG_FillFrame(30, 0, 60, 31, C_BLACK);
+}
+
+static double Bench(void)
+{
+  struct timespec start;
+  struct timespec end;
+  int run;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (run = 0; run < BENCH_RUNS; run++)
+  {
+    Fills();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / BENCH_RUNS / 1000;
+}
+
+int main(void)
+{
+  unsigned long failures = 0;
+  uint8_t pset[FRAME_SIZE];
+  double loop;
+  double span;
+  int16_t x1, y1, x2, y2;
+  uint8_t rop;
+  uint8_t pattern;
+  int run;
+  int i;
+
+  /* Any corners, on or off the panel, on top of random contents */
+  srand(1);
+  for (run = 0; run < CHECK_RUNS; run++)
+  {
+    for (i = 0; i < FRAME_SIZE; i++)
+    {
+      frame[i] = (uint8_t)rand();
+    }
+    memcpy(expect, frame, FRAME_SIZE);
+    x1 = (int16_t)(rand() % (RASTER_WIDTH + 40) - 20);
+    x2 = (int16_t)(rand() % (RASTER_WIDTH + 40) - 20);
+    y1 = (int16_t)(rand() % (RASTER_HEIGHT + 20) - 10);
+    y2 = (int16_t)(rand() % (RASTER_HEIGHT + 20) - 10);
+    rop = (uint8_t)(rand() % 3);
+    pattern = (uint8_t)rand();
+    RASTER_Apply(frame, x1, y1, x2, y2, rop, pattern);
+    Reference(expect, x1, y1, x2, y2, rop, pattern);
+    if (memcmp(frame, expect, FRAME_SIZE) != 0 && failures++ < 10)
+    {
+      printf("FAIL rop %d (%d,%d)-(%d,%d) pattern %02X\n", rop, x1, y1, x2, y2, pattern);
+    }
+  }
+
+  UG_Init(&gui, PSet, RASTER_WIDTH, RASTER_HEIGHT);
+  UG_DriverRegister(DRIVER_FILL_FRAME, (void *)FillFrame);
+
+  UG_DriverDisable(DRIVER_FILL_FRAME);
+  loop = Bench();
+  memcpy(pset, frame, FRAME_SIZE);
+
+  UG_DriverEnable(DRIVER_FILL_FRAME);
+  span = Bench();
+  if (memcmp(pset, frame, FRAME_SIZE) != 0)
+  {
+    printf("FAIL span fill and pset loop differ\n");
+    failures++;
+  }
+
+  printf("%d random rectangles checked, %lu failures\n", CHECK_RUNS, failures);
+  printf("screen fill plus two partial fills: pset loop %.2f us, span fill %.3f us\n", loop, span);
+  return failures != 0;
+}
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
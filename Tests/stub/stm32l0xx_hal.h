@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    stm32l0xx_hal.h
+  * @author  Louis Barrett
+  * @brief   The part of the HAL that alarm.c and tz.c use, for host tests.
+  *          Put Tests/stub before Inc on the include path. The test provides
+  *          the functions, data EEPROM is whatever it maps at
+  *          DATA_EEPROM_BASE.
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STM32L0XX_HAL_H
+#define STM32L0XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO volatile
+
+typedef enum
+{
+  HAL_OK = 0x00U,
+  HAL_ERROR = 0x01U
+} HAL_StatusTypeDef;
+
+/* Same fields as stm32l0xx_hal_rtc.h, only the ones used are meaningful */
+typedef struct
+{
+  uint8_t Hours;
+  uint8_t Minutes;
+  uint8_t Seconds;
+  uint8_t TimeFormat;
+  uint32_t SubSeconds;
+  uint32_t SecondFraction;
+  uint32_t DayLightSaving;
+  uint32_t StoreOperation;
+} RTC_TimeTypeDef;
+
+typedef struct
+{
+  uint8_t WeekDay;
+  uint8_t Month;
+  uint8_t Date;
+  uint8_t Year;
+} RTC_DateTypeDef;
+
+typedef struct
+{
+  RTC_TimeTypeDef AlarmTime;
+  uint32_t AlarmMask;
+  uint32_t AlarmSubSecondMask;
+  uint32_t AlarmDateWeekDaySel;
+  uint8_t AlarmDateWeekDay;
+  uint32_t Alarm;
+} RTC_AlarmTypeDef;
+
+typedef struct
+{
+  int unused;
+} RTC_HandleTypeDef;
+
+#define RTC_FORMAT_BIN                      0x00000000U
+#define RTC_FORMAT_BCD                      0x00000001U
+#define RTC_HOURFORMAT12_AM                 ((uint8_t)0x00U)
+#define RTC_WEEKDAY_MONDAY                  ((uint8_t)0x01U)
+#define RTC_WEEKDAY_SUNDAY                  ((uint8_t)0x07U)
+#define RTC_ALARM_A                         0x00000100U
+#define RTC_ALARM_B                         0x00000200U
+#define RTC_ALARMDATEWEEKDAYSEL_WEEKDAY     0x40000000U
+#define RTC_ALARMMASK_NONE                  0x00000000U
+#define RTC_ALARMSUBSECONDMASK_ALL          0x00000000U
+
+/* Where the STM32L073 has it, the test maps memory there */
+#define DATA_EEPROM_BASE                    0x08080000UL
+#define FLASH_TYPEPROGRAMDATA_WORD          0x02U
+
+static inline uint8_t RTC_Bcd2ToByte(uint8_t value)
+{
+  return (uint8_t)((value >> 4) * 10 + (value & 0x0F));
+}
+
+static inline uint8_t RTC_ByteToBcd2(uint8_t value)
+{
+  return (uint8_t)(((value / 10) << 4) | (value % 10));
+}
+
+HAL_StatusTypeDef HAL_RTC_SetAlarm_IT(RTC_HandleTypeDef *hrtc, RTC_AlarmTypeDef *sAlarm, uint32_t Format);
+HAL_StatusTypeDef HAL_RTC_DeactivateAlarm(RTC_HandleTypeDef *hrtc, uint32_t Alarm);
+void HAL_RTC_AlarmAEventCallback(RTC_HandleTypeDef *hrtc);
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Unlock(void);
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Lock(void);
+HAL_StatusTypeDef HAL_FLASHEx_DATAEEPROM_Program(uint32_t TypeProgram, uint32_t Address, uint32_t Data);
+
+#endif /* STM32L0XX_HAL_H */
+
+/************************ (C) COPYRIGHT Louis Barrett *****END OF FILE****/
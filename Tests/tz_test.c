@@ -0,0 +1,458 @@
+/**
+  ******************************************************************************
+  * @file    tz_test.c
+  * @author  Louis Barrett
+  * @brief   Host test of tz.c. POSIX TZ strings are parsed against expected
+  *          fields, then four zones run from 2000 to 2099 on a simulated
+  *          RTC, minute by minute for two hours before every change. At
+  *          each step the offsets must match changes worked out from the C
+  *          library calendar, and the RTC must hold home local time. The
+  *          simulated RTC ignores SUB1H during hour 0 like the real one.
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -O2 -I Tests/stub -I Inc Tests/tz_test.c Src/tz.c Src/epoch.c -o tz_test
+  *   ./tz_test
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#define _DEFAULT_SOURCE
+#include "tz.h"
+#include "rtc.h"
+#include "alarm.h"
+#include "epoch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* 2000-01-01 00:00:00 in Unix time */
+#define UNIX_2000           946684800L
+#define MAX_CHANGES         (2 * 100)
+
+/* One parse case, offsets in minutes east of UTC */
+typedef struct
+{
+  const char *spec;
+  int ok;
+  const char *name;
+  const char *dstName;
+  int offset;
+  int dstOffset;
+  int start[4];                             /* month, week, weekday, minutes */
+  int end[4];
+} ParseCase;
+
+static const ParseCase parseCases[] =
+{
+  {"UTC0", 1, "UTC", "", 0, 0, {0}, {0}},
+  {"JST-9", 1, "JST", "", 540, 540, {0}, {0}},
+  {"<+0530>-5:30", 1, "+0530", "", 330, 330, {0}, {0}},
+  {"<-03>3<-02>,M3.5.0/-2,M10.5.0/-1", 1, "-03", "-02", -180, -120, {3, 5, 0, -120}, {10, 5, 0, -60}},
+  {"GMT0BST,M3.5.0/1,M10.5.0", 1, "GMT", "BST", 0, 60, {3, 5, 0, 60}, {10, 5, 0, 120}},
+  {"EST5EDT,M3.2.0,M11.1.0", 1, "EST", "EDT", -300, -240, {3, 2, 0, 120}, {11, 1, 0, 120}},
+  {"CET-1CEST,M3.5.0,M10.5.0/3", 1, "CET", "CEST", 60, 120, {3, 5, 0, 120}, {10, 5, 0, 180}},
+  {"AEST-10AEDT,M10.1.0,M4.1.0/3", 1, "AEST", "AEDT", 600, 660, {10, 1, 0, 120}, {4, 1, 0, 180}},
+  {"<-04>4<-03>,M9.1.6/24,M4.1.6/24", 1, "-04", "-03", -240, -180, {9, 1, 6, 1440}, {4, 1, 6, 1440}},
+  {"IST-1GMT0,M10.5.0,M3.5.0/1", 1, "IST", "GMT", 60, 0, {10, 5, 0, 120}, {3, 5, 0, 60}},
+  {"LHST-10:30LHDT-11,M10.1.0,M4.1.0", 1, "LHST", "LHDT", 630, 660, {10, 1, 0, 120}, {4, 1, 0, 120}},
+  {"NZST-12NZDT,M9.5.0,M4.1.0/3", 1, "NZST", "NZDT", 720, 780, {9, 5, 0, 120}, {4, 1, 0, 180}},
+  {"AB0", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"<+05", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST5EDT,J60,J300", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST5EDT,M3.2.0", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST5EDT,M13.1.0,M11.1.0", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST5EDT,M3.6.0,M11.1.0", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST5EDT,M3.2.7,M11.1.0", 0, NULL, NULL, 0, 0, {0}, {0}},
+  {"EST5EDT,M3.2.0,M11.1.0x", 0, NULL, NULL, 0, 0, {0}, {0}},
+};
+
+/* Zones run together, home first. The first set changes the home zone at
+   01:00 and 02:00 on the last Sunday and has southern and negative rules,
+   the second ends summer time at local midnight where SUB1H cannot work and
+   has a made up zone changing on the last Tuesday of February, which is the
+   29th in some leap years. */
+static const char * const zoneSets[][TZ_MAX_ZONES] =
+{
+  {"GMT0BST,M3.5.0/1,M10.5.0", "EST5EDT,M3.2.0,M11.1.0", "AEST-10AEDT,M10.1.0,M4.1.0/3", "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1"},
+  {"<-04>4<-03>,M9.1.6/24,M4.1.6/24", "JST-9", "LHST-10:30LHDT-11,M10.1.0,M4.1.0", "<+02>-2<+03>,M2.5.2,M10.5.0/3"},
+};
+
+/* A zone's changes as worked out here, UTC epoch seconds and new offset */
+typedef struct
+{
+  long when;
+  int offset;
+  int dst;
+} Change;
+
+static Change changes[TZ_MAX_ZONES][MAX_CHANGES];
+static int changeCount[TZ_MAX_ZONES];
+
+/* The simulated RTC: home local time and the BKP bit */
+static uint32_t rtcLocal;
+static bool rtcDst = false;
+static RTC_RolloverHandler rollover = NULL;
+static unsigned long shifts = 0;
+static unsigned long steps = 0;
+
+static unsigned long failures = 0;
+
+static void Check(int ok, const char *what, long value)
+{
+  if (!ok && failures++ < 20)
+  {
+    printf("FAIL %s: %ld\n", what, value);
+  }
+}
+
+/* RTC and alarm stubs -------------------------------------------------------*/
+
+uint32_t RTC_GetEpoch(uint16_t *subSeconds)
+{
+  if (subSeconds != NULL)
+  {
+    *subSeconds = 0;
+  }
+  return rtcLocal;
+}
+
+void RTC_SetEpoch(uint32_t seconds)
+{
+  rtcLocal = seconds;
+  steps++;
+}
+
+bool RTC_IsDaylightSaving(void)
+{
+  return rtcDst;
+}
+
+/* ADD1H and SUB1H as the RTC does them, SUB1H is ignored in hour 0 */
+void RTC_SetDaylightSaving(bool active, bool shift)
+{
+  if (active == rtcDst)
+  {
+    return;
+  }
+  if (shift && active)
+  {
+    rtcLocal += 3600;
+    shifts++;
+  }
+  else if (shift && rtcLocal % 86400 >= 3600)
+  {
+    rtcLocal -= 3600;
+    shifts++;
+  }
+  else if (shift)
+  {
+    Check(0, "SUB1H in hour 0", (long)rtcLocal);
+  }
+  rtcDst = active;
+}
+
+bool RTC_Subscribe(uint8_t events, RTC_RolloverHandler handler)
+{
+  Check(events & RTC_ROLL_MINUTE, "subscribed events", events);
+  rollover = handler;
+  return true;
+}
+
+uint32_t RTC_ToEpoch(const RTC_TimeTypeDef *time, const RTC_DateTypeDef *date)
+{
+  EPOCH_Calendar calendar;
+
+  calendar.year = date->Year;
+  calendar.month = date->Month;
+  calendar.date = date->Date;
+  calendar.hours = time->Hours;
+  calendar.minutes = time->Minutes;
+  calendar.seconds = time->Seconds;
+  return EPOCH_FromCalendar(&calendar);
+}
+
+void ALARM_Reschedule(void)
+{
+}
+
+/* Reference -----------------------------------------------------------------*/
+
+/* UTC epoch seconds of an Mm.w.d/minutes rule in a year, from timegm() */
+static long RuleTime(const TZ_Rule *rule, int year, int offset)
+{
+  struct tm tm = {0};
+  int mday;
+
+  tm.tm_year = year + 100;
+  tm.tm_mon = rule->month - 1;
+  tm.tm_mday = 1;
+  timegm(&tm);
+  mday = 1 + (rule->weekday - tm.tm_wday + 7) % 7 + (rule->week - 1) * 7;
+
+  /* Week 5 is the last such day, which may be the fourth */
+  for (;;)
+  {
+    struct tm day = {0};
+
+    day.tm_year = year + 100;
+    day.tm_mon = rule->month - 1;
+    day.tm_mday = mday;
+    timegm(&day);
+    if (day.tm_mon == rule->month - 1)
+    {
+      break;
+    }
+    mday -= 7;
+  }
+
+  tm.tm_mday = mday;
+  return (long)timegm(&tm) - UNIX_2000 + (rule->minutes - offset) * 60L;
+}
+
+static int CompareChanges(const void *a, const void *b)
+{
+  long diff = ((const Change *)a)->when - ((const Change *)b)->when;
+
+  return (diff > 0) - (diff < 0);
+}
+
+/* Every change of a zone from 2000 to 2099, in order */
+static void BuildChanges(int index, const TZ_Zone *zone)
+{
+  int year;
+  int count = 0;
+
+  for (year = 0; zone->hasDst && year < 100; year++)
+  {
+    changes[index][count].when = RuleTime(&zone->start, year, zone->offset);
+    changes[index][count].offset = zone->dstOffset;
+    changes[index][count].dst = 1;
+    count++;
+    changes[index][count].when = RuleTime(&zone->end, year, zone->dstOffset);
+    changes[index][count].offset = zone->offset;
+    changes[index][count].dst = 0;
+    count++;
+  }
+  qsort(changes[index], count, sizeof(Change), CompareChanges);
+  changeCount[index] = count;
+}
+
+/* Index of the first change after utc */
+static int FindChange(int index, long utc)
+{
+  int low = 0;
+  int high = changeCount[index];
+  int mid;
+
+  while (low < high)
+  {
+    mid = (low + high) / 2;
+    if (changes[index][mid].when <= utc)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+/* Offset in force at utc. Before the first change it is the one the first
+   year ends on. */
+static int ReferenceOffset(int index, const TZ_Zone *zone, long utc, int *dst)
+{
+  int i = FindChange(index, utc);
+
+  if (changeCount[index] == 0)
+  {
+    *dst = 0;
+    return zone->offset;
+  }
+  i = (i == 0) ? 1 : i - 1;
+  *dst = changes[index][i].dst;
+  return changes[index][i].offset;
+}
+
+/* Seconds from utc to the next change of any zone */
+static long UntilChange(long utc)
+{
+  long until = 0x7FFFFFFFL;
+  int index;
+  int i;
+
+  for (index = 0; index < TZ_MAX_ZONES; index++)
+  {
+    i = FindChange(index, utc);
+    if (i < changeCount[index] && changes[index][i].when - utc < until)
+    {
+      until = changes[index][i].when - utc;
+    }
+  }
+  return until;
+}
+
+/* Tests ---------------------------------------------------------------------*/
+
+static void CheckRule(const TZ_Rule *rule, const int *expect, const char *spec)
+{
+  Check(rule->month == expect[0] && rule->week == expect[1] && rule->weekday == expect[2]
+        && rule->minutes == expect[3], spec, rule->month);
+}
+
+static void CheckParse(void)
+{
+  const ParseCase *c;
+  TZ_Zone zone;
+  size_t i;
+  bool ok;
+
+  for (i = 0; i < sizeof(parseCases) / sizeof(parseCases[0]); i++)
+  {
+    c = &parseCases[i];
+    ok = TZ_Parse(c->spec, &zone);
+    Check(ok == c->ok, c->spec, ok);
+    if (!ok || !c->ok)
+    {
+      continue;
+    }
+    Check(strcmp(zone.name, c->name) == 0 && strcmp(zone.dstName, c->dstName) == 0, c->spec, 0);
+    Check(zone.offset == c->offset && zone.dstOffset == c->dstOffset, c->spec, zone.offset);
+    Check(zone.hasDst == (c->start[0] != 0), c->spec, zone.hasDst);
+    if (zone.hasDst)
+    {
+      CheckRule(&zone.start, c->start, c->spec);
+      CheckRule(&zone.end, c->end, c->spec);
+    }
+  }
+}
+
+/* Runs one set of zones through the century a minute at a time */
+static unsigned long RunZones(const char * const *specs)
+{
+  TZ_Zone zone[TZ_MAX_ZONES];
+  RTC_TimeTypeDef time = {0};
+  RTC_DateTypeDef date = {0};
+  EPOCH_Calendar calendar;
+  char text[16];
+  long utc;
+  long last;
+  long step;
+  int offset[TZ_MAX_ZONES];
+  int dst;
+  int i;
+  unsigned long seen = 0;
+
+  /* 2000-01-02, so home time is inside the RTC's range everywhere */
+  utc = 86400;
+  last = 36524L * 86400;
+  rtcLocal = (uint32_t)utc;
+  rtcDst = false;
+
+  TZ_Init();
+  for (i = 0; i < TZ_MAX_ZONES; i++)
+  {
+    Check(TZ_Parse(specs[i], &zone[i]), specs[i], 0);
+    Check(TZ_SetZone((uint8_t)i, specs[i]), specs[i], i);
+    BuildChanges(i, &zone[i]);
+    offset[i] = ReferenceOffset(i, &zone[i], utc, &dst);
+  }
+  Check(TZ_GetZoneCount() == TZ_MAX_ZONES, "zone count", TZ_GetZoneCount());
+  Check(rtcLocal == utc + offset[TZ_HOME] * 60L, "home time after TZ_SetZone", (long)rtcLocal - utc);
+
+  for (; utc < last; utc += step)
+  {
+    /* Rules are to the minute, an hour at a time cannot pass over one */
+    step = (UntilChange(utc) <= 2 * 3600L) ? 60 : 3600;
+    rtcLocal += step;
+    EPOCH_ToCalendar(rtcLocal, &calendar);
+    time.Hours = calendar.hours;
+    time.Minutes = calendar.minutes;
+    time.Seconds = calendar.seconds;
+    date.Year = calendar.year;
+    date.Month = calendar.month;
+    date.Date = calendar.date;
+    date.WeekDay = calendar.weekday;
+    rollover(RTC_ROLL_MINUTE, &time, &date);
+
+    for (i = 0; i < TZ_MAX_ZONES; i++)
+    {
+      offset[i] = ReferenceOffset(i, &zone[i], utc + step, &dst);
+      if (TZ_GetOffset((uint8_t)i) != offset[i])
+      {
+        Check(0, specs[i], utc + step);
+        continue;
+      }
+      Check(strcmp(TZ_GetName((uint8_t)i), dst ? zone[i].dstName : zone[i].name) == 0, "zone name", utc);
+    }
+    Check(rtcLocal == (uint32_t)(utc + step + offset[TZ_HOME] * 60L), "home time", utc + step);
+    Check(rtcDst == (offset[TZ_HOME] != zone[TZ_HOME].offset), "BKP bit", utc + step);
+    seen++;
+    if (failures > 20)
+    {
+      break;
+    }
+
+    /* The world clock adds the offset difference to home time */
+    if (utc % (7 * 3607L) < step)
+    {
+      for (i = 0; i < TZ_MAX_ZONES; i++)
+      {
+        long local = utc + step + offset[i] * 60L;
+        long home = utc + step + offset[TZ_HOME] * 60L;
+        char expect[16];
+
+        snprintf(expect, sizeof(expect), "%-5s %02ld:%02ld%c", TZ_GetName((uint8_t)i),
+                 (local % 86400) / 3600, (local % 3600) / 60,
+                 (local / 86400 > home / 86400) ? '+' : (local / 86400 < home / 86400) ? '-' : ' ');
+        TZ_FormatZone(text, (uint8_t)i, &time);
+        Check(strcmp(text, expect) == 0, "TZ_FormatZone", utc + step);
+      }
+    }
+  }
+  return seen;
+}
+
+int main(void)
+{
+  unsigned long count = 0;
+  size_t set;
+
+  CheckParse();
+  for (set = 0; set < sizeof(zoneSets) / sizeof(zoneSets[0]); set++)
+  {
+    count += RunZones(zoneSets[set]);
+  }
+
+  printf("%lu steps, %lu SUB1H/ADD1H, %lu calendar steps, %lu failures\n",
+         count, shifts, steps, failures);
+  return failures != 0;
+}
@@ -0,0 +1,284 @@
+/**
+  ******************************************************************************
+  * @file    ugui_test.c
+  * @author  Louis Barrett
+  * @brief   Host test of the uGUI dirty rectangle redraw. Random textbox
+  *          edits, through the setters and by flagging the object directly,
+  *          are drawn incrementally and only the areas UG_Update() reports
+  *          are copied to a model of the panel. After every update the
+  *          panel must match a window built from scratch with the same
+  *          textboxes and drawn in full.
+  *
+  *
+  * Build and run on a PC from the repository root:
+  *   gcc -Wall -O2 -I Inc Tests/ugui_test.c Src/ugui.c -o ugui_test
+  *   ./ugui_test
+  *
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2018 Louis Barrett
+  * Email: louisbarrett98@gmail.com
+  *
+  * Permission is hereby granted, free of charge, to any person obtaining a copy
+  * of this software and associated documentation files (the "Software"), to deal
+  * in the Software without restriction, including without limitation the rights
+  * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  * copies of the Software, and to permit persons to whom the Software is
+  * furnished to do so, subject to the following conditions:
+  *
+  * The above copyright notice and this permission notice shall be included in all
+  * copies or substantial portions of the Software.
+  *
+  * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  * SOFTWARE.
+  *
+  ******************************************************************************
+  */
+
+#include "ugui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WIDTH               128
+#define HEIGHT              32
+#define BOXES               4
+#define TEXT_SIZE           12
+#define STEPS               100000
+/* Edits between two updates are 0 up to this */
+#define MAX_EDITS           4
+
+/* What a textbox should look like */
+typedef struct
+{
+  char text[TEXT_SIZE + 1];
+  UG_COLOR fc;
+  UG_COLOR bc;
+  UG_U8 align;
+  UG_S8 h_space;
+  UG_S8 v_space;
+  int visible;
+} Box;
+
+/* Textbox areas in the window, two of them touch the right edge of another */
+static const UG_AREA areas[BOXES] =
+{
+  {0, 0, 62, 14}, {63, 0, 126, 14}, {0, 15, 40, 30}, {50, 15, 126, 30}
+};
+static const UG_U8 aligns[] =
+{
+  ALIGN_TOP_LEFT, ALIGN_TOP_CENTER, ALIGN_TOP_RIGHT,
+  ALIGN_CENTER_LEFT, ALIGN_CENTER, ALIGN_CENTER_RIGHT,
+  ALIGN_BOTTOM_LEFT, ALIGN_BOTTOM_CENTER, ALIGN_BOTTOM_RIGHT
+};
+static const UG_COLOR colors[] = {C_BLACK, C_WHITE, 0x123456, 0xF0F0F0};
+
+static UG_COLOR frame[HEIGHT][WIDTH];     /* what uGUI draws into */
+static UG_COLOR panel[HEIGHT][WIDTH];     /* what was reported and copied */
+static UG_COLOR reference[HEIGHT][WIDTH];
+static UG_COLOR (*target)[WIDTH] = frame;
+
+static UG_GUI gui;
+static UG_WINDOW window;
+static UG_OBJECT objects[BOXES];
+static UG_TEXTBOX textboxes[BOXES];
+static char texts[BOXES][TEXT_SIZE + 1];
+static Box model[BOXES];
+static unsigned long failures = 0;
+
+static void Check(int ok, const char *what, long value)
+{
+  if (!ok && failures++ < 20)
+  {
+    printf("FAIL %s: %ld\n", what, value);
+  }
+}
+
+static void PSet(UG_S16 x, UG_S16 y, UG_COLOR c)
+{
+  Check(x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT, "pixel off the panel", (long)y * WIDTH + x);
+  if (x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT)
+  {
+    target[y][x] = c;
+  }
+}
+
+/* The panel driver: send the reported area of the frame to the panel */
+static void DirtyArea(UG_S16 xs, UG_S16 ys, UG_S16 xe, UG_S16 ye)
+{
+  UG_S16 x;
+  UG_S16 y;
+
+  for (y = ys < 0 ? 0 : ys; y <= ye && y < HEIGHT; y++)
+  {
+    for (x = xs < 0 ? 0 : xs; x <= xe && x < WIDTH; x++)
+    {
+      panel[y][x] = frame[y][x];
+    }
+  }
+}
+
+static void RandomText(char *text)
+{
+  static const char chars[] = " 0123456789:.-AMPWgjy";
+  int length = rand() % (TEXT_SIZE + 1);
+  int i;
+
+  for (i = 0; i < length; i++)
+  {
+    text[i] = chars[rand() % (sizeof(chars) - 1)];
+  }
+  text[length] = 0;
+}
+
+/* Creates the window and its textboxes as the model has them */
+static void CreateWindow(UG_WINDOW *wnd, UG_OBJECT *objlst, UG_TEXTBOX *txb, char (*text)[TEXT_SIZE + 1])
+{
+  UG_U8 i;
+
+  UG_WindowCreate(wnd, objlst, BOXES, NULL);
+  UG_WindowSetStyle(wnd, WND_STYLE_2D | WND_STYLE_HIDE_TITLE);
+  for (i = 0; i < BOXES; i++)
+  {
+    UG_TextboxCreate(wnd, &txb[i], i, areas[i].xs, areas[i].ys, areas[i].xe, areas[i].ye);
+    UG_TextboxSetFont(wnd, i, &FONT_8X14);
+    strcpy(text[i], model[i].text);
+    UG_TextboxSetText(wnd, i, text[i]);
+    UG_TextboxSetForeColor(wnd, i, model[i].fc);
+    UG_TextboxSetBackColor(wnd, i, model[i].bc);
+    UG_TextboxSetAlignment(wnd, i, model[i].align);
+    UG_TextboxSetHSpace(wnd, i, model[i].h_space);
+    UG_TextboxSetVSpace(wnd, i, model[i].v_space);
+    if (!model[i].visible)
+    {
+      UG_TextboxHide(wnd, i);
+    }
+  }
+}
+
+/* Draws the model in full with a GUI of its own */
+static void DrawReference(void)
+{
+  static UG_GUI refGui;
+  static UG_WINDOW refWindow;
+  static UG_OBJECT refObjects[BOXES];
+  static UG_TEXTBOX refTextboxes[BOXES];
+  static char refTexts[BOXES][TEXT_SIZE + 1];
+
+  target = reference;
+  memset(reference, 0, sizeof(reference));
+  UG_Init(&refGui, PSet, WIDTH, HEIGHT);
+  CreateWindow(&refWindow, refObjects, refTextboxes, refTexts);
+  UG_WindowShow(&refWindow);
+  UG_Update();
+  UG_SelectGUI(&gui);
+  target = frame;
+}
+
+/* One random edit of one textbox, applied to the model as well */
+static void Edit(void)
+{
+  UG_U8 id = (UG_U8)(rand() % BOXES);
+  Box *box = &model[id];
+
+  switch (rand() % 9)
+  {
+    case 0:
+    case 1:
+      RandomText(box->text);
+      strcpy(texts[id], box->text);
+      UG_TextboxSetText(&window, id, texts[id]);
+      break;
+    case 2:
+      box->fc = colors[rand() % 4];
+      UG_TextboxSetForeColor(&window, id, box->fc);
+      break;
+    case 3:
+      box->bc = colors[rand() % 4];
+      UG_TextboxSetBackColor(&window, id, box->bc);
+      break;
+    case 4:
+      box->align = aligns[rand() % 9];
+      UG_TextboxSetAlignment(&window, id, box->align);
+      break;
+    case 5:
+      box->h_space = (UG_S8)(rand() % 4);
+      box->v_space = (UG_S8)(rand() % 4);
+      UG_TextboxSetHSpace(&window, id, box->h_space);
+      UG_TextboxSetVSpace(&window, id, box->v_space);
+      break;
+    case 6:
+      box->visible = !box->visible;
+      if (box->visible)
+      {
+        UG_TextboxShow(&window, id);
+      }
+      else
+      {
+        UG_TextboxHide(&window, id);
+      }
+      break;
+    case 7:
+      UG_TextboxSetFont(&window, id, &FONT_8X14);
+      break;
+    default:
+      /* Changed behind the setters' back, only the object is flagged */
+      if (box->visible)
+      {
+        box->fc = colors[rand() % 4];
+        box->bc = colors[rand() % 4];
+        textboxes[id].fc = box->fc;
+        textboxes[id].bc = box->bc;
+        objects[id].state |= OBJ_STATE_UPDATE | OBJ_STATE_REDRAW;
+      }
+      break;
+  }
+}
+
+int main(void)
+{
+  unsigned long step;
+  int edits;
+  int i;
+
+  srand(1);
+  for (i = 0; i < BOXES; i++)
+  {
+    RandomText(model[i].text);
+    model[i].fc = C_BLACK;
+    model[i].bc = C_WHITE;
+    model[i].align = ALIGN_CENTER;
+    model[i].h_space = 1;
+    model[i].v_space = 0;
+    model[i].visible = 1;
+  }
+
+  UG_Init(&gui, PSet, WIDTH, HEIGHT);
+  UG_DriverRegister(DRIVER_DIRTY_AREA, (void *)DirtyArea);
+  CreateWindow(&window, objects, textboxes, texts);
+  UG_WindowShow(&window);
+
+  for (step = 0; step < STEPS; step++)
+  {
+    for (edits = rand() % (MAX_EDITS + 1); edits > 0; edits--)
+    {
+      Edit();
+    }
+    UG_Update();
+
+    DrawReference();
+    Check(memcmp(frame, reference, sizeof(frame)) == 0, "frame differs from a full redraw", (long)step);
+    Check(memcmp(panel, reference, sizeof(panel)) == 0, "panel differs from a full redraw", (long)step);
+    Check(gui.dirty_cnt == 0, "dirty rectangles left", (long)gui.dirty_cnt);
+  }
+
+  printf("%lu updates\n", step);
+  printf("%lu failures\n", failures);
+  return failures != 0;
+}
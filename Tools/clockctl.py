@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+#
+# clockctl.py - sets the time and reads the state of the clock over USART2
+#
+# Copyright (c) 2018 Louis Barrett
+#
+# Usage:
+#   clockctl.py /dev/ttyACM0 settime          set the clock to this PC's UTC
+#   clockctl.py /dev/ttyACM0 stats            print the clock's counters
+#   clockctl.py /dev/ttyACM0 brightness 128   set the panel contrast
+#   clockctl.py /dev/ttyACM0 fb shot.pbm      save the frame buffer
+#   clockctl.py /dev/ttyACM0 shot shot.png    save what the panel shows
+#   clockctl.py /dev/ttyACM0 face 1           show the world clock
+#   clockctl.py /dev/ttyACM0 stream a.pbm ... mirror images onto the panel
+#
+# The port can also be the pty printed by clocksim.py. Without images,
+# stream plays a built in animation; it prints the frame rate it reached
+# and what the link allows for the bytes each frame took.
+
+import argparse
+import collections
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+import proto
+
+
+class Link:
+    def __init__(self, path, baud, timeout):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        attrs = termios.tcgetattr(self.fd)
+        speed = getattr(termios, 'B%d' % baud)
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        self.timeout = timeout
+        self.reader = proto.FrameReader()
+        self.frames = collections.deque()
+        self.seq = 0
+
+    def request(self, cmd, payload=b''):
+        """Sends a command and returns the reply payload, raising on errors."""
+        self.seq = (self.seq + 1) & 0xFF
+        self.frames.clear()
+        os.write(self.fd, proto.encode_frame(bytes([cmd, self.seq]) + payload))
+        return self.reply(cmd)
+
+    def reply(self, cmd):
+        """Returns the next reply to the last command, for commands that are
+        answered more than once."""
+        deadline = time.monotonic() + self.timeout
+        while True:
+            while self.frames:
+                body = self.frames.popleft()
+                if body[0] != cmd | proto.RESPONSE or body[1] != self.seq:
+                    continue
+                if body[2] != 0:
+                    raise RuntimeError('command 0x%02X failed: %s'
+                                       % (cmd, proto.STATUS.get(body[2], body[2])))
+                return body[3:]
+            left = deadline - time.monotonic()
+            if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                raise TimeoutError('no reply to command 0x%02X' % cmd)
+            self.frames.extend(self.reader.feed(os.read(self.fd, 512)))
+
+
+def set_time(link):
+    # Send just after a second boundary so the part the clock drops is small
+    now = time.time()
+    time.sleep(1.0 - (now % 1.0))
+    now = time.time()
+    seconds = int(now)
+    ms = int((now - seconds) * 1000)
+    reply = link.request(proto.CMD_SET_TIME,
+                         struct.pack('<IH', seconds - proto.EPOCH_2000, ms))
+    offset, = struct.unpack('<i', reply)
+    print('clock was %+d ms off' % offset)
+
+
+def stats(link):
+    for key, value in proto.unpack_stats(link.request(proto.CMD_GET_STATS)).items():
+        if key == 'utc':
+            value = '%s.%03d UTC' % (time.strftime('%Y-%m-%d %H:%M:%S', time.gmtime(value)),
+                                     int((value % 1) * 1000))
+        print('%-15s %s' % (key, value))
+
+
+def read_fb(link):
+    fb = bytearray()
+    chunk = proto.MAX_PAYLOAD - 2
+    while len(fb) < proto.FRAME_BUFFER_SIZE:
+        length = min(chunk, proto.FRAME_BUFFER_SIZE - len(fb))
+        reply = link.request(proto.CMD_READ_FB, struct.pack('<HB', len(fb), length))
+        fb += reply[2:]
+    return bytes(fb)
+
+
+def screenshot(link):
+    """Returns the frame buffer as the clock last presented it. A busy
+    face is captured over several frames, a page at a time."""
+    encoded = bytearray()
+    reply = link.request(proto.CMD_SCREENSHOT)
+    while True:
+        offset, last = struct.unpack_from('<HB', reply)
+        if offset != len(encoded):
+            raise RuntimeError('screenshot part at %d lost' % len(encoded))
+        encoded += reply[3:]
+        if last:
+            break
+        reply = link.reply(proto.CMD_SCREENSHOT)
+    fb = proto.rle_decode(bytes(encoded))
+    if len(fb) != proto.FRAME_BUFFER_SIZE:
+        raise RuntimeError('screenshot decodes to %d bytes' % len(fb))
+    print('%d bytes for %d, %.0f%% saved' % (len(encoded), len(fb),
+                                            100.0 - 100.0 * len(encoded) / len(fb)))
+    return fb
+
+
+def demo_frames(count):
+    """A bar sweeping across over a fixed frame, as 128x32 frame buffers."""
+    for n in range(count):
+        fb = bytearray(proto.FRAME_BUFFER_SIZE)
+        for x in range(proto.LCD_WIDTH):
+            fb[x] |= 0x01
+            fb[(proto.LCD_PAGES - 1) * proto.LCD_WIDTH + x] |= 0x80
+        bar = (n * 3) % (proto.LCD_WIDTH - 8)
+        for page in range(proto.LCD_PAGES):
+            for x in range(bar, bar + 8):
+                fb[page * proto.LCD_WIDTH + x] = 0xFF
+        yield bytes(fb)
+
+
+def stream(link, images, count, baud):
+    frames = [proto.read_pbm(path) for path in images] if images else demo_frames(count)
+    link.request(proto.CMD_SET_FACE, bytes([proto.FACE_REMOTE]))
+    shown = bytes(proto.FRAME_BUFFER_SIZE)
+    sent = 0
+    received = 0
+    total = 0
+    start = time.monotonic()
+    for fb in frames:
+        for payload in proto.encode_deltas(shown, fb):
+            sent += len(proto.encode_frame(bytes([proto.CMD_FB_DELTA, 0]) + payload))
+            # Replies are cmd, seq and status plus the CRC, COBS and delimiters
+            received += 7
+            link.request(proto.CMD_FB_DELTA, payload)
+        shown = fb
+        total += 1
+    elapsed = time.monotonic() - start
+    per_frame = (sent + received) / max(total, 1)
+    print('%d frames in %.2f s: %.1f frames/s' % (total, elapsed, total / elapsed))
+    print('%.1f bytes per frame on the wire, %.1f frames/s at most at %d baud'
+          % (per_frame, baud / 10.0 / per_frame if per_frame else 0, baud))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Talk to the clock over its UART protocol')
+    parser.add_argument('port')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--timeout', type=float, default=1.0)
+    sub = parser.add_subparsers(dest='command', required=True)
+    sub.add_parser('settime')
+    sub.add_parser('stats')
+    p = sub.add_parser('brightness')
+    p.add_argument('level', type=int)
+    p = sub.add_parser('fb')
+    p.add_argument('output', help='PBM file to write')
+    p = sub.add_parser('shot')
+    p.add_argument('output', help='PNG or PBM file to write')
+    p = sub.add_parser('face')
+    p.add_argument('face', type=int, help='0 time, 1 world clock, 2 remote')
+    p = sub.add_parser('stream')
+    p.add_argument('images', nargs='*', help='128x32 PBM files, shown in order')
+    p.add_argument('--count', type=int, default=200, help='frames of the demo')
+    args = parser.parse_args()
+
+    link = Link(args.port, args.baud, args.timeout)
+    if args.command == 'settime':
+        set_time(link)
+    elif args.command == 'stats':
+        stats(link)
+    elif args.command == 'brightness':
+        link.request(proto.CMD_SET_BRIGHTNESS, bytes([args.level & 0xFF]))
+    elif args.command == 'fb':
+        proto.write_pbm(args.output, read_fb(link))
+    elif args.command == 'shot':
+        proto.write_image(args.output, screenshot(link))
+    elif args.command == 'face':
+        link.request(proto.CMD_SET_FACE, bytes([args.face & 0xFF]))
+    elif args.command == 'stream':
+        stream(link, args.images, args.count, args.baud)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
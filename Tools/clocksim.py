@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# clocksim.py - stands in for the clock on a pty so the host tools can be
+#               tried without hardware
+#
+# Copyright (c) 2018 Louis Barrett
+#
+# Usage:
+#   clocksim.py [--drift PPM] [--noise] [--baud BAUD]
+#
+# Prints the pty to point clockctl.py at. The simulated RTC runs DRIFT ppm
+# fast and answers the same commands as proto.c. With --noise, bursts of
+# bytes that are not frames are sent in between, like trace records. With
+# --baud, every byte in either direction takes as long as it would on a UART
+# at that rate, so clockctl.py stream reports the frame rate of a real link.
+
+import argparse
+import os
+import random
+import select
+import struct
+import time
+import tty
+
+import proto
+
+
+class Clock:
+    def __init__(self, drift_ppm):
+        self.rate = 1.0 + drift_ppm * 1e-6
+        self.base_host = time.time()
+        self.base_clock = self.base_host - proto.EPOCH_2000 + 3600.0
+        self.start = time.monotonic()
+        self.fb = bytearray(proto.FRAME_BUFFER_SIZE)
+        self.brightness = 0x8F
+        self.face = proto.FACE_TIME
+        self.presented = 0
+        self.good = 0
+        self.bad = 0
+        # A test pattern: a frame around the edge and a diagonal
+        for x in range(proto.LCD_WIDTH):
+            self.fb[x] |= 0x01
+            self.fb[3 * proto.LCD_WIDTH + x] |= 0x80
+            y = x * proto.LCD_HEIGHT // proto.LCD_WIDTH
+            self.fb[(y // 8) * proto.LCD_WIDTH + x] |= 1 << (y & 7)
+        for page in range(proto.LCD_HEIGHT // 8):
+            self.fb[page * proto.LCD_WIDTH] = 0xFF
+            self.fb[page * proto.LCD_WIDTH + proto.LCD_WIDTH - 1] = 0xFF
+
+    def now(self):
+        return self.base_clock + (time.time() - self.base_host) * self.rate
+
+    def screenshot(self, seq):
+        """Answers CMD_SCREENSHOT in parts like proto.c does."""
+        encoded = proto.encode_pages(self.fb)
+        chunk = proto.MAX_PAYLOAD - 3
+        frames = b''
+        for offset in range(0, len(encoded), chunk):
+            last = offset + chunk >= len(encoded)
+            frames += proto.encode_frame(
+                bytes([proto.CMD_SCREENSHOT | proto.RESPONSE, seq, 0])
+                + struct.pack('<HB', offset, last) + encoded[offset:offset + chunk])
+        return frames
+
+    def handle(self, body):
+        cmd, seq, payload = body[0], body[1], body[2:]
+        status = 0
+        out = b''
+        if cmd == proto.CMD_SCREENSHOT and not payload:
+            return self.screenshot(seq)
+        if cmd == proto.CMD_SET_TIME:
+            if len(payload) != 6:
+                status = 2
+            else:
+                seconds, ms = struct.unpack('<IH', payload)
+                offset = int(round((self.now() - (seconds + ms / 1000.0)) * 1000))
+                if abs(offset) > 24 * 3600 * 1000:
+                    offset = 0
+                self.base_host = time.time()
+                self.base_clock = float(seconds)
+                out = struct.pack('<i', offset)
+        elif cmd == proto.CMD_GET_STATS:
+            now = self.now()
+            out = struct.pack('<IHIhHHH', int(now), int((now % 1) * 256),
+                              int((time.monotonic() - self.start) * 1000) & 0xFFFFFFFF,
+                              0, self.good, self.bad, 0)
+        elif cmd == proto.CMD_SET_BRIGHTNESS:
+            if len(payload) != 1:
+                status = 2
+            else:
+                self.brightness = payload[0]
+                print('brightness %d' % self.brightness)
+        elif cmd == proto.CMD_READ_FB:
+            if len(payload) != 3:
+                status = 2
+            else:
+                offset, length = struct.unpack('<HB', payload)
+                if length > proto.MAX_PAYLOAD - 2 or offset + length > len(self.fb):
+                    status = 3
+                else:
+                    out = struct.pack('<H', offset) + bytes(self.fb[offset:offset + length])
+        elif cmd == proto.CMD_SET_FACE:
+            if len(payload) != 1:
+                status = 2
+            elif payload[0] > proto.FACE_REMOTE:
+                status = 3
+            else:
+                self.face = payload[0]
+                self.fb = bytearray(proto.FRAME_BUFFER_SIZE)
+        elif cmd == proto.CMD_FB_DELTA:
+            if len(payload) < 2:
+                status = 2
+            elif self.face != proto.FACE_REMOTE:
+                status = 4
+            else:
+                try:
+                    proto.apply_delta(self.fb, payload)
+                    if payload[0] & proto.FB_PRESENT:
+                        self.presented += 1
+                except (ValueError, IndexError):
+                    status = 3
+        else:
+            status = 1
+        if status:
+            out = b''
+        return proto.encode_frame(bytes([cmd | proto.RESPONSE, seq, status]) + out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Simulate the clock on a pty')
+    parser.add_argument('--drift', type=float, default=20.0, help='RTC error in ppm')
+    parser.add_argument('--noise', action='store_true', help='mix in non-frame bytes')
+    parser.add_argument('--baud', type=int, default=0, help='pace the link like a UART')
+    args = parser.parse_args()
+
+    master, slave = os.openpty()
+    tty.setraw(master)
+    tty.setraw(slave)
+    print(os.ttyname(slave), flush=True)
+
+    # 8N1, ten bit times per byte
+    byte_time = 10.0 / args.baud if args.baud else 0.0
+
+    clock = Clock(args.drift)
+    reader = proto.FrameReader()
+    while True:
+        if not select.select([master], [], [], 0.2)[0]:
+            if args.noise:
+                os.write(master, bytes(random.randrange(256) for _ in range(16)))
+            continue
+        data = os.read(master, 512)
+        time.sleep(len(data) * byte_time)
+        for body in reader.feed(data):
+            clock.good += 1
+            reply = clock.handle(body)
+            time.sleep(len(reply) * byte_time)
+            os.write(master, reply)
+        clock.bad = reader.bad
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+#
+# fontconv.py - converts the fixed cell fonts in Src/ugui.c into other formats
+#
+# Copyright (c) 2018 Louis Barrett
+#
+# Usage:
+#   fontconv.py prop font_8x14 --name 8x14P            proportional font
+#   fontconv.py prop font_8x14 --name 8x14P --tabular --kern "Te-1,AV-1"
+#   fontconv.py rle font_32x53 --name 32X53R           run length coded font
+#   fontconv.py report                                 flash and decode cost
+#
+# The C tables are written to stdout, ready to paste into Src/ugui.c next to
+# the source font. Glyph bitmaps keep the uGUI layout: one row after the
+# other, (width + 7) / 8 bytes per row, leftmost pixel in bit 0.
+#
+# Run length coded glyphs are read column by column, top to bottom, which is
+# the order of the bits in a frame buffer page. They are stored as alternating
+# background and foreground runs, starting with background, packed LSB first
+# with a field width per color chosen for the font. A run longer than its
+# field continues after a zero run of the other color. The background after
+# the last foreground pixel is not stored.
+
+import argparse
+import os
+import re
+import sys
+
+UGUI_C = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Src', 'ugui.c')
+
+
+def load_fonts(path=UGUI_C):
+    """Returns {name: (width, height, [glyph bytes, ...])} for every table."""
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+    head = re.compile(r'__UG_CONST unsigned char (font_\w+)\[(\d+)\]\[(\d+)\]=\{')
+    fonts = {}
+    for m in head.finditer(text):
+        name = m.group(1)
+        size = int(m.group(3))
+        body = text[m.end():text.index('};', m.end())]
+        glyphs = [bytes(int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', row))
+                  for row in re.findall(r'\{([^}]*)\}', body)]
+        dims = re.search(r'font_(\d+)x(\d+)', name)
+        width, height = int(dims.group(1)), int(dims.group(2))
+        assert all(len(g) == size for g in glyphs), name
+        assert size == ((width + 7) // 8) * height, name
+        fonts[name] = (width, height, glyphs)
+    return fonts
+
+
+def pixels(glyph, width, height):
+    """Glyph as rows of 0/1, row major."""
+    bn = (width + 7) // 8
+    return [[(glyph[y * bn + x // 8] >> (x & 7)) & 1 for x in range(width)]
+            for y in range(height)]
+
+
+def pack(rows, width):
+    """Rows of 0/1 back into uGUI glyph bytes."""
+    bn = (width + 7) // 8
+    out = bytearray()
+    for row in rows:
+        line = bytearray(bn)
+        for x, bit in enumerate(row):
+            if bit:
+                line[x // 8] |= 1 << (x & 7)
+        out += line
+    return bytes(out)
+
+
+def ink_box(rows):
+    """(x0, y0, x1, y1) of the set pixels, None for a blank glyph."""
+    ys = [y for y, row in enumerate(rows) if any(row)]
+    xs = [x for row in rows for x, bit in enumerate(row) if bit]
+    if not ys:
+        return None
+    return min(xs), min(ys), max(xs), max(ys)
+
+
+def cp437(code):
+    """uGUI draws these Latin-1 codes from their code page 437 cells."""
+    return {0xF6: 0x94, 0xD6: 0x99, 0xFC: 0x81, 0xDC: 0x9A,
+            0xE4: 0x84, 0xC4: 0x8E, 0xB5: 0xE6, 0xB0: 0xF8}.get(code, code)
+
+
+def proportional(width, height, glyphs, first, last, tabular):
+    """Trims each glyph to its ink, returns (bitmap, [(offset, w, h, x, y, adv)])."""
+    bitmap = bytearray()
+    entries = []
+    boxes = {}
+    for code in range(first, last + 1):
+        rows = pixels(glyphs[cp437(code)], width, height)
+        boxes[code] = (rows, ink_box(rows))
+
+    # Digits share one advance so that changing numbers do not jiggle
+    digit = 0
+    if tabular:
+        digit = max(b[2] - b[0] + 1 for r, b in (boxes[c] for c in range(0x30, 0x3A)
+                                                  if first <= c <= last) if b)
+
+    for code in range(first, last + 1):
+        rows, box = boxes[code]
+        if box is None:
+            entries.append((len(bitmap), 0, 0, 0, 0, (width + 1) // 2))
+            continue
+        x0, y0, x1, y1 = box
+        w, h = x1 - x0 + 1, y1 - y0 + 1
+        xo, adv = 0, w
+        if tabular and 0x30 <= code <= 0x39:
+            xo, adv = (digit - w) // 2, digit
+        entries.append((len(bitmap), w, h, xo, y0, adv))
+        bitmap += pack([row[x0:x1 + 1] for row in rows[y0:y1 + 1]], w)
+    return bytes(bitmap), entries
+
+
+def column_runs(glyph, width, height):
+    """Alternating background/foreground run lengths, column major."""
+    rows = pixels(glyph, width, height)
+    bits = [rows[y][x] for x in range(width) for y in range(height)]
+    while bits and not bits[-1]:
+        bits.pop()
+    runs = []
+    color, count = 0, 0
+    for bit in bits:
+        if bit != color:
+            runs.append(count)
+            color, count = bit, 0
+        count += 1
+    if bits:
+        runs.append(count)
+    return runs
+
+
+def rle_fields(runs, bits_bg, bits_fg):
+    """Splits the runs into (value, bits) fields, colors still alternating."""
+    fields = []
+    for i, run in enumerate(runs):
+        bits = bits_fg if i & 1 else bits_bg
+        other = bits_bg if i & 1 else bits_fg
+        limit = (1 << bits) - 1
+        while run > limit:
+            fields += [(limit, bits), (0, other)]
+            run -= limit
+        fields.append((run, bits))
+    return fields
+
+
+def rle_encode(glyph, width, height, bits_bg, bits_fg):
+    value, used = 0, 0
+    for run, bits in rle_fields(column_runs(glyph, width, height), bits_bg, bits_fg):
+        value |= run << used
+        used += bits
+    return value.to_bytes((used + 7) // 8, 'little')
+
+
+def rle_decode(data, width, height, bits_bg, bits_fg):
+    """Inverse of rle_encode, for checking. Returns the uGUI glyph bytes."""
+    value, left = int.from_bytes(data, 'little'), len(data) * 8
+    bits = []
+    color = 0
+    while len(bits) < width * height:
+        size = bits_fg if color else bits_bg
+        if left < size:
+            break
+        bits += [color] * (value & ((1 << size) - 1))
+        value >>= size
+        left -= size
+        color ^= 1
+    bits += [0] * (width * height - len(bits))
+    rows = [[bits[x * height + y] for x in range(width)] for y in range(height)]
+    return pack(rows, width)
+
+
+def rle_font(width, height, glyphs):
+    """Picks the field widths giving the smallest font, returns
+    (bits_bg, bits_fg, [encoded glyph, ...])."""
+    runs = [column_runs(g, width, height) for g in glyphs]
+    best = None
+    for bits_bg in range(1, 8):
+        for bits_fg in range(1, 8):
+            size = sum((sum(b for _, b in rle_fields(r, bits_bg, bits_fg)) + 7) // 8
+                       for r in runs)
+            if best is None or size < best[0]:
+                best = (size, bits_bg, bits_fg)
+    _, bits_bg, bits_fg = best
+    coded = [rle_encode(g, width, height, bits_bg, bits_fg) for g in glyphs]
+    for g, c in zip(glyphs, coded):
+        assert rle_decode(c, width, height, bits_bg, bits_fg) == g
+    return bits_bg, bits_fg, coded
+
+
+# Cortex-M0+ cycles of the decoder loop in LCD_PutRle() (Src/lcd.c), counted
+# from its instruction mix: per field read, per byte refilled, per column
+# segment (clipping and the call) and per frame buffer byte written
+CYCLES_FIELD = 11
+CYCLES_REFILL = 9
+CYCLES_SEGMENT = 32
+CYCLES_PAGE = 14
+CYCLES_SETUP = 40
+
+
+def rle_cycles(glyph, width, height, bits_bg, bits_fg, y=0):
+    """Estimated decode cycles of one glyph drawn at row y."""
+    fields = rle_fields(column_runs(glyph, width, height), bits_bg, bits_fg)
+    used = sum(b for _, b in fields)
+    cycles = CYCLES_SETUP + CYCLES_FIELD * len(fields) + CYCLES_REFILL * ((used + 7) // 8)
+    pos = 0
+    # The trailing background is one more run up to the end of the glyph
+    runs = [r for r, _ in fields] + [width * height - sum(r for r, _ in fields)]
+    for run in runs:
+        while run:
+            row = pos % height
+            k = min(run, height - row)
+            cycles += CYCLES_SEGMENT
+            cycles += CYCLES_PAGE * ((y + row + k - 1) // 8 - (y + row) // 8 + 1)
+            pos += k
+            run -= k
+    return cycles
+
+
+def parse_kern(spec):
+    """'AV-1,Te-1' into sorted [(left, right, adjust)]."""
+    pairs = []
+    for item in filter(None, (s.strip() for s in spec.split(','))):
+        pairs.append((ord(item[0]), ord(item[1]), int(item[2:])))
+    return sorted(pairs)
+
+
+def emit_prop(name, src, width, height, bitmap, entries, first, last, kern, out):
+    lower = name.lower()
+    out.write('#ifdef USE_FONT_%s\n' % name.upper())
+    out.write('/* Proportional FONT_%s, generated by Tools/fontconv.py from %s */\n' % (name.upper(), src))
+    out.write('__UG_CONST UG_U8 font_%s_bitmap[%d]={\n' % (lower, len(bitmap)))
+    for i in range(0, len(bitmap), 16):
+        out.write('  ' + ','.join('0x%02X' % b for b in bitmap[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('__UG_CONST UG_GLYPH font_%s_glyph[%d]={\n' % (lower, len(entries)))
+    for code, (offset, w, h, xo, yo, adv) in enumerate(entries, first):
+        out.write('{%d,%d,%d,%d,%d,%d}, // 0x%02X\n' % (offset, w, h, xo, yo, adv, code))
+    out.write('};\n\n')
+    if kern:
+        out.write('__UG_CONST UG_KERN font_%s_kern[%d]={\n' % (lower, len(kern)))
+        for left, right, adjust in kern:
+            out.write("{0x%02X,0x%02X,%d}, // %c%c\n" % (left, right, adjust, left, right))
+        out.write('};\n\n')
+    out.write('__UG_CONST UG_FONT_PROP font_%s_prop={font_%s_bitmap,font_%s_glyph,%s,%d,0x%02X,0x%02X};\n'
+              % (lower, lower, lower, 'font_%s_kern' % lower if kern else 'NULL',
+                 len(kern), first, last))
+    out.write('#endif\n')
+    flash = len(bitmap) + 8 * len(entries) + 3 * len(kern)
+    sys.stderr.write('%s: %d bytes (bitmap %d, index %d, kerning %d) against %d for %s\n'
+                     % (name, flash, len(bitmap), 8 * len(entries), 3 * len(kern),
+                        ((width + 7) // 8) * height * 256, src))
+
+
+def emit_rle(name, src, width, height, bits_bg, bits_fg, coded, out):
+    lower = name.lower()
+    data = b''.join(coded)
+    offsets = [0]
+    for c in coded:
+        offsets.append(offsets[-1] + len(c))
+    assert offsets[-1] < 0x10000
+    out.write('#ifdef USE_FONT_%s\n' % name.upper())
+    out.write('/* Run length coded FONT_%s, generated by Tools/fontconv.py from %s */\n' % (name.upper(), src))
+    out.write('__UG_CONST UG_U8 font_%s_data[%d]={\n' % (lower, len(data)))
+    for i in range(0, len(data), 16):
+        out.write('  ' + ','.join('0x%02X' % b for b in data[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('__UG_CONST UG_U16 font_%s_offset[%d]={\n' % (lower, len(offsets)))
+    for i in range(0, len(offsets), 16):
+        out.write('  ' + ','.join('%d' % o for o in offsets[i:i + 16]) + ',\n')
+    out.write('};\n\n')
+    out.write('__UG_CONST UG_FONT_RLE font_%s_rle={font_%s_data,font_%s_offset,%d,%d};\n'
+              % (lower, lower, lower, bits_bg, bits_fg))
+    out.write('#endif\n')
+    raw = ((width + 7) // 8) * height * len(coded)
+    sys.stderr.write('%s: %d bytes (runs %d, index %d) against %d for %s\n'
+                     % (name, len(data) + 2 * len(offsets), len(data), 2 * len(offsets), raw, src))
+
+
+def report(fonts, out):
+    """Flash and decode cost of every font when run length coded."""
+    out.write('%-16s %7s %7s %7s %5s %9s %9s\n'
+              % ('font', 'raw', 'rle', 'saved', 'bits', 'cyc/avg', 'cyc/max'))
+    for name in sorted(fonts, key=lambda n: (fonts[n][0] * fonts[n][1], n)):
+        width, height, glyphs = fonts[name]
+        bits_bg, bits_fg, coded = rle_font(width, height, glyphs)
+        raw = sum(len(g) for g in glyphs)
+        size = sum(len(c) for c in coded) + 2 * (len(coded) + 1)
+        # Printable ASCII where the table has it, drawn on a page boundary
+        sample = glyphs[0x20:0x7F] if len(glyphs) == 256 else glyphs
+        cycles = [rle_cycles(g, width, height, bits_bg, bits_fg) for g in sample]
+        out.write('%-16s %7d %7d %7d %3d/%d %9d %9d\n'
+                  % (name, raw, size, raw - size, bits_bg, bits_fg,
+                     sum(cycles) // len(cycles), max(cycles)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert uGUI fonts')
+    sub = parser.add_subparsers(dest='cmd', required=True)
+    p = sub.add_parser('prop', help='proportional font with a glyph index')
+    p.add_argument('font', help='source table, e.g. font_8x14')
+    p.add_argument('--name', required=True, help='suffix of the generated names, e.g. 8x14P')
+    p.add_argument('--first', type=lambda s: int(s, 0), default=0x20)
+    p.add_argument('--last', type=lambda s: int(s, 0), default=0x7E)
+    p.add_argument('--tabular', action='store_true', help='same advance for all digits')
+    p.add_argument('--kern', default='', help='pairs like "AV-1,Te-1"')
+    r = sub.add_parser('rle', help='run length coded font')
+    r.add_argument('font', help='source table, e.g. font_32x53')
+    r.add_argument('--name', required=True, help='suffix of the generated names, e.g. 32X53R')
+    sub.add_parser('report', help='flash saved and decode cycles of every font')
+    args = parser.parse_args()
+
+    fonts = load_fonts()
+    if args.cmd == 'report':
+        report(fonts, sys.stdout)
+        return
+    if args.font not in fonts:
+        parser.error('no table %s, have %s' % (args.font, ', '.join(sorted(fonts))))
+    width, height, glyphs = fonts[args.font]
+    if args.cmd == 'rle':
+        bits_bg, bits_fg, coded = rle_font(width, height, glyphs)
+        emit_rle(args.name, args.font, width, height, bits_bg, bits_fg, coded, sys.stdout)
+        return
+    if len(glyphs) < 256:
+        parser.error('%s is a sparse table, convert a full one' % args.font)
+
+    bitmap, entries = proportional(width, height, glyphs, args.first, args.last, args.tabular)
+    emit_prop(args.name, args.font, width, height, bitmap, entries,
+              args.first, args.last, parse_kern(args.kern), sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,290 @@
+#
+# proto.py - framing shared by the host tools for the USART2 protocol
+#
+# Copyright (c) 2018 Louis Barrett
+#
+# A frame is 0x00, COBS(cmd, seq, payload, CRC-16/CCITT-FALSE LE), 0x00.
+# Replies carry cmd | 0x80, the same seq and a status byte before their
+# payload. Keep in sync with Inc/proto.h.
+
+import struct
+import zlib
+
+CMD_SET_TIME = 0x01
+CMD_GET_STATS = 0x02
+CMD_SET_BRIGHTNESS = 0x03
+CMD_READ_FB = 0x04
+CMD_SET_FACE = 0x05
+CMD_FB_DELTA = 0x06
+CMD_SCREENSHOT = 0x07
+
+# Faces for CMD_SET_FACE, LCD_FACE_* in Inc/lcd.h
+FACE_TIME = 0
+FACE_WORLD = 1
+FACE_REMOTE = 2
+
+# Set in the page byte of the last CMD_FB_DELTA of a frame
+FB_PRESENT = 0x80
+
+RESPONSE = 0x80
+MAX_PAYLOAD = 128
+
+STATUS = {
+    0x00: 'OK',
+    0x01: 'unknown command',
+    0x02: 'bad length',
+    0x03: 'out of range',
+    0x04: 'not on this face',
+}
+
+# Seconds from the Unix epoch to 2000-01-01, the epoch the clock uses
+EPOCH_2000 = 946684800
+
+# Frame buffer geometry, one byte is 8 vertical pixels of a page
+LCD_WIDTH = 128
+LCD_HEIGHT = 32
+FRAME_BUFFER_SIZE = LCD_WIDTH * LCD_HEIGHT // 8
+LCD_PAGES = LCD_HEIGHT // 8
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_pos = 0
+    code = 1
+    for i, byte in enumerate(data):
+        if byte == 0:
+            out[code_pos] = code
+            code_pos = len(out)
+            out.append(0)
+            code = 1
+            continue
+        out.append(byte)
+        code += 1
+        if code == 0xFF and i + 1 < len(data):
+            out[code_pos] = code
+            code_pos = len(out)
+            out.append(0)
+            code = 1
+    out[code_pos] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            raise ValueError('malformed COBS')
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_frame(body):
+    """Returns the bytes to send for cmd, seq and payload in body."""
+    body = bytes(body) + struct.pack('<H', crc16(body))
+    return b'\x00' + cobs_encode(body) + b'\x00'
+
+
+class FrameReader:
+    """Splits a byte stream into checked frames. Anything that is not a
+    valid frame, such as trace records sharing the UART, is skipped."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        frames = []
+        self.buffer += data
+        while True:
+            end = self.buffer.find(0)
+            if end < 0:
+                return frames
+            chunk = bytes(self.buffer[:end])
+            del self.buffer[:end + 1]
+            if not chunk:
+                continue
+            try:
+                body = cobs_decode(chunk)
+            except ValueError:
+                self.bad += 1
+                continue
+            if len(body) < 4 or crc16(body[:-2]) != struct.unpack('<H', body[-2:])[0]:
+                self.bad += 1
+                continue
+            frames.append(body[:-2])
+
+
+def unpack_stats(payload):
+    utc, sub, uptime, pulses, good, bad, dropped = struct.unpack('<IHIhHHH', payload)
+    return {
+        'utc': utc + EPOCH_2000 + sub / 256.0,
+        'uptime_ms': uptime,
+        'calib_pulses': pulses,
+        'frames_good': good,
+        'frames_bad': bad,
+        'frames_dropped': dropped,
+    }
+
+
+def rle_encode(data):
+    """Run length encodes like LCD_ApplyDelta() decodes: a control byte n
+    below 0x80 is followed by n + 1 literal bytes, from 0x80 by one byte
+    repeated (n & 0x7F) + 1 times."""
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        # Two equal bytes cost as much either way, keep them in a literal
+        if run >= 3 or (run == 2 and not literal):
+            if literal:
+                out += bytes([len(literal) - 1]) + literal
+                literal = bytearray()
+            out += bytes([0x80 | (run - 1), data[i]])
+            i += run
+            continue
+        literal.append(data[i])
+        i += 1
+        if len(literal) == 128:
+            out += bytes([127]) + literal
+            literal = bytearray()
+    if literal:
+        out += bytes([len(literal) - 1]) + literal
+    return bytes(out)
+
+
+def rle_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        count = (data[i] & 0x7F) + 1
+        if data[i] & 0x80:
+            out += bytes([data[i + 1]]) * count
+            i += 2
+        else:
+            out += data[i + 1:i + 1 + count]
+            i += 1 + count
+    return bytes(out)
+
+
+def encode_deltas(old, new):
+    """Returns the CMD_FB_DELTA payloads that turn frame buffer old into new.
+    Unchanged pages are skipped and unchanged columns at either end of a
+    page are left out, a page that does not fit one payload is split. The
+    last payload asks for the frame to be presented."""
+    payloads = []
+
+    def add(page, first, delta):
+        encoded = rle_encode(delta)
+        if len(encoded) + 2 > MAX_PAYLOAD and len(delta) > 1:
+            half = len(delta) // 2
+            add(page, first, delta[:half])
+            add(page, first + half, delta[half:])
+            return
+        payloads.append(bytearray([page, first]) + encoded)
+
+    for page in range(LCD_PAGES):
+        base = page * LCD_WIDTH
+        delta = bytes(a ^ b for a, b in zip(old[base:base + LCD_WIDTH], new[base:base + LCD_WIDTH]))
+        changed = [x for x in range(LCD_WIDTH) if delta[x]]
+        if changed:
+            add(page, changed[0], delta[changed[0]:changed[-1] + 1])
+    if payloads:
+        payloads[-1][0] |= FB_PRESENT
+    return [bytes(p) for p in payloads]
+
+
+def apply_delta(fb, payload):
+    """Applies one CMD_FB_DELTA payload to a bytearray frame buffer."""
+    page, column = payload[0] & ~FB_PRESENT, payload[1]
+    delta = rle_decode(payload[2:])
+    if page >= LCD_PAGES or column + len(delta) > LCD_WIDTH:
+        raise ValueError('delta out of range')
+    base = page * LCD_WIDTH + column
+    for i, byte in enumerate(delta):
+        fb[base + i] ^= byte
+
+
+def read_pbm(path):
+    """Reads a 128x32 binary PBM into a page-ordered frame buffer, black
+    pixels are unlit like write_pbm() writes them."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    fields = data.split(maxsplit=3)
+    if fields[0] != b'P4' or int(fields[1]) != LCD_WIDTH or int(fields[2]) != LCD_HEIGHT:
+        raise ValueError('%s is not a %dx%d P4 image' % (path, LCD_WIDTH, LCD_HEIGHT))
+    bits = fields[3][-LCD_HEIGHT * LCD_WIDTH // 8:]
+    fb = bytearray(FRAME_BUFFER_SIZE)
+    for y in range(LCD_HEIGHT):
+        for x in range(LCD_WIDTH):
+            if not bits[y * LCD_WIDTH // 8 + x // 8] & (0x80 >> (x & 7)):
+                fb[(y // 8) * LCD_WIDTH + x] |= 1 << (y & 7)
+    return fb
+
+
+def encode_pages(fb):
+    """Encodes a frame buffer like a CMD_SCREENSHOT series carries it."""
+    return b''.join(rle_encode(fb[page * LCD_WIDTH:(page + 1) * LCD_WIDTH])
+                    for page in range(LCD_PAGES))
+
+
+def write_png(path, fb):
+    """Writes a page-ordered frame buffer as a 1 bit greyscale PNG, lit
+    pixels white."""
+    raw = bytearray()
+    for y in range(LCD_HEIGHT):
+        row = bytearray((LCD_WIDTH + 7) // 8)
+        for x in range(LCD_WIDTH):
+            if fb[(y // 8) * LCD_WIDTH + x] & (1 << (y & 7)):
+                row[x // 8] |= 0x80 >> (x & 7)
+        raw += b'\x00' + row
+
+    def chunk(kind, data):
+        return (struct.pack('>I', len(data)) + kind + data
+                + struct.pack('>I', zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+    with open(path, 'wb') as f:
+        f.write(b'\x89PNG\r\n\x1a\n')
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', LCD_WIDTH, LCD_HEIGHT, 1, 0, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(raw))))
+        f.write(chunk(b'IEND', b''))
+
+
+def write_image(path, fb):
+    """Writes a PNG or, for any other extension, a PBM."""
+    if path.lower().endswith('.png'):
+        write_png(path, fb)
+    else:
+        write_pbm(path, fb)
+
+
+def write_pbm(path, fb):
+    """Writes a page-ordered 1bpp frame buffer as a binary PBM image. PBM
+    draws set bits black, so unlit pixels are set to look like the panel."""
+    rows = []
+    for y in range(LCD_HEIGHT):
+        row = bytearray((LCD_WIDTH + 7) // 8)
+        for x in range(LCD_WIDTH):
+            if not fb[(y // 8) * LCD_WIDTH + x] & (1 << (y & 7)):
+                row[x // 8] |= 0x80 >> (x & 7)
+        rows.append(bytes(row))
+    with open(path, 'wb') as f:
+        f.write(b'P4\n%d %d\n' % (LCD_WIDTH, LCD_HEIGHT))
+        f.write(b''.join(rows))
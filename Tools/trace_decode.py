@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+#
+# trace_decode.py - turns the binary trace stream from trace.c into a timeline
+#
+# Copyright (c) 2018 Louis Barrett
+#
+# Usage:
+#   trace_decode.py capture.bin            decode a raw capture of the UART
+#   trace_decode.py /dev/ttyACM0 --live    decode straight from the port
+#
+# Each record is 8 bytes, little endian: uint32 timestamp (SysTick clocks),
+# uint16 payload, uint8 event, uint8 seq. The seq byte increments by one per
+# record, which is used to find record boundaries and report lost records.
+# Protocol replies (proto.py frames) share the UART and come between whole
+# trace transfers. They are recognised by their CRC and skipped, then the
+# records are found again by their seq bytes.
+# The latency from each RTC wakeup to the frame presented for it is summarised
+# at the end.
+
+import argparse
+import struct
+import sys
+
+import proto
+
+RECORD = struct.Struct('<IHBB')
+
+# Keep in sync with the TRACE_EVT_* defines in Inc/trace.h
+EVENTS = {
+    0x00: 'OVERFLOW',
+    0x01: 'RTC_WAKEUP',
+    0x02: 'RENDER_START',
+    0x03: 'RENDER_END',
+    0x04: 'SPI_START',
+    0x05: 'SPI_DONE',
+    0x06: 'SLEEP_ENTER',
+    0x07: 'SLEEP_EXIT',
+    0x08: 'PRESENT',
+    0x09: 'ALARM',
+}
+
+
+# Records in a row whose seq bytes must count up to accept a record boundary
+SYNC_RECORDS = 3
+
+
+def frame_length(data, pos):
+    """Returns the length of the protocol frame at pos, 0 if there is none."""
+    if data[pos] != 0:
+        return 0
+    end = data.find(b'\x00', pos + 1)
+    if end <= pos + 1:
+        return 0
+    try:
+        body = proto.cobs_decode(data[pos + 1:end])
+    except ValueError:
+        return 0
+    if len(body) < 4 or proto.crc16(body[:-2]) != struct.unpack('<H', body[-2:])[0]:
+        return 0
+    return end + 1 - pos
+
+
+def chained(data, pos):
+    """True if records from pos on have seq bytes counting up by one,
+    stepping over any frames between them."""
+    seqs = []
+    while len(seqs) < SYNC_RECORDS and pos <= len(data) - RECORD.size:
+        length = frame_length(data, pos)
+        if length:
+            pos += length
+            continue
+        seqs.append(data[pos + RECORD.size - 1])
+        pos += RECORD.size
+    if len(seqs) < SYNC_RECORDS:
+        # Too close to the end of the capture to tell, take what is there
+        return True
+    return all((a + 1) & 0xFF == b for a, b in zip(seqs, seqs[1:]))
+
+
+def resync(data, pos):
+    """Returns the first position from pos on where a frame or a run of
+    records starts."""
+    while pos <= len(data) - RECORD.size:
+        if frame_length(data, pos) or chained(data, pos):
+            return pos
+        pos += 1
+    return len(data)
+
+
+def decode(data, clock_hz, out):
+    pos = resync(data, 0)
+    last_seq = None
+    last_ts = None
+    base = 0
+    origin = None
+    wakeup = None
+    latencies = []
+
+    frames = 0
+
+    while pos <= len(data) - RECORD.size:
+        length = frame_length(data, pos)
+        if length:
+            frames += 1
+            pos += length
+            continue
+
+        ts, payload, event, seq = RECORD.unpack_from(data, pos)
+        if last_seq is not None and seq != (last_seq + 1) & 0xFF:
+            if not chained(data, pos):
+                # Not on a record boundary, e.g. after a damaged reply
+                start = pos
+                pos = resync(data, pos + 1)
+                out.write('          --- %d byte(s) skipped to find the next record ---\n'
+                          % (pos - start))
+                continue
+            out.write('          --- %d record(s) lost on the link ---\n'
+                      % ((seq - last_seq - 1) & 0xFF))
+        last_seq = seq
+        pos += RECORD.size
+
+        # The 32 bit counter wraps every 2^32 clocks, unwrap it
+        if last_ts is not None and ts < last_ts:
+            base += 1 << 32
+        last_ts = ts
+        ts += base
+        if origin is None:
+            origin = ts
+
+        us = (ts - origin) * 1e6 / clock_hz
+        name = EVENTS.get(event, 'EVENT_0x%02X' % event)
+        out.write('%12.1f us  %-13s %d\n' % (us, name, payload))
+
+        # Display latency: second boundary (wakeup) to the frame being sent
+        if name == 'RTC_WAKEUP':
+            wakeup = ts
+        elif name == 'PRESENT' and wakeup is not None:
+            latencies.append((ts - wakeup) * 1e6 / clock_hz)
+            wakeup = None
+
+    if frames:
+        out.write('\n%d protocol frame(s) skipped\n' % frames)
+
+    if latencies:
+        out.write('\nPresent latency over %d frames: min %.1f us, avg %.1f us, max %.1f us\n'
+                  % (len(latencies), min(latencies),
+                     sum(latencies) / len(latencies), max(latencies)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a trace.c capture')
+    parser.add_argument('source', help='capture file or serial port')
+    parser.add_argument('--live', action='store_true', help='read from a serial port')
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--clock', type=int, default=2000000,
+                        help='SysTick clock in Hz (default: 2 MHz MSI)')
+    args = parser.parse_args()
+
+    if args.live:
+        import serial
+        port = serial.Serial(args.source, args.baud)
+        data = bytearray()
+        try:
+            while True:
+                data += port.read(RECORD.size * 16)
+        except KeyboardInterrupt:
+            pass
+    else:
+        with open(args.source, 'rb') as f:
+            data = f.read()
+
+    decode(bytes(data), args.clock, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()